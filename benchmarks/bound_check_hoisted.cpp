@@ -0,0 +1,69 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The cost of NDA_BOUNDCHECK_HOISTED : an assignment of an expression, in a non contiguous loop,
+// checks the shapes once and not the element accesses.
+// Compare the hoisted assignment to the loop on pointers (no check, the reference)
+// and to the same loop with checked element accesses (the cost without hoisting).
+#define NDA_BOUNDCHECK_HOISTED
+#include "./bench_common.hpp"
+
+const int N1 = 100;
+
+class ABC_2d : public benchmark::Fixture {
+  public:
+  nda::array<double, 2> a, b, c;
+
+  void SetUp(const ::benchmark::State &) {
+    a.resize(N1, N1);
+    b.resize(N1, N1);
+    c.resize(N1, N1);
+    b = 0;
+    c = 0;
+  }
+
+  void TearDown(const ::benchmark::State &) {}
+};
+
+#define BENCH_ABC_2d(F)                                                                                                                              \
+  BENCHMARK_F(ABC_2d, F)(benchmark::State & state) {                                                                                                 \
+    while (state.KeepRunning()) { F(a, b, c); }                                                                                                      \
+  }
+
+// -----------------------------------------------------------------------
+
+// the rhs is transposed : the assignment can not be a 1d loop
+[[gnu::noinline]] void hoisted_assign(nda::array<double, 2> &a, nda::array<double, 2> &b, nda::array<double, 2> &c) {
+  a = 2 * transpose(b) + c;
+}
+
+[[gnu::noinline]] void checked_loop(nda::array<double, 2> &a, nda::array<double, 2> &b, nda::array<double, 2> &c) {
+  const long l0 = a.shape()[0];
+  const long l1 = a.shape()[1];
+  for (long i0 = 0; i0 < l0; ++i0)
+    for (long i1 = 0; i1 < l1; ++i1) { a(i0, i1) = 2 * b(i1, i0) + c(i0, i1); }
+}
+
+[[gnu::noinline]] void pointers_loop(nda::array<double, 2> &a, nda::array<double, 2> &b, nda::array<double, 2> &c) {
+  const long l0 = a.shape()[0];
+  const long l1 = a.shape()[1];
+  double *pa = a.data(), *pb = b.data(), *pc = c.data();
+  for (long i0 = 0; i0 < l0; ++i0)
+    for (long i1 = 0; i1 < l1; ++i1) { pa[i0 * l1 + i1] = 2 * pb[i1 * l0 + i0] + pc[i0 * l1 + i1]; }
+}
+
+// -----------------------------------------------------------------------
+BENCH_ABC_2d(hoisted_assign);
+BENCH_ABC_2d(checked_loop);
+BENCH_ABC_2d(pointers_loop);
@@ -0,0 +1,384 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <nda/nda.hpp>
+#include <nda/blas.hpp>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*
+ * Hardware counters and roofline for the nda benchmarks.
+ *
+ * perf::run(state, bytes, flops, f, n_threads) replaces the loop "for (auto _ : state) f();" of a Google Benchmark.
+ * bytes and flops are the memory traffic and the floating point operations of one call of f,
+ * n_threads the number of threads f runs on (1 by default).
+ * Besides the time, it reports the counters (Google Benchmark user counters, so they are in the console,
+ * --benchmark_format=json and csv outputs, and can be plotted with plot.py) :
+ *
+ *   GB_per_s, GFLOP_per_s     achieved bandwidth and flop rate
+ *   bw_fraction               GB_per_s / the STREAM triad bandwidth measured on this machine, with n_threads threads
+ *   peak_fraction             GFLOP_per_s / the peak flop rate measured on this machine (multiply-add kernel), with n_threads threads
+ *   roof_GB_per_s, roof_GFLOP_per_s   this roofline
+ *   bound                     0 : bandwidth bound, 1 : compute bound, 2 : latency bound (neither is reached)
+ *   IPC                       instructions per cycle
+ *   cycles, instructions, L1D_misses, LLC_misses     per call of f
+ *   vector_ratio              vector / (scalar + vector) floating point instructions
+ *
+ * The counters are read with perf_event_open (Linux), in user space only (it works with perf_event_paranoid <= 2).
+ * They count the calling thread only : the work done by the other threads (the nda::exec workers, the threads of
+ * a multithreaded BLAS) is not in cycles, instructions, ... For the counters of a whole kernel, run it on one thread
+ * (e.g. NDA_NUM_THREADS=1, and a perf::single_thread_blas in the scope of the BLAS calls).
+ * If a counter is not available (other OS, virtual machine, ...), it is not reported.
+ * vector_ratio uses the FP_ARITH_INST_RETIRED events of Intel cores. On other cores, set the raw event codes
+ * in NDA_PERF_FP_SCALAR and NDA_PERF_FP_VECTOR (hexadecimal, as for perf stat -e rXXXX).
+ *
+ * The roofline is measured at the first benchmark which needs it, once per number of threads : the STREAM triad and the
+ * multiply-add kernel both run on n_threads threads, so that a kernel is compared to the machine with the same resources.
+ * The peak is also at least n_threads times the flop rate of a dgemm on one BLAS thread (the compiled multiply-add kernel
+ * may not use the widest vector instructions of the machine, the BLAS does).
+ * NDA_PEAK_GBPS and NDA_PEAK_GFLOPS override the measured values of the one thread roofline (e.g. with the vendor numbers).
+ */
+
+namespace perf {
+
+  // ------------------ perf_event counters ------------------
+
+  /// A group of counters, read together. Only the counters which can be opened are in the group.
+  class counter_group {
+    struct counter_t {
+      std::string name;
+      int fd = -1;
+    };
+    std::vector<counter_t> counters;
+    int leader = -1;
+
+#ifdef __linux__
+    static int open_event(std::uint32_t type, std::uint64_t config, int group_fd) {
+      perf_event_attr attr{};
+      attr.size           = sizeof(attr);
+      attr.type           = type;
+      attr.config         = config;
+      attr.disabled       = (group_fd == -1);
+      attr.exclude_kernel = 1;
+      attr.exclude_hv     = 1;
+      attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      return int(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+    }
+#endif
+
+    public:
+    counter_group() = default;
+
+    counter_group(counter_group const &)            = delete;
+    counter_group &operator=(counter_group const &) = delete;
+
+    ~counter_group() {
+#ifdef __linux__
+      for (auto &c : counters) close(c.fd);
+#endif
+    }
+
+    /// Adds a counter. Returns false if it is not available.
+    bool add(std::string const &name, std::uint32_t type, std::uint64_t config) {
+#ifdef __linux__
+      int fd = open_event(type, config, leader);
+      if (fd < 0) return false;
+      if (leader == -1) leader = fd;
+      counters.push_back({name, fd});
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    [[nodiscard]] bool empty() const { return counters.empty(); }
+
+    void start() {
+#ifdef __linux__
+      if (leader == -1) return;
+      ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    void stop() {
+#ifdef __linux__
+      if (leader != -1) ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    /// The values of the counters, scaled if the group was multiplexed, as (name, value)
+    [[nodiscard]] std::vector<std::pair<std::string, double>> read() const {
+      std::vector<std::pair<std::string, double>> r;
+#ifdef __linux__
+      if (leader == -1) return r;
+      // nr, time_enabled, time_running, values...
+      std::vector<std::uint64_t> buf(3 + counters.size());
+      if (::read(leader, buf.data(), buf.size() * sizeof(std::uint64_t)) <= 0 or buf[2] == 0) return r;
+      double scale = double(buf[1]) / double(buf[2]);
+      for (size_t i = 0; i < counters.size(); ++i) r.emplace_back(counters[i].name, double(buf[3 + i]) * scale);
+#endif
+      return r;
+    }
+  };
+
+  namespace details {
+
+    inline std::uint64_t cache_event(std::uint64_t cache, std::uint64_t op, std::uint64_t result) { return cache | (op << 8) | (result << 16); }
+
+    inline bool is_intel() {
+      std::ifstream f("/proc/cpuinfo");
+      std::string line;
+      while (std::getline(f, line))
+        if (line.rfind("vendor_id", 0) == 0) return line.find("GenuineIntel") != std::string::npos;
+      return false;
+    }
+
+    inline std::uint64_t env_hex(char const *var, std::uint64_t def) {
+      auto *s = std::getenv(var);
+      return (s == nullptr ? def : std::strtoull(s, nullptr, 16));
+    }
+
+    inline double env_double(char const *var) {
+      auto *s = std::getenv(var);
+      return (s == nullptr ? 0 : std::atof(s));
+    }
+
+  } // namespace details
+
+  /// The core counters : cycles, instructions, L1D read misses, LLC misses
+  inline void add_core_counters(counter_group &g) {
+#ifdef __linux__
+    using details::cache_event;
+    g.add("cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    g.add("instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    g.add("L1D_misses", PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS));
+    g.add("LLC_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+#endif
+  }
+
+  /// The floating point instruction counters (scalar and vector), cf NDA_PERF_FP_SCALAR/VECTOR
+  inline void add_fp_counters(counter_group &g) {
+#ifdef __linux__
+    // Intel FP_ARITH_INST_RETIRED (event 0xc7) : umask 0x03 scalar, 0xfc packed 128/256/512 bits
+    bool intel = details::is_intel();
+    auto sc    = details::env_hex("NDA_PERF_FP_SCALAR", intel ? 0x03c7 : 0);
+    auto vec   = details::env_hex("NDA_PERF_FP_VECTOR", intel ? 0xfcc7 : 0);
+    if (sc == 0 or vec == 0) return;
+    if (g.add("fp_scalar", PERF_TYPE_RAW, sc)) g.add("fp_vector", PERF_TYPE_RAW, vec);
+#endif
+  }
+
+  // ------------------ BLAS threads ------------------
+
+  extern "C" {
+  // The thread control of OpenBLAS and MKL, if one of them is linked (weak : null otherwise)
+  int openblas_get_num_threads() __attribute__((weak));
+  void openblas_set_num_threads(int) __attribute__((weak));
+  int mkl_set_num_threads_local(int) __attribute__((weak));
+  }
+
+  /// In its scope, the BLAS (OpenBLAS or MKL) runs on one thread, i.e. the calling thread. No effect with another BLAS.
+  class single_thread_blas {
+    int openblas_n = 0, mkl_n = 0;
+
+    public:
+    single_thread_blas() {
+      if (openblas_get_num_threads != nullptr and openblas_set_num_threads != nullptr) {
+        openblas_n = openblas_get_num_threads();
+        openblas_set_num_threads(1);
+      }
+      if (mkl_set_num_threads_local != nullptr) mkl_n = mkl_set_num_threads_local(1);
+    }
+
+    single_thread_blas(single_thread_blas const &)            = delete;
+    single_thread_blas &operator=(single_thread_blas const &) = delete;
+
+    ~single_thread_blas() {
+      if (openblas_n > 0) openblas_set_num_threads(openblas_n);
+      if (mkl_set_num_threads_local != nullptr) mkl_set_num_threads_local(mkl_n);
+    }
+  };
+
+  // ------------------ Roofline ------------------
+
+  /// The bandwidth (STREAM triad) and the peak flop rate, as measured on a number of threads
+  struct roofline_t {
+    double gbps   = 0;
+    double gflops = 0;
+  };
+
+  namespace details {
+
+    template <typename F>
+    double best_time(int repeat, F f) {
+      double best = 1e300;
+      for (int r = 0; r < repeat; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count());
+      }
+      return best;
+    }
+
+    // Runs f(t) on the threads t = 0 ... n_threads - 1, the calling thread being 0
+    template <typename F>
+    void on_threads(int n_threads, F f) {
+      std::vector<std::thread> th;
+      for (int t = 1; t < n_threads; ++t) th.emplace_back(f, t);
+      f(0);
+      for (auto &x : th) x.join();
+    }
+
+    // STREAM triad a = b + s * c, on arrays much larger than the caches, each thread on its own part
+    inline double measure_stream_gbps(int n_threads) {
+      long n = (1l << 24) * n_threads;
+      std::vector<double> a(n, 0), b(n, 1), c(n, 2);
+      double s = 3;
+      double t = best_time(5, [&] {
+        on_threads(n_threads, [&](int th) {
+          long b0 = n * th / n_threads, b1 = n * (th + 1) / n_threads;
+          double *__restrict pa = a.data();
+          double const *pb = b.data(), *pc = c.data();
+          for (long i = b0; i < b1; ++i) pa[i] = pb[i] + s * pc[i];
+          benchmark::DoNotOptimize(pa);
+          benchmark::ClobberMemory();
+        });
+      });
+      return 3.0 * sizeof(double) * n / t * 1e-9;
+    }
+
+    // The best of independent multiply-add chains (in registers) on each thread,
+    // and of n_threads times a dgemm on one BLAS thread (the peak of a core times the number of threads)
+    inline double measure_peak_gflops(int n_threads) {
+      constexpr int W = 16;
+      long n_iter     = 1l << 24;
+      double t        = best_time(3, [&] {
+        on_threads(n_threads, [&](int) {
+          std::array<double, W> x;
+          x.fill(1.0);
+          for (long it = 0; it < n_iter; ++it) {
+            for (int k = 0; k < W; ++k) x[k] = x[k] * 0.999999999 + 1e-9;
+          }
+          benchmark::DoNotOptimize(x);
+        });
+      });
+
+      long n = 512;
+      nda::matrix<double> a(n, n), b(n, n), c(n, n);
+      a = 1;
+      b = 1;
+      single_thread_blas one_thread;
+      double t_mm = best_time(3, [&] { nda::blas::gemm(1.0, a, b, 0.0, c); });
+      return std::max(2.0 * W * n_iter * n_threads / t, 2.0 * n * n * n * n_threads / t_mm) * 1e-9;
+    }
+
+  } // namespace details
+
+  /// The roofline of this machine on n_threads threads, measured at the first call for this number of threads
+  inline roofline_t const &roofline(int n_threads = 1) {
+    static std::mutex mu;
+    static std::map<int, roofline_t> cache;
+    n_threads = std::max(1, n_threads);
+    std::lock_guard lock{mu};
+    if (auto it = cache.find(n_threads); it != cache.end()) return it->second;
+    roofline_t x;
+    if (n_threads == 1) {
+      x.gbps   = details::env_double("NDA_PEAK_GBPS");
+      x.gflops = details::env_double("NDA_PEAK_GFLOPS");
+    }
+    if (x.gbps <= 0) x.gbps = details::measure_stream_gbps(n_threads);
+    if (x.gflops <= 0) x.gflops = details::measure_peak_gflops(n_threads);
+    return cache[n_threads] = x;
+  }
+
+  /// Classification of a kernel, from the fractions of the bandwidth and of the peak it reaches
+  enum class bound_t { bandwidth = 0, compute = 1, latency = 2 };
+
+  inline bound_t classify(double bw_fraction, double peak_fraction, double threshold = 0.5) {
+    if (bw_fraction >= threshold and bw_fraction >= peak_fraction) return bound_t::bandwidth;
+    if (peak_fraction >= threshold) return bound_t::compute;
+    return bound_t::latency;
+  }
+
+  // ------------------ Benchmark loop ------------------
+
+  /**
+   * Runs the benchmark loop of state on f, with the hardware counters and the roofline.
+   *
+   * @param bytes Bytes read and written by one call of f
+   * @param flops Floating point operations of one call of f
+   * @param n_threads Number of threads f runs on : the roofline is the one for this number of threads.
+   *                  The hardware counters are those of the calling thread only.
+   */
+  template <typename F>
+  void run(benchmark::State &state, double bytes, double flops, F &&f, int n_threads = 1) {
+    auto const &roof = roofline(n_threads);
+
+    counter_group core, fp;
+    add_core_counters(core);
+    add_fp_counters(fp);
+
+    core.start();
+    fp.start();
+    auto t0 = std::chrono::steady_clock::now();
+    for (auto _ : state) f();
+    double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    fp.stop();
+    core.stop();
+
+    double n = std::max<double>(1, state.iterations());
+    double gbps = bytes * n / t * 1e-9, gflops = flops * n / t * 1e-9;
+    double bw_fraction = gbps / roof.gbps, peak_fraction = gflops / roof.gflops;
+    state.counters["GB_per_s"]         = gbps;
+    state.counters["GFLOP_per_s"]      = gflops;
+    state.counters["bw_fraction"]      = bw_fraction;
+    state.counters["peak_fraction"]    = peak_fraction;
+    state.counters["bound"]            = double(classify(bw_fraction, peak_fraction));
+    state.counters["roof_GB_per_s"]    = roof.gbps;
+    state.counters["roof_GFLOP_per_s"] = roof.gflops;
+    state.counters["threads"]          = n_threads;
+
+    double cycles = 0, instructions = 0, fp_scalar = 0, fp_vector = 0;
+    for (auto const &[name, v] : core.read()) {
+      state.counters[name] = v / n;
+      if (name == "cycles") cycles = v;
+      if (name == "instructions") instructions = v;
+    }
+    if (cycles > 0 and instructions > 0) state.counters["IPC"] = instructions / cycles;
+    for (auto const &[name, v] : fp.read()) (name == "fp_scalar" ? fp_scalar : fp_vector) = v;
+    if (fp_scalar + fp_vector > 0) state.counters["vector_ratio"] = fp_vector / (fp_scalar + fp_vector);
+  }
+
+} // namespace perf
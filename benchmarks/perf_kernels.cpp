@@ -0,0 +1,123 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// A few nda kernels against the roofline, with the hardware counters of perf_counters.hpp.
+// e.g. ./perf_kernels --benchmark_out=perf.json --benchmark_out_format=json
+// The kernels run on one thread (the BLAS too, with perf::single_thread_blas), except triad_parallel (nda::exec).
+
+#include "./bench_common.hpp"
+#include "./perf_counters.hpp"
+
+#include <nda/blas.hpp>
+
+#include <numeric>
+#include <random>
+
+// a = b + s * c : 2 flops and 24 bytes per element. Bandwidth bound out of the caches.
+static void triad(benchmark::State &state) {
+  long N = state.range(0);
+  nda::array<double, 1> a(N), b(N), c(N);
+  b = 1;
+  c = 2;
+  perf::run(state, 24.0 * N, 2.0 * N, [&] {
+    a = b + 3.0 * c;
+    benchmark::DoNotOptimize(a.data());
+  });
+}
+BENCHMARK(triad)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 24);
+
+// ---------------------------------
+
+// The same, on the threads of nda::exec : compared to the roofline for that number of threads.
+// The counters are those of the calling thread (worker 0) only.
+static void triad_parallel(benchmark::State &state) {
+  long N = state.range(0);
+  nda::array<double, 1> a(N), b(N), c(N);
+  b = 1;
+  c = 2;
+  perf::run(
+     state, 24.0 * N, 2.0 * N,
+     [&] {
+       nda::exec::parallel_for_chunks(N, [&](long i0, long i1) { a(range(i0, i1)) = b(range(i0, i1)) + 3.0 * c(range(i0, i1)); });
+       benchmark::DoNotOptimize(a.data());
+     },
+     nda::exec::n_threads());
+}
+BENCHMARK(triad_parallel)->Arg(1 << 24);
+
+// ---------------------------------
+
+// The same, with a stride 8 : one double per cache line is used
+static void triad_strided(benchmark::State &state) {
+  long N = state.range(0);
+  nda::array<double, 1> a(8 * N), b(8 * N), c(8 * N);
+  b = 1;
+  c = 2;
+  auto av = a(range(0, 8 * N, 8));
+  auto bv = b(range(0, 8 * N, 8));
+  auto cv = c(range(0, 8 * N, 8));
+  perf::run(state, 24.0 * N, 2.0 * N, [&] {
+    av = bv + 3.0 * cv;
+    benchmark::DoNotOptimize(a.data());
+  });
+}
+BENCHMARK(triad_strided)->Arg(1 << 10)->Arg(1 << 20);
+
+// ---------------------------------
+
+// Transposed copy of a matrix
+static void transpose_copy(benchmark::State &state) {
+  long N = state.range(0);
+  nda::matrix<double> a(N, N), b(N, N);
+  a = 1;
+  perf::run(state, 16.0 * N * N, 0, [&] {
+    b = transpose(a);
+    benchmark::DoNotOptimize(b.data());
+  });
+}
+BENCHMARK(transpose_copy)->Arg(64)->Arg(1024);
+
+// ---------------------------------
+
+// Matrix product : compute bound for large N
+static void blas_gemm(benchmark::State &state) {
+  long N = state.range(0);
+  nda::matrix<double> a(N, N), b(N, N), c(N, N);
+  a = 1;
+  b = 2;
+  perf::single_thread_blas one_thread;
+  perf::run(state, 32.0 * N * N, 2.0 * N * N * N, [&] {
+    nda::blas::gemm(1.0, a, b, 0.0, c);
+    benchmark::DoNotOptimize(c.data());
+  });
+}
+BENCHMARK(blas_gemm)->Arg(32)->Arg(256)->Arg(1024);
+
+// ---------------------------------
+
+// Chasing a random cycle in an array of indices : each load depends on the previous one. Latency bound.
+static void pointer_chase(benchmark::State &state) {
+  long N = state.range(0);
+  nda::array<long, 1> next(N);
+  std::vector<long> perm(N);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::shuffle(perm.begin() + 1, perm.end(), std::mt19937{1});
+  for (long i = 0; i < N; ++i) next(perm[i]) = perm[(i + 1) % N];
+  long i = 0;
+  perf::run(state, 8.0 * N, 0, [&] {
+    for (long k = 0; k < N; ++k) i = next(i);
+    benchmark::DoNotOptimize(i);
+  });
+}
+BENCHMARK(pointer_chase)->Arg(1 << 10)->Arg(1 << 22);
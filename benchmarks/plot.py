@@ -25,7 +25,8 @@ import matplotlib.pyplot as plt
 
 logging.basicConfig(format='[%(levelname)s] %(message)s')
 
-METRICS = ['real_time', 'cpu_time', 'bytes_per_second', 'items_per_second']
+METRICS = ['real_time', 'cpu_time', 'bytes_per_second', 'items_per_second', 'GB_per_s', 'GFLOP_per_s', 'bw_fraction',
+           'peak_fraction', 'IPC', 'cycles', 'instructions', 'L1D_misses', 'LLC_misses', 'vector_ratio']
 TRANSFORMS = {
     '': lambda x: x,
     'inverse': lambda x: 1.0 / x
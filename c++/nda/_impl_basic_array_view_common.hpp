@@ -101,12 +101,22 @@ decltype(auto) operator()(_linear_index_t x) noexcept {
 private:
 // impl of call. Only different case is if Self is &&
 
-#ifdef NDA_ENFORCE_BOUNDCHECK
+#if defined(NDA_ENFORCE_BOUNDCHECK) or defined(NDA_BOUNDCHECK_HOISTED)
 static constexpr bool has_no_boundcheck = false;
 #else
 static constexpr bool has_no_boundcheck = true;
 #endif
 
+// Pointer to the data for an immediate access to the elements.
+// A mutable access to a copy-on-write storage detaches it, but does not make it unshareable (cf mem::handle_cow)
+template <typename Self>
+FORCEINLINE static auto *data_for_access(Self &self) {
+  if constexpr (requires { self.sto.mutable_data(); })
+    return self.sto.mutable_data();
+  else
+    return self.sto.data();
+}
+
 public:
 // I keep this public for the call of gf, which has to be reinterpreted as matrix
 // I can construct a matrix at once. Of course, the optimizer may eliminate the copy of handle and idx_map
@@ -135,10 +145,11 @@ FORCEINLINE static decltype(auto) call(Self &&self, T const &... x) noexcept(has
     // case 1 : all arguments are long, we simply compute the offset
     if constexpr (n_args_long == rank) {         // no range, simply compute the linear position. There may be an ellipsis, but it is of zero length !
       long offset = self.lay(x...);              // compute the offset
-      if constexpr (is_view or not SelfIsRvalue) //
-        return AccessorPolicy::template accessor<ValueType>::access(self.sto.data(),
-                                                                    offset); // We return a REFERENCE here. Ok since underlying array is still alive
-      else                                                                   //
+      if constexpr (is_view or not SelfIsRvalue) { //
+        auto *p = data_for_access(self);           // NB : const data for a const copy-on-write storage
+        return AccessorPolicy::template accessor<std::remove_pointer_t<decltype(p)>>::access(
+           p, offset); // We return a REFERENCE here. Ok since underlying array is still alive
+      } else           //
         return ValueType{self.sto[offset]};                                  // We return a VALUE here, the array is about be destroyed.
     }
     // case 2 : we have to make a slice
@@ -150,9 +161,12 @@ FORCEINLINE static decltype(auto) call(Self &&self, T const &... x) noexcept(has
 
       static constexpr char newAlgebra = (ResultAlgebra == 'M' and (r_layout_t::rank() == 1) ? 'V' : ResultAlgebra);
 
+      // ValueType, or ValueType const for a const copy-on-write storage
+      using s_v_t = std::remove_pointer_t<decltype(self.sto.data())>;
+
       using r_view_t =
          // FIXME  basic_array_view<r_v_t, r_layout_t::rank(),
-         basic_array_view<ValueType, r_layout_t::rank(), typename details::layout_to_policy<r_layout_t>::type, newAlgebra, AccessorPolicy,
+         basic_array_view<s_v_t, r_layout_t::rank(), typename details::layout_to_policy<r_layout_t>::type, newAlgebra, AccessorPolicy,
                           OwningPolicy>;
 
       return r_view_t{std::move(idxm), {self.sto, offset}};
@@ -235,37 +249,38 @@ using const_iterator = array_iterator<iterator_rank, ValueType const, typename A
 using iterator = array_iterator<iterator_rank, ValueType, typename AccessorPolicy::template accessor<ValueType>::pointer>;
 
 private:
-template <typename Iterator>
-[[nodiscard]] auto make_iterator(bool at_end) const noexcept {
+// Self is const for the const_iterator : a mutable iterator on a copy-on-write storage makes it unique and unshareable
+template <typename Iterator, typename Self>
+[[nodiscard]] static auto make_iterator(Self &self, bool at_end) noexcept {
   if constexpr (iterator_rank == Rank) {
     // FIXME : remove optimziation becasue of a TRIQS bug
-    return Iterator{indexmap().lengths(), indexmap().strides(), sto.data(), at_end};
+    return Iterator{self.indexmap().lengths(), self.indexmap().strides(), self.sto.data(), at_end};
     if constexpr (layout_t::is_stride_order_C())
-      return Iterator{indexmap().lengths(), indexmap().strides(), sto.data(), at_end};
+      return Iterator{self.indexmap().lengths(), self.indexmap().strides(), self.sto.data(), at_end};
     else
       // general case. In C order, no need to spend time applying the identity permutation
       // the new length used by the iterator is  length[ stride_order[0]], length[ stride_order[1]], ...
       // since stride_order[0] is the slowest, it will traverse the memory in sequential order
-      return Iterator{nda::permutations::apply(layout_t::stride_order, indexmap().lengths()),
-                      nda::permutations::apply(layout_t::stride_order, indexmap().strides()), sto.data(), at_end};
+      return Iterator{nda::permutations::apply(layout_t::stride_order, self.indexmap().lengths()),
+                      nda::permutations::apply(layout_t::stride_order, self.indexmap().strides()), self.sto.data(), at_end};
   } else // 1d iteration
-    return Iterator{std::array<long, 1>{size()}, std::array<long, 1>{indexmap().min_stride()}, sto.data(), at_end};
+    return Iterator{std::array<long, 1>{self.size()}, std::array<long, 1>{self.indexmap().min_stride()}, self.sto.data(), at_end};
 }
 
 public:
 ///
-[[nodiscard]] const_iterator begin() const noexcept { return make_iterator<const_iterator>(false); }
+[[nodiscard]] const_iterator begin() const noexcept { return make_iterator<const_iterator>(*this, false); }
 ///
-[[nodiscard]] const_iterator cbegin() const noexcept { return make_iterator<const_iterator>(false); }
+[[nodiscard]] const_iterator cbegin() const noexcept { return make_iterator<const_iterator>(*this, false); }
 ///
-iterator begin() noexcept { return make_iterator<iterator>(false); }
+iterator begin() noexcept { return make_iterator<iterator>(*this, false); }
 
 ///
-[[nodiscard]] const_iterator end() const noexcept { return make_iterator<const_iterator>(true); }
+[[nodiscard]] const_iterator end() const noexcept { return make_iterator<const_iterator>(*this, true); }
 ///
-[[nodiscard]] const_iterator cend() const noexcept { return make_iterator<const_iterator>(true); }
+[[nodiscard]] const_iterator cend() const noexcept { return make_iterator<const_iterator>(*this, true); }
 ///
-iterator end() noexcept { return make_iterator<iterator>(true); }
+iterator end() noexcept { return make_iterator<iterator>(*this, true); }
 
 // ------------------------------- Operations --------------------------------------------
 
@@ -319,7 +334,7 @@ private:
 template <typename RHS>
 void assign_from_ndarray(RHS const &rhs) { // FIXME noexcept {
 
-#ifdef NDA_ENFORCE_BOUNDCHECK
+#if defined(NDA_ENFORCE_BOUNDCHECK) or defined(NDA_BOUNDCHECK_HOISTED)
   if (this->shape() != rhs.shape())
     NDA_RUNTIME_ERROR << "Size mismatch:"
                       << "\n LHS.shape() = " << this->shape() << "\n RHS.shape() = " << rhs.shape();
@@ -331,9 +346,13 @@ void assign_from_ndarray(RHS const &rhs) { // FIXME noexcept {
   // general case if RHS is not a scalar (can be isp, expression...)
   static_assert(std::is_assignable_v<value_type &, get_value_t<RHS>>, "Assignment impossible for the type of RHS into the type of LHS");
 
+  // Some lazy expressions (e.g. axis reductions) have an optimized evaluation into a memory array
+  if constexpr (requires { rhs.evaluate_into(*this); }) {
+    rhs.evaluate_into(*this);
+  }
   // If LHS and RHS are both 1d strided order or contiguous, and have the same stride order
   // we can make a 1d loop
-  if constexpr ((get_layout_info<self_t>.stride_order == get_layout_info<RHS>.stride_order) // same stride order and both contiguous ...
+  else if constexpr ((get_layout_info<self_t>.stride_order == get_layout_info<RHS>.stride_order) // same stride order and both contiguous ...
                 and has_layout_strided_1d<self_t> and has_layout_strided_1d<RHS>) {
 
     static_assert(!std::is_reference_v<RHS>, "W?");
@@ -342,9 +361,15 @@ void assign_from_ndarray(RHS const &rhs) { // FIXME noexcept {
     // VALID ALSO FOR EXPRESSION !!!
     long L = size();
     for (long i = 0; i < L; ++i) (*this)(_linear_index_t{i}) = rhs(_linear_index_t{i});
+  }
+  // If LHS or RHS is tiled, loop tile by tile : in memory order on the tiled side, by blocks (cache friendly) on the other one
+  // The shapes are checked above : the loops pass hoisted indices (see details::hoisted_index)
+  else if constexpr ((get_tile_size<self_t> > 0) or (get_tile_size<RHS> > 0)) {
+    auto l = [this, &rhs](auto const &... args) { (*this)(args...) = rhs(args...); };
+    details::for_each_tiled_impl<(get_tile_size<self_t> > 0 ? get_tile_size<self_t> : get_tile_size<RHS>), true>(shape(), l);
   } else {
     auto l = [this, &rhs](auto const &... args) { (*this)(args...) = rhs(args...); };
-    nda::for_each(shape(), l);
+    details::for_each_hoisted(shape(), l);
   }
 }
 
@@ -355,7 +380,7 @@ void fill_with_scalar(Scalar const &scalar) noexcept {
   // we make a special implementation if the array is 1d strided or contiguous
   if constexpr (has_layout_strided_1d<self_t>) { // possibly contiguous
     const long L             = size();
-    auto *__restrict const p = data(); // no alias possible here !
+    auto *__restrict const p = data_for_access(*this); // no alias possible here !
     if constexpr (has_contiguous_layout<self_t>) {
       for (long i = 0; i < L; ++i) p[i] = scalar;
     } else {
@@ -363,6 +388,10 @@ void fill_with_scalar(Scalar const &scalar) noexcept {
       const long Lstri = L * stri;
       for (long i = 0; i < Lstri; i += stri) p[i] = scalar;
     }
+  } else if constexpr (get_tile_size<self_t> > 0) { // tiled layouts are contiguous, without strides
+    const long L             = size();
+    auto *__restrict const p = data_for_access(*this);
+    for (long i = 0; i < L; ++i) p[i] = scalar;
   } else {
     for (auto &x : *this) x = scalar;
   }
@@ -0,0 +1,559 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <array>
+#include <cmath>
+#include <complex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/*
+ * Streaming statistics of array valued samples, e.g. the measurements of a Monte Carlo.
+ *
+ *   mean_accumulator<T, R>        : mean and variance (Welford)
+ *   log_binning_accumulator<T, R> : errors of the bins of size 1, 2, 4, ..., and the autocorrelation time
+ *   jackknife_accumulator<T, R>   : a fixed number of bins, for the jackknife of functions of the means (cf jackknife)
+ *
+ * The shape of the samples is given at construction, and acc << x adds the sample x (any Array of this shape) :
+ * it updates the accumulator in place, without allocation.
+ *
+ * Each thread can fill its own accumulator, and a.merge(b) adds the samples of b to a.
+ * The accumulators of the MPI nodes are merged by mpi_merge (nda/mpi.hpp), and saved by h5_write (nda/h5.hpp).
+ * T is a real or complex type. The variances and the errors are real : for complex T, they are the ones of |x - mean|.
+ */
+
+namespace nda {
+
+  namespace accumulator_details {
+
+    // Re(conj(a) * b)
+    template <typename T>
+    auto real_dot(T const &a, T const &b) {
+      if constexpr (is_complex_v<T>)
+        return a.real() * b.real() + a.imag() * b.imag();
+      else
+        return a * b;
+    }
+
+    // Calls f(k, x_k) on the elements of x, in C order
+    template <Array A, typename F>
+    FORCEINLINE void for_each_flat(A const &x, F &&f) {
+      if constexpr (MemoryArray<A>) {
+        if (A::layout_t::is_stride_order_C() and x.is_contiguous()) {
+          auto const *p = x.data();
+          for (long k = 0; k < x.size(); ++k) f(k, p[k]);
+          return;
+        }
+      }
+      long k = 0;
+      nda::for_each(x.shape(), [&](auto... i) { f(k++, x(i...)); });
+    }
+
+    // Welford update of the element k of (n, mean, m2) with the sample x : n is the count after the update
+    template <typename T, typename R>
+    FORCEINLINE void welford_add(long n, T *__restrict mean, R *__restrict m2, long k, T const &x) {
+      T d = x - mean[k];
+      mean[k] += d / R(n);
+      m2[k] += real_dot(d, x - mean[k]);
+    }
+
+    // Merges (nb, mean_b, m2_b) into (na, mean_a, m2_a), both of size s (Chan et al.)
+    template <typename T, typename R>
+    void welford_merge(long na, T *__restrict mean_a, R *__restrict m2_a, long nb, T const *mean_b, R const *m2_b, long s) {
+      if (nb == 0) return;
+      R wb = R(nb) / R(na + nb), wab = R(na) * wb;
+      for (long k = 0; k < s; ++k) {
+        T d = mean_b[k] - mean_a[k];
+        mean_a[k] += d * wb;
+        m2_a[k] += m2_b[k] + real_dot(d, d) * wab;
+      }
+    }
+
+    // sqrt(m2 / (n (n - 1))), the standard error of the mean of n uncorrelated samples
+    template <MemoryArray V>
+    auto error(long n, V const &m2) {
+      using R = std::remove_const_t<get_value_t<V>>;
+      array<R, get_rank<V>> r(m2.shape());
+      for_each_flat(m2, [&](long k, R x) { r.data()[k] = (n > 1 ? std::sqrt(x / (R(n) * R(n - 1))) : R(0)); });
+      return r;
+    }
+
+    // Halves the number of bins of (bins, n_full, n_partial, bin_size), by adding them by pairs.
+    // If n_full is odd, the last complete bin goes in the incomplete one. The first dimension of bins is the bin.
+    template <typename T, int Rank>
+    void rebin(array<T, Rank> &bins, long &n_full, long &n_partial, long &bin_size) {
+      long s = bins.size() / bins.extent(0);
+      T *b   = bins.data();
+      for (long i = 0; i < n_full / 2; ++i)
+        for (long k = 0; k < s; ++k) b[i * s + k] = b[2 * i * s + k] + b[(2 * i + 1) * s + k];
+      long p    = n_full / 2; // the new incomplete bin
+      bool full = (n_full == bins.extent(0)); // then there is no incomplete bin
+      for (long k = 0; k < s; ++k) b[p * s + k] = (n_full % 2 ? b[(n_full - 1) * s + k] : T{}) + (full ? T{} : b[n_full * s + k]);
+      for (long k = (p + 1) * s; k < (full ? n_full : n_full + 1) * s; ++k) b[k] = T{};
+      n_partial += (n_full % 2 ? bin_size : 0);
+      n_full = p;
+      bin_size *= 2;
+    }
+
+    // The sum of the first n bins of a jackknife accumulator
+    template <typename A>
+    auto sum_of_bins(A const &acc, long n) {
+      array<typename A::value_type, std::tuple_size_v<std::decay_t<decltype(acc.shape())>>> r(acc.shape());
+      r() = typename A::value_type{};
+      for (long b = 0; b < n; ++b) r += acc.bins()(b, ellipsis{});
+      return r;
+    }
+
+    // (total - the bin b) * w, or total * w for b = -1
+    template <typename V, typename A>
+    V mean_without_bin(V const &total, A const &acc, long b, double w) {
+      V r = total;
+      if (b >= 0) r -= acc.bins()(b, ellipsis{});
+      r *= w;
+      return r;
+    }
+
+  } // namespace accumulator_details
+
+  // ----------------  mean and variance -------------------------
+
+  /**
+   * Mean and variance of array valued samples, with the Welford algorithm (numerically stable, one pass).
+   *
+   *    mean_accumulator<double, 2> acc({n, m});
+   *    for (...) acc << g;
+   *    acc.mean(), acc.error();
+   *
+   * @tparam T The value type of the samples
+   * @tparam R The rank of the samples
+   */
+  template <typename T, int R>
+  class mean_accumulator {
+    public:
+    using value_type = T;
+    using real_t     = decltype(std::real(T{}));
+
+    private:
+    long _n = 0;
+    array<T, R> _mean;
+    array<real_t, R> _m2; // sum of |x - mean|^2
+
+    public:
+    mean_accumulator() = default;
+
+    /// An empty accumulator for samples of the given shape
+    explicit mean_accumulator(std::array<long, R> const &shape) : _mean(shape), _m2(shape) { reset(); }
+
+    /// Construct from the count, the mean and the sum of the squared deviations m2
+    mean_accumulator(long n, array<T, R> mean, array<real_t, R> m2) : _n(n), _mean(std::move(mean)), _m2(std::move(m2)) {
+      EXPECTS(_mean.shape() == _m2.shape());
+    }
+
+    /// Removes all the samples
+    void reset() {
+      _n      = 0;
+      _mean() = T{};
+      _m2()   = 0;
+    }
+
+    /// Adds the sample x
+    template <Array A>
+    mean_accumulator &operator<<(A const &x) {
+      EXPECTS(x.shape() == _mean.shape());
+      ++_n;
+      T *mean    = _mean.data();
+      real_t *m2 = _m2.data();
+      accumulator_details::for_each_flat(x, [&](long k, auto const &v) { accumulator_details::welford_add(_n, mean, m2, k, T(v)); });
+      return *this;
+    }
+
+    /// Adds the samples of a
+    void merge(mean_accumulator const &a) {
+      EXPECTS(a.shape() == shape());
+      accumulator_details::welford_merge(_n, _mean.data(), _m2.data(), a._n, a._mean.data(), a._m2.data(), _mean.size());
+      _n += a._n;
+    }
+
+    /// The shape of the samples
+    [[nodiscard]] auto const &shape() const { return _mean.shape(); }
+
+    /// The number of samples
+    [[nodiscard]] long count() const { return _n; }
+
+    /// The mean of the samples
+    [[nodiscard]] array<T, R> const &mean() const { return _mean; }
+
+    /// The sum of |x - mean|^2 over the samples
+    [[nodiscard]] array<real_t, R> const &m2() const { return _m2; }
+
+    /// The (unbiased) variance of the samples
+    [[nodiscard]] array<real_t, R> variance() const {
+      array<real_t, R> r = _m2;
+      if (_n > 1)
+        r /= real_t(_n - 1);
+      else
+        r() = 0;
+      return r;
+    }
+
+    /// The error of the mean, for uncorrelated samples
+    [[nodiscard]] array<real_t, R> error() const { return accumulator_details::error(_n, _m2); }
+  };
+
+  // ----------------  logarithmic binning -------------------------
+
+  /**
+   * Errors of the mean of correlated samples, by logarithmic binning.
+   *
+   * The level l is the series of the means of 2^l consecutive samples (the bins), and error(l) the error of its mean
+   * for uncorrelated bins. It increases with l and saturates, when the bins are larger than the autocorrelation time,
+   * at the true error of the mean. autocorrelation_time(l) = (error(l)^2 / error(0)^2 - 1) / 2 is the integrated
+   * autocorrelation time estimated at the level l.
+   *
+   * Each sample updates 2 levels on average. The error and the autocorrelation time are given at the largest level with
+   * at least min_bins bins (error_at_level, autocorrelation_time_at_level) : too few bins give a noisy error.
+   *
+   * @tparam T The value type of the samples
+   * @tparam R The rank of the samples
+   */
+  template <typename T, int R>
+  class log_binning_accumulator {
+    public:
+    using value_type = T;
+    using real_t     = decltype(std::real(T{}));
+
+    private:
+    long _n_samples = 0;   // samples added by operator<<, which sets the incomplete bins
+    array<long, 1> _count; // [l] : number of bins of the level l
+    array<T, R + 1> _mean; // [l, ...] : mean of the bins of the level l
+    array<real_t, R + 1> _m2;
+    array<T, R + 1> _pending; // [l, ...] : the first bin of an incomplete pair of the level l
+    long _s = 0;              // size of a sample
+
+    public:
+    log_binning_accumulator() = default;
+
+    /**
+     * An empty accumulator for samples of the given shape
+     *
+     * @param shape The shape of the samples
+     * @param n_levels The number of levels : the largest bins have 2^(n_levels - 1) samples
+     */
+    explicit log_binning_accumulator(std::array<long, R> const &shape, int n_levels = 32) {
+      auto sh = stdutil::front_append(shape, long(n_levels));
+      _count.resize(n_levels);
+      _mean.resize(sh);
+      _m2.resize(sh);
+      _pending.resize(sh);
+      _s = _mean.size() / n_levels;
+      reset();
+    }
+
+    /// Construct from the state (cf h5_write)
+    log_binning_accumulator(long n_samples, array<long, 1> count, array<T, R + 1> mean, array<real_t, R + 1> m2, array<T, R + 1> pending)
+       : _n_samples(n_samples), _count(std::move(count)), _mean(std::move(mean)), _m2(std::move(m2)), _pending(std::move(pending)) {
+      EXPECTS(_mean.shape() == _m2.shape() and _mean.shape() == _pending.shape() and _count.size() == _mean.extent(0));
+      _s = (n_levels() > 0 ? _mean.size() / n_levels() : 0);
+    }
+
+    /// Removes all the samples
+    void reset() {
+      _n_samples = 0;
+      _count()   = 0;
+      _mean()    = T{};
+      _m2()      = 0;
+      _pending() = T{};
+    }
+
+    /// Adds the sample x
+    template <Array A>
+    log_binning_accumulator &operator<<(A const &x) {
+      EXPECTS(x.shape() == shape());
+      using accumulator_details::welford_add;
+      long n     = ++_n_samples;
+      T *mean    = _mean.data();
+      real_t *m2 = _m2.data();
+      T *pending = _pending.data();
+
+      // level 0 : x, which is also the first or the second bin of a pair of the level 0
+      long c0    = ++_count[0];
+      bool first = (n & 1);
+      accumulator_details::for_each_flat(x, [&](long k, auto const &v) {
+        T t = T(v);
+        welford_add(c0, mean, m2, k, t);
+        pending[k] = (first ? t : (pending[k] + t) / real_t(2));
+      });
+
+      // a complete pair of the level l - 1 is a bin of the level l. n / 2^l is the number of bins of the level l.
+      for (long l = 1; l < n_levels() and not first; ++l) {
+        first       = ((n >> l) & 1);
+        long c      = ++_count[l];
+        T const *b  = pending + (l - 1) * _s;
+        T *p        = pending + l * _s;
+        T *ml       = mean + l * _s;
+        real_t *m2l = m2 + l * _s;
+        for (long k = 0; k < _s; ++k) {
+          welford_add(c, ml, m2l, k, b[k]);
+          p[k] = (first ? b[k] : (p[k] + b[k]) / real_t(2));
+        }
+      }
+      return *this;
+    }
+
+    /// Adds the bins of a, level by level. The incomplete bins of a are not added.
+    void merge(log_binning_accumulator const &a) {
+      EXPECTS(a.shape() == shape() and a.n_levels() == n_levels());
+      for (long l = 0; l < n_levels(); ++l) {
+        accumulator_details::welford_merge(_count[l], _mean.data() + l * _s, _m2.data() + l * _s, a._count[l], a._mean.data() + l * _s,
+                                           a._m2.data() + l * _s, _s);
+        _count[l] += a._count[l];
+      }
+    }
+
+    /// The shape of the samples
+    [[nodiscard]] std::array<long, R> shape() const { return stdutil::front_pop(_mean.shape()); }
+
+    /// The number of levels
+    [[nodiscard]] long n_levels() const { return _count.size(); }
+
+    /// The number of samples
+    [[nodiscard]] long count() const { return (n_levels() > 0 ? _count[0] : 0); }
+
+    /// The number of bins of the level l
+    [[nodiscard]] long count(long l) const { return _count[l]; }
+
+    /// The mean of the samples
+    [[nodiscard]] auto mean() const { return _mean(0, ellipsis{}); }
+
+    /// The largest level with at least min_bins bins (or 0)
+    [[nodiscard]] long level(long min_bins = 64) const {
+      long l = 0;
+      while (l + 1 < n_levels() and _count[l + 1] >= min_bins) ++l;
+      return l;
+    }
+
+    /// The error of the mean, estimated at the level l
+    [[nodiscard]] array<real_t, R> error(long l) const { return accumulator_details::error(_count[l], _m2(l, ellipsis{})); }
+
+    /// The error of the mean, at level(min_bins)
+    [[nodiscard]] array<real_t, R> error_at_level(long min_bins = 64) const { return error(level(min_bins)); }
+
+    /// The integrated autocorrelation time, estimated at the level l (in number of samples)
+    [[nodiscard]] array<real_t, R> autocorrelation_time(long l) const {
+      auto e0 = error(0), el = error(l);
+      array<real_t, R> r(shape());
+      for (long k = 0; k < r.size(); ++k) {
+        real_t v0 = e0.data()[k] * e0.data()[k], vl = el.data()[k] * el.data()[k];
+        r.data()[k] = (v0 > 0 ? (vl / v0 - 1) / 2 : real_t(0));
+      }
+      return r;
+    }
+
+    /// The integrated autocorrelation time, at level(min_bins)
+    [[nodiscard]] array<real_t, R> autocorrelation_time_at_level(long min_bins = 64) const { return autocorrelation_time(level(min_bins)); }
+
+    // The state (cf h5_write)
+    [[nodiscard]] long n_samples() const { return _n_samples; }
+    [[nodiscard]] array<long, 1> const &counts() const { return _count; }
+    [[nodiscard]] array<T, R + 1> const &means() const { return _mean; }
+    [[nodiscard]] array<real_t, R + 1> const &m2s() const { return _m2; }
+    [[nodiscard]] array<T, R + 1> const &pending() const { return _pending; }
+  };
+
+  // ----------------  jackknife -------------------------
+
+  /**
+   * A fixed number of bins of the samples, for the jackknife.
+   *
+   * The samples are added to the bins in turn, bin_size() samples per bin. When the n_bins bins are complete, they
+   * are added by pairs, and the bin size is doubled : the memory is fixed, and the cost per sample is constant.
+   * The last bin is incomplete in general, and not used by the jackknife.
+   *
+   * merge adds the complete bins of a, after binning both accumulators to the same bin size :
+   * the samples of the incomplete bin of a (less than one bin) are not added.
+   *
+   * @tparam T The value type of the samples
+   * @tparam R The rank of the samples
+   */
+  template <typename T, int R>
+  class jackknife_accumulator {
+    public:
+    using value_type = T;
+    using real_t     = decltype(std::real(T{}));
+
+    private:
+    array<T, R + 1> _bins; // [b, ...] : sum of the samples of the bin b. The bins n_full + 1, ... are zero.
+    long _n_full    = 0;   // number of complete bins
+    long _n_partial = 0;   // number of samples in the bin n_full
+    long _bin_size  = 1;
+    long _s         = 0; // size of a sample
+
+    public:
+    jackknife_accumulator() = default;
+
+    /**
+     * An empty accumulator for samples of the given shape
+     *
+     * @param shape The shape of the samples
+     * @param n_bins The number of bins (even)
+     */
+    explicit jackknife_accumulator(std::array<long, R> const &shape, long n_bins = 128) : _bins(stdutil::front_append(shape, n_bins)) {
+      EXPECTS(n_bins >= 2 and n_bins % 2 == 0);
+      _s = _bins.size() / n_bins;
+      reset();
+    }
+
+    /// Construct from the state (cf h5_write)
+    jackknife_accumulator(array<T, R + 1> bins, long n_full, long n_partial, long bin_size)
+       : _bins(std::move(bins)), _n_full(n_full), _n_partial(n_partial), _bin_size(bin_size) {
+      EXPECTS(n_bins() >= 2 and n_bins() % 2 == 0 and n_full < n_bins() and n_partial < bin_size);
+      _s = _bins.size() / n_bins();
+    }
+
+    /// Removes all the samples
+    void reset() {
+      _bins()    = T{};
+      _n_full    = 0;
+      _n_partial = 0;
+      _bin_size  = 1;
+    }
+
+    /// Adds the sample x
+    template <Array A>
+    jackknife_accumulator &operator<<(A const &x) {
+      EXPECTS(x.shape() == shape());
+      T *b = _bins.data() + _n_full * _s;
+      accumulator_details::for_each_flat(x, [b](long k, auto const &v) { b[k] += T(v); });
+      if (++_n_partial == _bin_size) {
+        _n_partial = 0;
+        if (++_n_full == n_bins()) accumulator_details::rebin(_bins, _n_full, _n_partial, _bin_size);
+      }
+      return *this;
+    }
+
+    /// Adds the complete bins of a
+    void merge(jackknife_accumulator const &a) {
+      EXPECTS(a.shape() == shape() and a.n_bins() == n_bins());
+      auto b = a;
+      while (b._bin_size < _bin_size) accumulator_details::rebin(b._bins, b._n_full, b._n_partial, b._bin_size);
+      while (_bin_size < b._bin_size) accumulator_details::rebin(_bins, _n_full, _n_partial, _bin_size);
+      add_bins(b._bins(range(0, b._n_full), ellipsis{}));
+    }
+
+    /// Adds complete bins (of bin_size() samples), stored as [b, ...]
+    template <typename V>
+    void add_bins(V const &bins) {
+      long n = bins.extent(0);
+      if (_n_full + n < n_bins()) { // they fit : the incomplete bin is moved after them
+        _bins(_n_full + n, ellipsis{}) = _bins(_n_full, ellipsis{});
+        _bins(range(_n_full, _n_full + n), ellipsis{}) = bins;
+        _n_full += n;
+        return;
+      }
+      auto sh = _bins.shape();
+      sh[0]   = _n_full + n + 1;
+      array<T, R + 1> all(sh);
+      all(range(0, _n_full), ellipsis{})           = _bins(range(0, _n_full), ellipsis{});
+      all(range(_n_full, _n_full + n), ellipsis{}) = bins;
+      all(_n_full + n, ellipsis{})                 = _bins(_n_full, ellipsis{});
+      long n_full = _n_full + n;
+      while (n_full >= n_bins()) accumulator_details::rebin(all, n_full, _n_partial, _bin_size);
+      _bins()                                 = T{};
+      _bins(range(0, n_full + 1), ellipsis{}) = all(range(0, n_full + 1), ellipsis{});
+      _n_full                                 = n_full;
+    }
+
+    /// The shape of the samples
+    [[nodiscard]] std::array<long, R> shape() const { return stdutil::front_pop(_bins.shape()); }
+
+    /// The maximal number of bins
+    [[nodiscard]] long n_bins() const { return _bins.extent(0); }
+
+    /// The number of complete bins
+    [[nodiscard]] long n_full_bins() const { return _n_full; }
+
+    /// The number of samples per bin
+    [[nodiscard]] long bin_size() const { return _bin_size; }
+
+    /// The number of samples in the incomplete bin
+    [[nodiscard]] long n_partial() const { return _n_partial; }
+
+    /// The number of samples
+    [[nodiscard]] long count() const { return _n_full * _bin_size + _n_partial; }
+
+    /// The sums of the samples of the bins, [b, ...]. Only the first n_full_bins() bins are complete.
+    [[nodiscard]] array<T, R + 1> const &bins() const { return _bins; }
+
+    /// The mean of the samples of the complete bins
+    [[nodiscard]] array<T, R> mean() const {
+      array<T, R> r(shape());
+      r() = T{};
+      for (long b = 0; b < _n_full; ++b) r += _bins(b, ellipsis{});
+      if (_n_full > 0) r /= real_t(_n_full * _bin_size);
+      return r;
+    }
+  };
+
+  /**
+   * Jackknife estimate of f(<x1>, <x2>, ...), where <xi> is the mean of the samples of the accumulator acc_i.
+   *
+   * The accumulators must have been filled together (the same number of samples, at the same time),
+   * so that their bins are the ones of the same samples.
+   *
+   *    auto [value, error] = jackknife([](auto const &g, auto const &z) { return g / z; }, acc_g, acc_z);
+   *
+   * @param f A function of the means, which returns a scalar or an Array
+   * @return The bias corrected value, and its error
+   */
+  template <typename F, typename... T, int... R>
+  auto jackknife(F f, jackknife_accumulator<T, R> const &...acc) {
+    static_assert(sizeof...(acc) > 0, "jackknife : no accumulator");
+    auto const &a0 = std::get<0>(std::tie(acc...));
+    long n         = a0.n_full_bins(), bs = a0.bin_size();
+    if (((acc.n_full_bins() != n or acc.bin_size() != bs) or ...)) NDA_RUNTIME_ERROR << "jackknife : the accumulators do not have the same bins";
+    if (n < 2) NDA_RUNTIME_ERROR << "jackknife : at least 2 complete bins are needed, there are " << n;
+
+    // the sums of the complete bins
+    auto accs   = std::tie(acc...);
+    auto totals = std::make_tuple(accumulator_details::sum_of_bins(acc, n)...);
+
+    // f of the means without the bin b, or of all the means for b = -1
+    auto f_without = [&]<size_t... Is>(long b, std::index_sequence<Is...>) {
+      double w = 1.0 / double((b < 0 ? n : n - 1) * bs);
+      return make_regular(f(accumulator_details::mean_without_bin(std::get<Is>(totals), std::get<Is>(accs), b, w)...));
+    };
+    auto f_without_bin = [&](long b) { return f_without(b, std::index_sequence_for<T...>{}); };
+
+    using nda::abs2;
+    using std::sqrt;
+    using U    = decltype(f_without_bin(0));
+    auto f_all = f_without_bin(-1);
+    std::vector<U> f_b;
+    f_b.reserve(n);
+    for (long b = 0; b < n; ++b) f_b.push_back(f_without_bin(b));
+
+    U f_mean = f_b[0];
+    for (long b = 1; b < n; ++b) f_mean = f_mean + f_b[b];
+    f_mean = make_regular(f_mean / double(n));
+    auto var = make_regular(abs2(make_regular(f_b[0] - f_mean)));
+    for (long b = 1; b < n; ++b) var = make_regular(var + abs2(make_regular(f_b[b] - f_mean)));
+
+    U value    = make_regular(double(n) * f_all - double(n - 1) * f_mean);
+    auto error = make_regular(sqrt(make_regular(var * (double(n - 1) / double(n)))));
+    return std::make_pair(std::move(value), std::move(error));
+  }
+
+} // namespace nda
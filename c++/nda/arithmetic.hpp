@@ -190,6 +190,9 @@ namespace nda {
   template <Array L, Array R>
   Array auto operator+(L &&l, R &&r) {
     static_assert(get_rank<L> == get_rank<R>, "Rank mismatch in array addition");
+#if defined(NDA_ENFORCE_BOUNDCHECK) or defined(NDA_BOUNDCHECK_HOISTED)
+    if (l.shape() != r.shape()) NDA_RUNTIME_ERROR << "Array addition : shape mismatch " << l.shape() << " " << r.shape();
+#endif
     return expr<'+', L, R>{std::forward<L>(l), std::forward<R>(r)};
   }
 
@@ -210,6 +213,9 @@ namespace nda {
   template <Array L, Array R>
   Array auto operator-(L &&l, R &&r) {
     static_assert(get_rank<L> == get_rank<R>, "Rank mismatch in array substract");
+#if defined(NDA_ENFORCE_BOUNDCHECK) or defined(NDA_BOUNDCHECK_HOISTED)
+    if (l.shape() != r.shape()) NDA_RUNTIME_ERROR << "Array subtraction : shape mismatch " << l.shape() << " " << r.shape();
+#endif
     return expr<'-', L, R>{std::forward<L>(l), std::forward<R>(r)};
   }
 
@@ -237,7 +243,7 @@ namespace nda {
     if constexpr (l_algebra == 'A') {
       static_assert(r_algebra == 'A', "Error Try to multiply array * matrix or vector");
       static_assert(get_rank<L> == get_rank<R>, "Rank mismatch in array multiply");
-#ifdef NDA_ENFORCE_BOUNDCHECK
+#if defined(NDA_ENFORCE_BOUNDCHECK) or defined(NDA_BOUNDCHECK_HOISTED)
       if (l.shape() != r.shape()) NDA_RUNTIME_ERROR << "Matrix product : dimension mismatch in matrix product " << l.shape() << " " << r.shape();
 #endif
       return expr<'*', L, R>{std::forward<L>(l), std::forward<R>(r)};
@@ -280,7 +286,7 @@ namespace nda {
     if constexpr (l_algebra == 'A') {
       static_assert(r_algebra == 'A', "Error Try to multiply array * matrix or vector");
       static_assert(get_rank<L> == get_rank<R>, "Rank mismatch in array multiply");
-#ifdef NDA_ENFORCE_BOUNDCHECK
+#if defined(NDA_ENFORCE_BOUNDCHECK) or defined(NDA_BOUNDCHECK_HOISTED)
       if (l.shape() != r.shape()) NDA_RUNTIME_ERROR << "Matrix product : dimension mismatch in matrix product " << l.shape() << " " << r.shape();
 #endif
       return expr<'/', L, R>{std::forward<L>(l), std::forward<R>(r)};
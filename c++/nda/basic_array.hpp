@@ -66,7 +66,7 @@ namespace nda {
     static constexpr int rank = Rank;
 
     private:
-    layout_t lay;
+    [[no_unique_address]] layout_t lay; // empty for a fully static layout
     storage_t sto;
 
     template <typename U, int R, typename L, char A, typename C, typename NewLayoutType>
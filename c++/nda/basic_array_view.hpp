@@ -66,7 +66,7 @@ namespace nda {
     static constexpr int rank = Rank;
 
     private:
-    layout_t lay;
+    [[no_unique_address]] layout_t lay; // empty for a fully static layout
     storage_t sto;
 
     template <typename T, int R, typename L, char A, typename CP>
@@ -111,6 +111,11 @@ namespace nda {
     explicit(requires_runtime_check<L>)
     basic_array_view(basic_array<ValueType, Rank, L, A, CP> const &a) noexcept : basic_array_view(layout_t{a.indexmap()}, a.storage()) {}
 
+    /// From a copy-on-write array. Its storage is made unique and unshareable first (cf mem::handle_cow)
+    template <typename L, char A>
+    explicit(requires_runtime_check<L>)
+    basic_array_view(basic_array<ValueType, Rank, L, A, cow> &a) : basic_array_view(layout_t{a.indexmap()}, a.storage()) {}
+
     ///
     template <typename L, char A, typename AP, typename OP>
     explicit(requires_runtime_check<L>)
@@ -163,7 +168,7 @@ namespace nda {
 
     /// Same as the general case
     /// [C++ oddity : this case must be explicitly coded too]
-    basic_array_view &operator=(basic_array_view const &rhs) noexcept {
+    basic_array_view &operator=(basic_array_view const &rhs) noexcept(has_no_boundcheck) {
       assign_from_ndarray(rhs);
       return *this;
     }
@@ -175,13 +180,13 @@ namespace nda {
      *
      * The dimension of RHS must be large enough or behaviour is undefined.
      * 
-     * If NDA_BOUNDCHECK is defined, the bounds are checked.
+     * If NDA_ENFORCE_BOUNDCHECK or NDA_BOUNDCHECK_HOISTED is defined, the shapes are checked.
      *
      * @tparam RHS A scalar or an object modeling the concept NDArray
      * @param rhs Right hand side of the = operation
      */
     template <ArrayOfRank<Rank> RHS>
-    basic_array_view &operator=(RHS const &rhs) noexcept  {
+    basic_array_view &operator=(RHS const &rhs) noexcept(has_no_boundcheck) {
       // in C20 I use the concept refinement here, in 17 I have to exclude the  alternaticve
       static_assert(!is_const, "Cannot assign to a const !");
       assign_from_ndarray(rhs); // common code with view, private
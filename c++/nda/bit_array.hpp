@@ -0,0 +1,323 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <tuple>
+
+namespace nda {
+
+  /**
+   * A boolean array packed in bits : 64 elements per 64 bits word, instead of one byte per element for array<bool, Rank>.
+   *
+   * The element of linear index l (in C order) is the bit l % 64 of the word l / 64.
+   * The logical operations (&, |, ^, ~) work on whole words, count(), any() and all() use popcount.
+   * It is an Array (of bool), so it can be read by any nda algorithm, or converted to an array<bool, Rank>.
+   *
+   *    bit_array<2> m(a, [](double x) { return x > 0; });    // the mask of a > 0, packed on the fly
+   *    long n = count(m);
+   *    masked_assign(b, m, 0);                                // b(i, j) = 0 where a(i, j) > 0
+   *    auto v = masked_select(a, m);                          // the elements of a > 0, in C order
+   *
+   * @tparam Rank The rank
+   */
+  template <int Rank>
+  class bit_array {
+    public:
+    using word_t                        = std::uint64_t;
+    static constexpr long bits_per_word = 64;
+
+    private:
+    std::array<long, Rank> _shape = {};
+    long _size                    = 0;
+    array<word_t, 1> _w; // Invariant : the bits of the last word beyond size() are 0
+
+    static long n_words_for(long size) { return (size + bits_per_word - 1) / bits_per_word; }
+
+    // Mask of the valid bits of the last word
+    [[nodiscard]] word_t last_word_mask() const noexcept {
+      long r = _size % bits_per_word;
+      return (r == 0 ? ~word_t{0} : (word_t{1} << r) - 1);
+    }
+
+    template <typename... Int>
+    [[nodiscard]] long linear_index(Int... is) const noexcept {
+      static_assert(sizeof...(Int) == Rank, "bit_array : incorrect number of indices");
+      std::array<long, Rank> idx{long(is)...};
+      long l = 0;
+      for (int r = 0; r < Rank; ++r) {
+        EXPECTS(0 <= idx[r] and idx[r] < _shape[r]);
+        l = l * _shape[r] + idx[r];
+      }
+      return l;
+    }
+
+    public:
+    using value_type          = bool;
+    static constexpr int rank = Rank;
+
+    bit_array() = default;
+
+    /// Construct with a given shape, all elements are false
+    explicit bit_array(std::array<long, Rank> const &shape) : _shape(shape), _size(1) {
+      for (auto n : shape) _size *= n;
+      _w = array<word_t, 1>(n_words_for(_size));
+      _w = 0;
+    }
+
+    /// Construct with a given shape, all elements are false
+    template <std::integral... Int>
+    explicit bit_array(Int... is) requires(sizeof...(Int) == Rank) : bit_array(std::array<long, Rank>{long(is)...}) {}
+
+    /// The mask of pred(a(i, j, ...)), packed on the fly (no intermediate array of bool)
+    template <ArrayOfRank<Rank> A, typename F>
+    bit_array(A const &a, F pred) : bit_array(a.shape()) {
+      word_t *__restrict w = _w.data();
+      if constexpr (MemoryArray<A>) {
+        if (a.indexmap().is_contiguous() and A::is_stride_order_C()) { // 64 elements at a time
+          auto const *__restrict p = a.data();
+          for (long k = 0; k < _w.size(); ++k) {
+            long b   = k * bits_per_word;
+            long e   = std::min(b + bits_per_word, _size);
+            word_t x = 0;
+            for (long l = b; l < e; ++l) x |= word_t(bool(pred(p[l]))) << (l - b);
+            w[k] = x;
+          }
+          return;
+        }
+      }
+      long l = 0;
+      nda::for_each(a.shape(), [&](auto const &...is) {
+        w[l / bits_per_word] |= word_t(bool(pred(a(is...)))) << (l % bits_per_word);
+        ++l;
+      });
+    }
+
+    /// From any Array whose elements are convertible to bool (e.g. an array<bool, Rank>)
+    template <ArrayOfRank<Rank> A>
+    explicit bit_array(A const &a) : bit_array(a, [](auto const &x) { return bool(x); }) {}
+
+    // ------------------ Accessors ------------------
+
+    [[nodiscard]] std::array<long, Rank> const &shape() const noexcept { return _shape; }
+
+    [[nodiscard]] long size() const noexcept { return _size; }
+
+    /// The packed words (the bits beyond size() in the last word are 0)
+    [[nodiscard]] array<word_t, 1> const &words() const noexcept { return _w; }
+
+    /// Element (i, j, ...)
+    template <std::convertible_to<long>... Int>
+    [[nodiscard]] bool operator()(Int... is) const noexcept {
+      long l = linear_index(is...);
+      return (_w[l / bits_per_word] >> (l % bits_per_word)) & 1;
+    }
+
+    /// Element of linear index l (C order)
+    [[nodiscard]] bool test(long l) const noexcept {
+      EXPECTS(0 <= l and l < _size);
+      return (_w[l / bits_per_word] >> (l % bits_per_word)) & 1;
+    }
+
+    /// Sets the element (i, j, ...) to true
+    template <std::convertible_to<long>... Int>
+    void set(Int... is) noexcept {
+      long l = linear_index(is...);
+      _w[l / bits_per_word] |= word_t{1} << (l % bits_per_word);
+    }
+
+    /// Sets the element (i, j, ...) to false
+    template <std::convertible_to<long>... Int>
+    void reset(Int... is) noexcept {
+      long l = linear_index(is...);
+      _w[l / bits_per_word] &= ~(word_t{1} << (l % bits_per_word));
+    }
+
+    /// Flips the element (i, j, ...)
+    template <std::convertible_to<long>... Int>
+    void flip(Int... is) noexcept {
+      long l = linear_index(is...);
+      _w[l / bits_per_word] ^= word_t{1} << (l % bits_per_word);
+    }
+
+    /// Sets all elements to x
+    void fill(bool x) noexcept {
+      if (_w.size() == 0) return;
+      _w = (x ? ~word_t{0} : word_t{0});
+      _w[_w.size() - 1] &= last_word_mask();
+    }
+
+    // ------------------ Reductions ------------------
+
+    /// Number of true elements
+    [[nodiscard]] long count() const noexcept {
+      long r = 0;
+      for (auto x : _w) r += std::popcount(x);
+      return r;
+    }
+
+    /// Is any element true ?
+    [[nodiscard]] bool any() const noexcept {
+      for (auto x : _w)
+        if (x != 0) return true;
+      return false;
+    }
+
+    /// Are all elements true ?
+    [[nodiscard]] bool all() const noexcept {
+      long n = _w.size();
+      for (long k = 0; k + 1 < n; ++k)
+        if (_w[k] != ~word_t{0}) return false;
+      return (n == 0) or (_w[n - 1] == last_word_mask());
+    }
+
+    /// Calls f(l) for the linear index l (C order) of each true element, in increasing order
+    template <typename F>
+    void for_each_set(F f) const {
+      for (long k = 0; k < _w.size(); ++k) {
+        for (word_t x = _w[k]; x != 0; x &= x - 1) f(k * bits_per_word + std::countr_zero(x));
+      }
+    }
+
+    // ------------------ Logical operations, word by word ------------------
+
+    bit_array &operator&=(bit_array const &m) noexcept {
+      EXPECTS(_shape == m._shape);
+      for (long k = 0; k < _w.size(); ++k) _w[k] &= m._w[k];
+      return *this;
+    }
+
+    bit_array &operator|=(bit_array const &m) noexcept {
+      EXPECTS(_shape == m._shape);
+      for (long k = 0; k < _w.size(); ++k) _w[k] |= m._w[k];
+      return *this;
+    }
+
+    bit_array &operator^=(bit_array const &m) noexcept {
+      EXPECTS(_shape == m._shape);
+      for (long k = 0; k < _w.size(); ++k) _w[k] ^= m._w[k];
+      return *this;
+    }
+
+    friend bit_array operator&(bit_array x, bit_array const &y) { return x &= y; }
+    friend bit_array operator|(bit_array x, bit_array const &y) { return x |= y; }
+    friend bit_array operator^(bit_array x, bit_array const &y) { return x ^= y; }
+
+    /// Logical not
+    friend bit_array operator~(bit_array x) {
+      for (long k = 0; k < x._w.size(); ++k) x._w[k] = ~x._w[k];
+      if (x._w.size() > 0) x._w[x._w.size() - 1] &= x.last_word_mask();
+      return x;
+    }
+
+    bool operator==(bit_array const &m) const {
+      if (_shape != m._shape) return false;
+      for (long k = 0; k < _w.size(); ++k)
+        if (_w[k] != m._w[k]) return false;
+      return true;
+    }
+  };
+
+  template <Array A, typename F>
+  bit_array(A const &, F) -> bit_array<get_rank<A>>;
+
+  // --------------- Reductions -----------------------
+
+  /// Number of true elements
+  template <int R>
+  long count(bit_array<R> const &m) {
+    return m.count();
+  }
+
+  /// Returns true iif at least one element is true
+  template <int R>
+  bool any(bit_array<R> const &m) {
+    return m.any();
+  }
+
+  /// Returns true iif all elements are true
+  template <int R>
+  bool all(bit_array<R> const &m) {
+    return m.all();
+  }
+
+  // --------------- Masked assignment and selection -----------------------
+
+  namespace details {
+
+    // The multi-index of the linear index l, in C order
+    template <int R>
+    std::array<long, R> unravel_index(long l, std::array<long, R> const &shape) {
+      std::array<long, R> idx;
+      for (int r = R - 1; r >= 0; --r) {
+        idx[r] = l % shape[r];
+        l /= shape[r];
+      }
+      return idx;
+    }
+
+    // Calls f(l, idx...) for each element set in the mask, with l its linear index
+    template <int R, typename F>
+    void for_each_masked(bit_array<R> const &mask, F f) {
+      mask.for_each_set([&](long l) { std::apply([&](auto... is) { f(l, is...); }, unravel_index<R>(l, mask.shape())); });
+    }
+
+    template <typename A>
+    bool is_c_contiguous(A const &a) {
+      if constexpr (MemoryArray<A>)
+        return a.indexmap().is_contiguous() and A::is_stride_order_C();
+      else
+        return false;
+    }
+
+  } // namespace details
+
+  /**
+   * a(i, j, ...) = rhs(i, j, ...) (or rhs if it is a scalar), where mask(i, j, ...) is true.
+   * The loop skips the words of the mask which are 0.
+   */
+  template <typename A, int R, typename RHS>
+  void masked_assign(A &&a, bit_array<R> const &mask, RHS const &rhs) requires(MemoryArrayOfRank<std::decay_t<A>, R>) {
+    EXPECTS(a.shape() == mask.shape());
+    if constexpr (Array<RHS>) {
+      EXPECTS(rhs.shape() == mask.shape());
+      details::for_each_masked(mask, [&](long, auto... is) { a(is...) = rhs(is...); });
+    } else {
+      if (details::is_c_contiguous(a)) {
+        auto *p = a.data();
+        mask.for_each_set([p, &rhs](long l) { p[l] = rhs; });
+      } else {
+        details::for_each_masked(mask, [&](long, auto... is) { a(is...) = rhs; });
+      }
+    }
+  }
+
+  /// The elements of a where mask is true, in C order, as an array of rank 1 (of size count(mask))
+  template <typename A, int R>
+  auto masked_select(A const &a, bit_array<R> const &mask) requires(ArrayOfRank<A, R>) {
+    EXPECTS(a.shape() == mask.shape());
+    array<get_value_t<A>, 1> r(mask.count());
+    long i = 0;
+    if (details::is_c_contiguous(a)) {
+      auto const *p = a.data();
+      mask.for_each_set([&](long l) { r[i++] = p[l]; });
+    } else {
+      details::for_each_masked(mask, [&](long, auto... is) { r[i++] = a(is...); });
+    }
+    return r;
+  }
+
+} // namespace nda
@@ -50,47 +50,61 @@ namespace nda::blas {
   /**
    * Compute c <- alpha a*b + beta * c using BLAS dgemm or zgemm 
    *
+   * a and b can also be conj(M) or dagger(M), with M a matrix in memory.
+   * They are then given to BLAS with the op 'C', without copy, except when BLAS sees M as the operand itself
+   * (e.g. conj(M) with M and c in Fortran order) : M is then conjugated in a copy.
+   *
    * @param c Out parameter. Can be a temporary view (hence the &&).
    *         
    * @Precondition : 
    *       * c has the correct dimension given a, b. 
    *         gemm does not resize the object, 
    */
-  template <MatrixView A, MatrixView B, MatrixView C>
+  template <typename A, typename B, MatrixView C>
 
-  requires(have_same_value_type_v<A, B, C> and is_blas_lapack_v<typename A::value_type>)
+  requires((MatrixView<A> or ConjMatrixView<A>) and (MatrixView<B> or ConjMatrixView<B>) and std::is_same_v<get_value_t<A>, get_value_t<B>>
+           and std::is_same_v<get_value_t<A>, get_value_t<C>> and is_blas_lapack_v<get_value_t<A>>)
 
-  void gemm(typename A::value_type alpha, A const &a, B const &b, typename A::value_type beta, C &&c) {
+  void gemm(get_value_t<A> alpha, A const &a, B const &b, get_value_t<A> beta, C &&c) {
 
     using C_t = std::decay_t<C>;
 
-    EXPECTS(a.extent(1) == b.extent(0));
-    EXPECTS(a.extent(0) == c.extent(0));
-    EXPECTS(b.extent(1) == c.extent(1));
+    // We need to see if C is in Fortran order or C order.
+    // In C order, we compute the transpose of the product, since BLAS is in Fortran order
+    static constexpr bool transposed = C_t::is_stride_order_C();
 
-    // Must be lapack compatible
-    EXPECTS(a.indexmap().min_stride() == 1);
-    EXPECTS(b.indexmap().min_stride() == 1);
-    EXPECTS(c.indexmap().min_stride() == 1);
-
-    // We need to see if C is in Fortran order or C order
-    if constexpr (C_t::is_stride_order_C()) {
-      // C order. We compute the transpose of the product in this case
-      // since BLAS is in Fortran order
-      char trans_a = get_trans(b, true);
-      char trans_b = get_trans(a, true);
-      int m        = (trans_a == 'N' ? get_n_rows(b) : get_n_cols(b));
-      int n        = (trans_b == 'N' ? get_n_cols(a) : get_n_rows(a));
-      int k        = (trans_a == 'N' ? get_n_cols(b) : get_n_rows(b));
-      f77::gemm(trans_a, trans_b, m, n, k, alpha, b.data(), get_ld(b), a.data(), get_ld(a), beta, c.data(), get_ld(c));
+    // conj(M) operands which can not be given to BLAS directly are copied
+    if constexpr (not is_blas_operand<A>(transposed)) {
+      gemm(alpha, make_regular(a), b, beta, std::forward<C>(c));
+    } else if constexpr (not is_blas_operand<B>(transposed)) {
+      gemm(alpha, a, make_regular(b), beta, std::forward<C>(c));
     } else {
-      // C is in fortran or, we compute the product.
-      char trans_a = get_trans(a, false);
-      char trans_b = get_trans(b, false);
-      int m        = (trans_a == 'N' ? get_n_rows(a) : get_n_cols(a));
-      int n        = (trans_b == 'N' ? get_n_cols(b) : get_n_rows(b));
-      int k        = (trans_a == 'N' ? get_n_cols(a) : get_n_rows(a));
-      f77::gemm(trans_a, trans_b, m, n, k, alpha, a.data(), get_ld(a), b.data(), get_ld(b), beta, c.data(), get_ld(c));
+
+      EXPECTS(a.shape()[1] == b.shape()[0]);
+      EXPECTS(a.shape()[0] == c.extent(0));
+      EXPECTS(b.shape()[1] == c.extent(1));
+
+      // Must be lapack compatible
+      EXPECTS(get_array(a).indexmap().min_stride() == 1);
+      EXPECTS(get_array(b).indexmap().min_stride() == 1);
+      EXPECTS(c.indexmap().min_stride() == 1);
+
+      if constexpr (transposed) {
+        char trans_a = get_trans(b, true);
+        char trans_b = get_trans(a, true);
+        int m        = (trans_a == 'N' ? get_n_rows(b) : get_n_cols(b));
+        int n        = (trans_b == 'N' ? get_n_cols(a) : get_n_rows(a));
+        int k        = (trans_a == 'N' ? get_n_cols(b) : get_n_rows(b));
+        f77::gemm(trans_a, trans_b, m, n, k, alpha, get_array(b).data(), get_ld(b), get_array(a).data(), get_ld(a), beta, c.data(), get_ld(c));
+      } else {
+        // C is in fortran or, we compute the product.
+        char trans_a = get_trans(a, false);
+        char trans_b = get_trans(b, false);
+        int m        = (trans_a == 'N' ? get_n_rows(a) : get_n_cols(a));
+        int n        = (trans_b == 'N' ? get_n_cols(b) : get_n_rows(b));
+        int k        = (trans_a == 'N' ? get_n_cols(a) : get_n_rows(a));
+        f77::gemm(trans_a, trans_b, m, n, k, alpha, get_array(a).data(), get_ld(a), get_array(b).data(), get_ld(b), beta, c.data(), get_ld(c));
+      }
     }
   }
 
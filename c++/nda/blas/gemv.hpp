@@ -51,27 +51,39 @@ namespace nda::blas {
    *       * c has the correct dimension given a, b. 
    *         gemm does not resize the object, 
    *
-   *
+   * a can also be conj(M) or dagger(M), with M a matrix in memory. It is given to BLAS with the op 'C' if M is in C order.
+   * If M is in Fortran order, conj(M) b = conj(M conj(b)) : the vectors are conjugated, M is not copied.
    */
   template <typename A, typename B, typename C>
-  void gemv(typename A::value_type alpha, A const &a, B const &b, typename A::value_type beta, C &&c) {
+  void gemv(get_value_t<A> alpha, A const &a, B const &b, get_value_t<A> beta, C &&c) {
+
+    if constexpr (is_conj_expr_v<A>) {
+      static_assert(ConjMatrixView<A>, "gemv: conj(M) requires M to be a matrix, matrix_view, array or array_view of rank 2");
+      if constexpr (not is_blas_operand<A>(false)) {
+        auto bc = make_regular(conj(b));
+        c       = conj(c);
+        gemv(conj(alpha), get_array(a), bc, conj(beta), c);
+        c = conj(c);
+        return;
+      }
+    }
 
     using Out_t = std::decay_t<C>;
     static_assert(is_regular_or_view_v<Out_t>, "gemm: Out must be a matrix, matrix_view, array or array_view of rank 2");
-    static_assert(A::rank == 2, "A must be of rank 2");
+    static_assert(get_rank<A> == 2, "A must be of rank 2");
     static_assert(B::rank == 1, "B must be of rank 1");
     static_assert(Out_t::rank == 1, "C must be of rank 1");
-    static_assert(have_same_element_type_and_it_is_blas_type_v<A, B, Out_t>,
+    static_assert(have_same_element_type_and_it_is_blas_type_v<std::decay_t<decltype(get_array(a))>, B, Out_t>,
                   "Matrices/vectors must have the same element type and it must be double, complex ...");
 
-    EXPECTS(a.extent(1) == b.extent(0));
-    EXPECTS(a.extent(0) == c.extent(0));
+    EXPECTS(a.shape()[1] == b.extent(0));
+    EXPECTS(a.shape()[0] == c.extent(0));
 
     char trans_a = get_trans(a, false);
     int m1       = get_n_rows(a);
     int m2       = get_n_cols(a);
     int lda      = get_ld(a);
-    f77::gemv(trans_a, m1, m2, alpha, a.data(), lda, b.data(), b.indexmap().strides()[0], beta, c.data(), c.indexmap().strides()[0]);
+    f77::gemv(trans_a, m1, m2, alpha, get_array(a).data(), lda, b.data(), b.indexmap().strides()[0], beta, c.data(), c.indexmap().strides()[0]);
   }
 
 } // namespace nda::blas
@@ -15,6 +15,7 @@
 // Authors: Olivier Parcollet, Nils Wentzell
 
 #include "cxx_interface.hpp"
+#include "../../tracing.hpp"
 // Extracted from Reference Lapack (https://github.com/Reference-LAPACK):
 #include "cblas_f77.h"
 
@@ -26,55 +27,86 @@ double F77_ddot(FINT, const double *, FINT, const double *, FINT);
 
 namespace nda::blas::f77 {
 
-  void axpy(int N, double alpha, const double *x, int incx, double *Y, int incy) { F77_daxpy(&N, &alpha, x, &incx, Y, &incy); }
+  // Size in bytes of the n elements of x, for the tracing
+  template <typename T>
+  constexpr double n_bytes(long n, T const *) {
+    return double(n) * sizeof(T);
+  }
+
+  void axpy(int N, double alpha, const double *x, int incx, double *Y, int incy) {
+    NDA_TRACE_REGION("daxpy", "blas", 2.0 * N, n_bytes(3l * N, x));
+    F77_daxpy(&N, &alpha, x, &incx, Y, &incy);
+  }
   void axpy(int N, std::complex<double> alpha, const std::complex<double> *x, int incx, std::complex<double> *Y, int incy) {
+    NDA_TRACE_REGION("zaxpy", "blas", 8.0 * N, n_bytes(3l * N, x));
     F77_zaxpy(&N, reinterpret_cast<const double *>(&alpha), reinterpret_cast<const double *>(x), &incx, reinterpret_cast<double *>(Y), // NOLINT
               &incy);                                                                                                                  // NOLINT
   }
   // No Const In Wrapping!
-  void copy(int N, const double *x, int incx, double *Y, int incy) { F77_dcopy(&N, x, &incx, Y, &incy); }
+  void copy(int N, const double *x, int incx, double *Y, int incy) {
+    NDA_TRACE_REGION("dcopy", "blas", 0, n_bytes(2l * N, x));
+    F77_dcopy(&N, x, &incx, Y, &incy);
+  }
   void copy(int N, const std::complex<double> *x, int incx, std::complex<double> *Y, int incy) {
+    NDA_TRACE_REGION("zcopy", "blas", 0, n_bytes(2l * N, x));
     F77_zcopy(&N, reinterpret_cast<const double *>(x), &incx, reinterpret_cast<double *>(Y), &incy); // NOLINT
   }
 
-  double dot(int M, const double *x, int incx, const double *Y, int incy) { return F77_ddot(&M, x, &incx, Y, &incy); }
+  double dot(int M, const double *x, int incx, const double *Y, int incy) {
+    NDA_TRACE_REGION("ddot", "blas", 2.0 * M, n_bytes(2l * M, x));
+    return F77_ddot(&M, x, &incx, Y, &incy);
+  }
 
   void gemm(char trans_a, char trans_b, int M, int N, int K, double alpha, const double *A, int LDA, const double *B, int LDB, double beta, double *C,
             int LDC) {
+    NDA_TRACE_REGION("dgemm", "blas", 2.0 * M * N * K, n_bytes(long(M) * K + long(K) * N + 2l * M * N, C));
     F77_dgemm(&trans_a, &trans_b, &M, &N, &K, &alpha, A, &LDA, B, &LDB, &beta, C, &LDC);
   }
   void gemm(char trans_a, char trans_b, int M, int N, int K, std::complex<double> alpha, const std::complex<double> *A, int LDA,
             const std::complex<double> *B, int LDB, std::complex<double> beta, std::complex<double> *C, int LDC) {
+    NDA_TRACE_REGION("zgemm", "blas", 8.0 * M * N * K, n_bytes(long(M) * K + long(K) * N + 2l * M * N, C));
     F77_zgemm(&trans_a, &trans_b, &M, &N, &K, reinterpret_cast<const double *>(&alpha), reinterpret_cast<const double *>(A), &LDA,      // NOLINT
               reinterpret_cast<const double *>(B), &LDB, reinterpret_cast<const double *>(&beta), reinterpret_cast<double *>(C), &LDC); // NOLINT
   }
 
   void gemv(char trans, int M, int N, double alpha, const double *A, int &LDA, const double *x, int incx, double beta, double *Y, int incy) {
+    NDA_TRACE_REGION("dgemv", "blas", 2.0 * M * N, n_bytes(long(M) * N + M + N, A));
     F77_dgemv(&trans, &M, &N, &alpha, A, &LDA, x, &incx, &beta, Y, &incy);
   }
   void gemv(char trans, int M, int N, std::complex<double> alpha, const std::complex<double> *A, int &LDA, const std::complex<double> *x, int incx,
             std::complex<double> beta, std::complex<double> *Y, int incy) {
+    NDA_TRACE_REGION("zgemv", "blas", 8.0 * M * N, n_bytes(long(M) * N + M + N, A));
     F77_zgemv(&trans, &M, &N, reinterpret_cast<const double *>(&alpha), reinterpret_cast<const double *>(A), &LDA,                        // NOLINT
               reinterpret_cast<const double *>(x), &incx, reinterpret_cast<const double *>(&beta), reinterpret_cast<double *>(Y), &incy); // NOLINT
   }
 
   void ger(int M, int N, double alpha, const double *x, int incx, const double *Y, int incy, double *A, int LDA) {
+    NDA_TRACE_REGION("dger", "blas", 2.0 * M * N, n_bytes(2l * M * N + M + N, A));
     F77_dger(&M, &N, &alpha, x, &incx, Y, &incy, A, &LDA);
   }
   void ger(int M, int N, std::complex<double> alpha, const std::complex<double> *x, int incx, const std::complex<double> *Y, int incy,
            std::complex<double> *A, int LDA) {
+    NDA_TRACE_REGION("zgeru", "blas", 8.0 * M * N, n_bytes(2l * M * N + M + N, A));
     F77_zgeru(&M, &N, reinterpret_cast<const double *>(&alpha), reinterpret_cast<const double *>(x), &incx, // NOLINT
               reinterpret_cast<const double *>(Y),                                                          // NOLINT
               &incy, reinterpret_cast<double *>(A), &LDA);                                                  // NOLINT
   }
 
-  void scal(int M, double alpha, double *x, int incx) { F77_dscal(&M, &alpha, x, &incx); }
+  void scal(int M, double alpha, double *x, int incx) {
+    NDA_TRACE_REGION("dscal", "blas", M, n_bytes(2l * M, x));
+    F77_dscal(&M, &alpha, x, &incx);
+  }
   void scal(int M, std::complex<double> alpha, std::complex<double> *x, int incx) {
+    NDA_TRACE_REGION("zscal", "blas", 6.0 * M, n_bytes(2l * M, x));
     F77_zscal(&M, reinterpret_cast<const double *>(&alpha), reinterpret_cast<double *>(x), &incx); // NOLINT
   }
 
-  void swap(int N, double *x, int incx, double *Y, int incy) { F77_dswap(&N, x, &incx, Y, &incy); }
+  void swap(int N, double *x, int incx, double *Y, int incy) {
+    NDA_TRACE_REGION("dswap", "blas", 0, n_bytes(4l * N, x));
+    F77_dswap(&N, x, &incx, Y, &incy);
+  }
   void swap(int N, std::complex<double> *x, int incx, std::complex<double> *Y, int incy) {
+    NDA_TRACE_REGION("zswap", "blas", 0, n_bytes(4l * N, x));
     F77_zswap(&N, reinterpret_cast<double *>(x), &incx, reinterpret_cast<double *>(Y), &incy); // NOLINT
   }
 
@@ -16,8 +16,11 @@
 
 #pragma once
 #include <complex>
+#include <tuple>
 #include <type_traits>
 
+#include "../mapped_functions.hpp"
+
 namespace nda {
 
   using dcomplex = std::complex<double>;
@@ -58,34 +61,66 @@ namespace nda::blas {
   template <typename A>
   concept VectorView = (is_regular_or_view_v<std::decay_t<A>> and get_rank<std::decay_t<A>> == 1);
 
+  // conj(M), with M a matrix in memory, e.g. dagger(M) = conj(transpose(M)) for a complex matrix M.
+  // It can be given to gemm, gemv, without copy in most cases (see is_blas_operand).
+  template <typename A>
+  concept ConjMatrixView = (is_conj_expr_v<std::decay_t<A>> and MatrixView<decltype(std::get<0>(std::declval<A>().a))>);
+
   // ================================================
 
   // FIXME : kill this
   template <typename A0, typename... A>
   inline constexpr bool have_same_element_type_and_it_is_blas_type_v = have_same_value_type_v<A0, A...> and is_blas_lapack_v<typename A0::value_type>;
 
+  // The matrix in memory of an operand : A itself, or M for A = conj(M)
+  template <typename MatrixType>
+  auto const &get_array(MatrixType const &A) {
+    if constexpr (is_conj_expr_v<MatrixType>)
+      return std::get<0>(A.a);
+    else
+      return A;
+  }
+
+  // Can the operand be given to BLAS without copy, as itself (transpose = false) or as its transpose (transpose = true) ?
+  // Always for a matrix in memory. For conj(M), only if BLAS sees M as the transpose of what is needed : the op is then 'C'.
+  template <typename MatrixType>
+  constexpr bool is_blas_operand(bool transpose) {
+    if constexpr (is_conj_expr_v<MatrixType>)
+      return std::decay_t<decltype(get_array(std::declval<MatrixType>()))>::is_stride_order_Fortran() == transpose;
+    else
+      return true;
+  }
+
   // FIXME : move to impl NS
   template <typename MatrixType>
   char get_trans(MatrixType const &A, bool transpose) {
-    return (A.indexmap().is_stride_order_Fortran() ? (transpose ? 'T' : 'N') : (transpose ? 'N' : 'T'));
+    if constexpr (is_conj_expr_v<MatrixType>) {
+      EXPECTS(is_blas_operand<MatrixType>(transpose));
+      return 'C';
+    } else {
+      return (A.indexmap().is_stride_order_Fortran() ? (transpose ? 'T' : 'N') : (transpose ? 'N' : 'T'));
+    }
   }
 
   // returns the # of rows of the matrix *seen* as fortran matrix
   template <typename MatrixType>
   size_t get_n_rows(MatrixType const &A) {
-    return (A.indexmap().is_stride_order_Fortran() ? A.extent(0) : A.extent(1));
+    auto const &M = get_array(A);
+    return (M.indexmap().is_stride_order_Fortran() ? M.extent(0) : M.extent(1));
   }
 
   // returns the # of cols of the matrix *seen* as fortran matrix
   template <typename MatrixType>
   size_t get_n_cols(MatrixType const &A) {
-    return (A.indexmap().is_stride_order_Fortran() ? A.extent(1) : A.extent(0));
+    auto const &M = get_array(A);
+    return (M.indexmap().is_stride_order_Fortran() ? M.extent(1) : M.extent(0));
   }
 
   // LDA in lapack jargon
   template <typename MatrixType>
   int get_ld(MatrixType const &A) {
-    return A.indexmap().strides()[A.indexmap().is_stride_order_Fortran() ? 1 : 0];
+    auto const &M = get_array(A);
+    return M.indexmap().strides()[M.indexmap().is_stride_order_Fortran() ? 1 : 0];
   }
 
   //template <typename M>
@@ -38,6 +38,30 @@ namespace nda {
             typename OwningPolicy   = nda::borrowed>
   class basic_array_view;
 
+  template <typename T, int Rank>
+  class split_complex_array;
+
+  template <typename T>
+  class coo_matrix;
+
+  template <typename T, char Order>
+  class compressed_matrix;
+
+  template <typename T>
+  class diagonal_matrix;
+
+  template <typename T>
+  class scaled_identity;
+
+  template <typename T, int Rank>
+  class mean_accumulator;
+
+  template <typename T, int Rank>
+  class log_binning_accumulator;
+
+  template <typename T, int Rank>
+  class jackknife_accumulator;
+
   // ---------------------- User aliases  --------------------------------
 
   template <typename ValueType, int Rank, typename Layout = C_layout, typename ContainerPolicy = heap>
@@ -0,0 +1,280 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <array>
+#include <utility>
+
+/*
+ * Compact square matrices with O(n) (or O(1)) storage :
+ *
+ *   diagonal_matrix<T>  : a diagonal matrix, stored as the vector of its diagonal
+ *   scaled_identity<T>  : s * 1, stored as its dimension and s
+ *
+ * Their products with a dense matrix are scalings of its rows (D * M) or of its columns (M * D), in O(n^2).
+ * Their sums with a dense matrix only change its diagonal. to_dense gives the dense matrix.
+ */
+
+namespace nda {
+
+  /**
+   * A square diagonal matrix, stored as the vector of its diagonal elements
+   *
+   * @tparam T The value type
+   */
+  template <typename T>
+  class diagonal_matrix {
+    array<T, 1> _d;
+
+    public:
+    using value_type = T;
+
+    diagonal_matrix() = default;
+
+    /// A diagonal matrix of dimension n. The elements are not initialized.
+    explicit diagonal_matrix(long n) : _d(n) {}
+
+    /// Construct from the diagonal
+    template <ArrayOfRank<1> V>
+    explicit diagonal_matrix(V const &v) : _d(v) {}
+
+    /// Construct from a scaled identity
+    explicit diagonal_matrix(scaled_identity<T> const &x) : _d(x.dim()) { _d = x.value(); }
+
+    // ------------------ Accessors ------------------
+
+    /// Dimension of the matrix. NB : not size(), which is the number of elements for an nda::Array
+    [[nodiscard]] long dim() const noexcept { return _d.size(); }
+
+    [[nodiscard]] std::array<long, 2> shape() const noexcept { return {dim(), dim()}; }
+
+    /// The diagonal
+    [[nodiscard]] array<T, 1> const &diagonal() const noexcept { return _d; }
+    [[nodiscard]] auto diagonal() noexcept { return _d(); }
+
+    /// Element (i, j)
+    [[nodiscard]] T operator()(long i, long j) const { return (i == j ? _d(i) : T{0}); }
+
+    // ------------------ Arithmetic on the diagonal ------------------
+
+    diagonal_matrix &operator*=(T const &s) {
+      _d *= s;
+      return *this;
+    }
+
+    friend diagonal_matrix operator*(diagonal_matrix x, T const &s) { return x *= s; }
+    friend diagonal_matrix operator*(T const &s, diagonal_matrix x) { return x *= s; }
+
+    bool operator==(diagonal_matrix const &) const = default;
+  };
+
+  template <ArrayOfRank<1> V>
+  diagonal_matrix(V const &) -> diagonal_matrix<get_value_t<V>>;
+
+  /**
+   * The identity matrix times a scalar, s * 1
+   *
+   * @tparam T The value type
+   */
+  template <typename T>
+  class scaled_identity {
+    long _n = 0;
+    T _s    = T{1};
+
+    public:
+    using value_type = T;
+
+    scaled_identity() = default;
+
+    /// s * 1, of dimension n
+    explicit scaled_identity(long n, T s = T{1}) : _n(n), _s(s) { EXPECTS(n >= 0); }
+
+    // ------------------ Accessors ------------------
+
+    /// Dimension of the matrix
+    [[nodiscard]] long dim() const noexcept { return _n; }
+
+    [[nodiscard]] std::array<long, 2> shape() const noexcept { return {_n, _n}; }
+
+    /// The scalar s
+    [[nodiscard]] T const &value() const noexcept { return _s; }
+
+    /// Element (i, j)
+    [[nodiscard]] T operator()(long i, long j) const { return (i == j ? _s : T{0}); }
+
+    // ------------------ Arithmetic ------------------
+
+    scaled_identity &operator*=(T const &s) {
+      _s *= s;
+      return *this;
+    }
+
+    friend scaled_identity operator*(scaled_identity x, T const &s) { return x *= s; }
+    friend scaled_identity operator*(T const &s, scaled_identity x) { return x *= s; }
+
+    bool operator==(scaled_identity const &) const = default;
+  };
+
+  template <typename T>
+  inline constexpr bool is_diagonal_matrix_v = false;
+
+  template <typename T>
+  inline constexpr bool is_diagonal_matrix_v<diagonal_matrix<T>> = true;
+
+  template <typename T>
+  inline constexpr bool is_diagonal_matrix_v<scaled_identity<T>> = true;
+
+  // ----------------  Conversion to dense, inverse -------------------------
+
+  /// The dense matrix
+  template <typename D>
+  auto to_dense(D const &d) requires(is_diagonal_matrix_v<D>) {
+    matrix<typename D::value_type> r(d.shape());
+    r = 0;
+    for (long i = 0; i < d.dim(); ++i) r(i, i) = d(i, i);
+    return r;
+  }
+
+  /// The inverse
+  template <typename T>
+  diagonal_matrix<T> inverse(diagonal_matrix<T> const &d) {
+    return diagonal_matrix<T>{T{1} / d.diagonal()};
+  }
+
+  /// The inverse
+  template <typename T>
+  scaled_identity<T> inverse(scaled_identity<T> const &x) {
+    return scaled_identity<T>{x.dim(), T{1} / x.value()};
+  }
+
+  // ----------------  Products -------------------------
+
+  /// D * M : the rows of M scaled by the diagonal of D
+  template <typename D, ArrayOfRank<2> M>
+  auto operator*(D const &d, M const &m) requires(is_diagonal_matrix_v<D>) {
+    EXPECTS_WITH_MESSAGE(d.dim() == m.shape()[0], "Matrix product : dimension mismatch " << d.dim() << " " << m.shape()[0]);
+    matrix<decltype(typename D::value_type{} * get_value_t<M>{})> r(m.shape());
+    for (long i = 0; i < r.extent(0); ++i) {
+      auto di = d(i, i);
+      for (long j = 0; j < r.extent(1); ++j) r(i, j) = di * m(i, j);
+    }
+    return r;
+  }
+
+  /// M * D : the columns of M scaled by the diagonal of D
+  template <ArrayOfRank<2> M, typename D>
+  auto operator*(M const &m, D const &d) requires(is_diagonal_matrix_v<D>) {
+    EXPECTS_WITH_MESSAGE(m.shape()[1] == d.dim(), "Matrix product : dimension mismatch " << m.shape()[1] << " " << d.dim());
+    matrix<decltype(get_value_t<M>{} * typename D::value_type{})> r(m.shape());
+    for (long i = 0; i < r.extent(0); ++i)
+      for (long j = 0; j < r.extent(1); ++j) r(i, j) = m(i, j) * d(j, j);
+    return r;
+  }
+
+  /// D * x : x scaled by the diagonal of D
+  template <typename D, ArrayOfRank<1> V>
+  auto operator*(D const &d, V const &x) requires(is_diagonal_matrix_v<D>) {
+    EXPECTS_WITH_MESSAGE(d.dim() == x.shape()[0], "Matrix vector product : dimension mismatch " << d.dim() << " " << x.shape()[0]);
+    vector<decltype(typename D::value_type{} * get_value_t<V>{})> r(d.dim());
+    for (long i = 0; i < d.dim(); ++i) r(i) = d(i, i) * x(i);
+    return r;
+  }
+
+  /// Product of two diagonal matrices
+  template <typename D1, typename D2>
+  auto operator*(D1 const &d1, D2 const &d2) requires(is_diagonal_matrix_v<D1> and is_diagonal_matrix_v<D2>) {
+    EXPECTS(d1.dim() == d2.dim());
+    diagonal_matrix<decltype(typename D1::value_type{} * typename D2::value_type{})> r(d1.dim());
+    for (long i = 0; i < d1.dim(); ++i) r.diagonal()(i) = d1(i, i) * d2(i, i);
+    return r;
+  }
+
+  /// Product of two scaled identities
+  template <typename T1, typename T2>
+  auto operator*(scaled_identity<T1> const &x1, scaled_identity<T2> const &x2) {
+    EXPECTS(x1.dim() == x2.dim());
+    return scaled_identity<decltype(T1{} * T2{})>{x1.dim(), x1.value() * x2.value()};
+  }
+
+  // ----------------  Sums with dense matrices -------------------------
+
+  namespace details {
+
+    // sm * m + sd * d, for a dense m and a diagonal d : a copy of m, and the diagonal only is added
+    template <typename M, typename D>
+    auto add_diagonal(M const &m, D const &d, int sm, int sd) {
+      EXPECTS(m.shape() == d.shape());
+      using R = decltype(get_value_t<M>{} + typename D::value_type{});
+      matrix<R> r(m.shape());
+      if (sm == 1)
+        r = m;
+      else
+        r = -m;
+      for (long i = 0; i < d.dim(); ++i) r(i, i) += R(sd) * d(i, i);
+      return r;
+    }
+
+  } // namespace details
+
+  template <ArrayOfRank<2> M, typename D>
+  auto operator+(M const &m, D const &d) requires(is_diagonal_matrix_v<D>) {
+    return details::add_diagonal(m, d, 1, 1);
+  }
+
+  template <typename D, ArrayOfRank<2> M>
+  auto operator+(D const &d, M const &m) requires(is_diagonal_matrix_v<D>) {
+    return details::add_diagonal(m, d, 1, 1);
+  }
+
+  template <ArrayOfRank<2> M, typename D>
+  auto operator-(M const &m, D const &d) requires(is_diagonal_matrix_v<D>) {
+    return details::add_diagonal(m, d, 1, -1);
+  }
+
+  template <typename D, ArrayOfRank<2> M>
+  auto operator-(D const &d, M const &m) requires(is_diagonal_matrix_v<D>) {
+    return details::add_diagonal(m, d, -1, 1);
+  }
+
+  // ----------------  Sums of diagonal matrices -------------------------
+
+  template <typename D1, typename D2>
+  auto operator+(D1 const &d1, D2 const &d2) requires(is_diagonal_matrix_v<D1> and is_diagonal_matrix_v<D2>) {
+    EXPECTS(d1.dim() == d2.dim());
+    diagonal_matrix<decltype(typename D1::value_type{} + typename D2::value_type{})> r(d1.dim());
+    for (long i = 0; i < d1.dim(); ++i) r.diagonal()(i) = d1(i, i) + d2(i, i);
+    return r;
+  }
+
+  template <typename D1, typename D2>
+  auto operator-(D1 const &d1, D2 const &d2) requires(is_diagonal_matrix_v<D1> and is_diagonal_matrix_v<D2>) {
+    EXPECTS(d1.dim() == d2.dim());
+    diagonal_matrix<decltype(typename D1::value_type{} - typename D2::value_type{})> r(d1.dim());
+    for (long i = 0; i < d1.dim(); ++i) r.diagonal()(i) = d1(i, i) - d2(i, i);
+    return r;
+  }
+
+  template <typename T1, typename T2>
+  auto operator+(scaled_identity<T1> const &x1, scaled_identity<T2> const &x2) {
+    EXPECTS(x1.dim() == x2.dim());
+    return scaled_identity<decltype(T1{} + T2{})>{x1.dim(), x1.value() + x2.value()};
+  }
+
+  template <typename T1, typename T2>
+  auto operator-(scaled_identity<T1> const &x1, scaled_identity<T2> const &x2) {
+    EXPECTS(x1.dim() == x2.dim());
+    return scaled_identity<decltype(T1{} - T2{})>{x1.dim(), x1.value() - x2.value()};
+  }
+
+} // namespace nda
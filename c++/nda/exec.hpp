@@ -0,0 +1,409 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/*
+ * nda::exec : the thread pool shared by all the parallel kernels of nda.
+ *
+ *   exec::parallel_for(n, f)            : f(i) for i in [0, n[
+ *   exec::parallel_for(shape, f)        : f(i0, i1, ...) over the index domain of nda::for_each(shape, f)
+ *   exec::parallel_for_chunks(n, f)     : f(begin, end) on chunks of [0, n[, for kernels with a per chunk setup
+ *
+ * Scheduling. [0, n[ is cut into chunks of grain iterations. By default, grain is n / (chunks_per_thread * n_threads),
+ * but a chunk does at least min_work units of work, the caller giving the work of one iteration (1 by default) :
+ * a loop with less than min_work units of work runs sequentially, without waking up the pool.
+ * Each worker owns a contiguous block of chunks, and takes them in order, so that neighbouring data stays on one worker
+ * (and on one NUMA domain when the workers are pinned). A worker which has finished its block steals the chunks left
+ * in the blocks of the others. The calling thread is worker 0.
+ * An exception thrown by f stops the distribution of the chunks, and is rethrown in the calling thread.
+ *
+ * Nested parallelism. A parallel_for called from a worker, or while the pool is busy with another caller,
+ * runs sequentially in the calling thread : the number of running threads never exceeds the size of the pool.
+ *
+ * Configuration, read at the first use (or set with exec::configure) :
+ *   NDA_NUM_THREADS   number of workers (default : the number of cores the process may run on, see topology())
+ *   NDA_PIN_THREADS   if 1, the pool threads are pinned to one core each, filling the NUMA domains one after the other (Linux).
+ *                     The workers beyond the number of cores are not pinned.
+ */
+
+namespace nda::exec {
+
+  /// Parameters of the thread pool
+  struct pool_params {
+
+    /// Number of workers, including the calling thread. 0 : the number of cores of topology(), i.e. of the affinity mask
+    int n_threads = 0;
+
+    /// Pin the pool threads to cores (Linux only)
+    bool pin = false;
+
+    /// Default number of chunks per worker (grain size heuristic). More chunks balance better, fewer cost less.
+    long chunks_per_thread = 8;
+
+    /// Minimum work of a chunk with the default grain, in units of the work of one iteration given to parallel_for (1 by default).
+    /// Smaller loops run sequentially : the cost of the fork-join is a few microseconds.
+    long min_work = 4096;
+  };
+
+  /// A core, with its NUMA domain
+  struct core_t {
+    int cpu       = 0;
+    int numa_node = 0;
+  };
+
+  namespace details {
+
+    // Parses a cpulist of the sysfs, e.g. "0-3,8,10-11"
+    inline std::vector<int> parse_cpulist(std::string const &s) {
+      std::vector<int> r;
+      std::stringstream ss(s);
+      std::string item;
+      while (std::getline(ss, item, ',')) {
+        if (item.empty() or item == "\n") continue;
+        auto dash = item.find('-');
+        int first = std::stoi(item.substr(0, dash));
+        int last  = (dash == std::string::npos ? first : std::stoi(item.substr(dash + 1)));
+        for (int c = first; c <= last; ++c) r.push_back(c);
+      }
+      return r;
+    }
+
+    // The worker index of this thread in the pool, and whether it is running a parallel loop
+    inline thread_local int this_worker  = 0;
+    inline thread_local bool in_parallel = false;
+
+  } // namespace details
+
+  /**
+   * The cores available to the process (its affinity mask, e.g. set by taskset or a batch scheduler), ordered by NUMA domain.
+   * Read from /sys/devices/system/node on Linux. Otherwise (or if it is not available), one domain.
+   */
+  inline std::vector<core_t> topology() {
+    std::vector<core_t> r;
+#ifdef __linux__
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    bool has_mask = (sched_getaffinity(0, sizeof(allowed), &allowed) == 0);
+    for (int node = 0;; ++node) {
+      std::ifstream f("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+      if (not f) break;
+      std::string s;
+      std::getline(f, s);
+      for (int c : details::parse_cpulist(s))
+        if (not has_mask or CPU_ISSET(c, &allowed)) r.push_back({c, node});
+    }
+    // no NUMA information : the cores of the mask
+    if (r.empty() and has_mask) {
+      for (int c = 0; c < CPU_SETSIZE; ++c)
+        if (CPU_ISSET(c, &allowed)) r.push_back({c, 0});
+    }
+#endif
+    if (r.empty()) {
+      int n = std::max(1u, std::thread::hardware_concurrency());
+      for (int c = 0; c < n; ++c) r.push_back({c, 0});
+    }
+    return r;
+  }
+
+  /**
+   * A fork-join thread pool with chunk stealing.
+   *
+   * It runs one parallel loop at a time : a loop submitted while another one is running runs sequentially in its thread.
+   */
+  class thread_pool {
+    // The chunks [next, end[ of the block of a worker. On its own cache line, as it is incremented concurrently.
+    struct alignas(64) block_t {
+      std::atomic<long> next = 0;
+      long end               = 0;
+    };
+
+    struct job_t {
+      std::function<void(long, long)> const *f = nullptr;
+      long n                                   = 0;
+      long grain                               = 1;
+      std::exception_ptr error                 = nullptr;
+      std::mutex error_mutex;
+    };
+
+    pool_params params;
+    std::vector<core_t> cores;           // the core of the first workers, one each, if pinned
+    std::vector<std::thread> threads;    // workers 1 ... n-1
+    std::unique_ptr<block_t[]> blocks;   // one per worker
+    job_t *job = nullptr;
+
+    std::mutex busy; // held by the caller of the running loop
+    std::mutex m;
+    std::condition_variable cv_start, cv_done;
+    long generation = 0;
+    int n_running   = 0;
+    bool stop       = false;
+
+    [[nodiscard]] int size() const noexcept { return params.n_threads; }
+
+    // Runs the chunks of the job : first the block of worker w, then the others, starting with the next worker
+    void run(int w) noexcept {
+      long nw = size();
+      for (long k = 0; k < nw; ++k) {
+        auto &b = blocks[(w + k) % nw];
+        for (long c = b.next.fetch_add(1, std::memory_order_relaxed); c < b.end; c = b.next.fetch_add(1, std::memory_order_relaxed)) {
+          try {
+            (*job->f)(c * job->grain, std::min(job->n, (c + 1) * job->grain));
+          } catch (...) {
+            {
+              std::lock_guard lock{job->error_mutex};
+              if (not job->error) job->error = std::current_exception();
+            }
+            for (long v = 0; v < nw; ++v) blocks[v].next.store(blocks[v].end, std::memory_order_relaxed); // stop all
+          }
+        }
+      }
+    }
+
+    void worker_loop(int w) {
+      details::this_worker = w;
+      details::in_parallel = true; // a loop started by a worker runs sequentially
+#ifdef __linux__
+      if (params.pin and w < int(cores.size())) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cores[w].cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+      }
+#endif
+      long seen = 0;
+      for (;;) {
+        {
+          std::unique_lock lock{m};
+          cv_start.wait(lock, [&] { return stop or generation != seen; });
+          if (stop) return;
+          seen = generation;
+        }
+        run(w);
+        {
+          std::lock_guard lock{m};
+          if (--n_running == 0) cv_done.notify_one();
+        }
+      }
+    }
+
+    public:
+    explicit thread_pool(pool_params const &p = {}) : params(p) {
+      auto topo = topology();
+      if (params.n_threads <= 0) params.n_threads = int(topo.size());
+      if (params.chunks_per_thread <= 0) params.chunks_per_thread = 1;
+      if (params.min_work <= 0) params.min_work = 1;
+      // compact placement : worker k on the k-th core, the cores being ordered by NUMA domain.
+      // With more workers than cores, the others are not pinned, rather than sharing a core with a pinned one.
+      for (int w = 0; w < std::min(params.n_threads, int(topo.size())); ++w) cores.push_back(topo[w]);
+      blocks = std::make_unique<block_t[]>(params.n_threads);
+      for (int w = 1; w < params.n_threads; ++w) threads.emplace_back([this, w] { worker_loop(w); });
+    }
+
+    thread_pool(thread_pool const &)            = delete;
+    thread_pool &operator=(thread_pool const &) = delete;
+
+    ~thread_pool() {
+      {
+        std::lock_guard lock{m};
+        stop = true;
+      }
+      cv_start.notify_all();
+      for (auto &t : threads) t.join();
+    }
+
+    /// Number of workers (including the calling thread)
+    [[nodiscard]] int n_threads() const noexcept { return params.n_threads; }
+
+    /// The parameters
+    [[nodiscard]] pool_params const &parameters() const noexcept { return params; }
+
+    /// Number of workers pinned to a core, if the pool is pinned : the workers [0, n_pinned()[
+    [[nodiscard]] int n_pinned() const noexcept { return (params.pin ? int(cores.size()) : 0); }
+
+    /// The core of worker w (only meaningful if the pool is pinned, and w < n_pinned())
+    [[nodiscard]] core_t const &core(int w) const { return cores[w]; }
+
+    /**
+     * Calls f(begin, end) on chunks covering [0, n[, in parallel
+     *
+     * @param grain Size of the chunks. 0 : n / (chunks_per_thread * n_threads), with at least min_work units of work
+     * @param work Work of one iteration, in the units of min_work (only used for the default grain)
+     */
+    void parallel_for_chunks(long n, std::function<void(long, long)> const &f, long grain = 0, long work = 1) {
+      if (n <= 0) return;
+      long nw = size();
+      if (grain <= 0) {
+        long min_grain = (params.min_work + std::max(1l, work) - 1) / std::max(1l, work);
+        grain          = std::max({1l, min_grain, n / (params.chunks_per_thread * nw)});
+      }
+      long n_chunks = (n + grain - 1) / grain;
+
+      // sequential : nested, one worker, one chunk, or the pool is busy with another caller
+      std::unique_lock lock_busy{busy, std::defer_lock};
+      if (details::in_parallel or nw == 1 or n_chunks == 1 or not lock_busy.try_lock()) {
+        f(0, n);
+        return;
+      }
+
+      // the blocks of chunks of the workers
+      job_t j;
+      j.f     = &f;
+      j.n     = n;
+      j.grain = grain;
+      for (long w = 0; w < nw; ++w) {
+        blocks[w].next.store(n_chunks * w / nw, std::memory_order_relaxed);
+        blocks[w].end = n_chunks * (w + 1) / nw;
+      }
+
+      {
+        std::lock_guard lock{m};
+        job       = &j;
+        n_running = nw - 1;
+        ++generation;
+      }
+      cv_start.notify_all();
+
+      details::in_parallel = true;
+      run(0);
+      details::in_parallel = false;
+
+      {
+        std::unique_lock lock{m};
+        cv_done.wait(lock, [&] { return n_running == 0; });
+        job = nullptr;
+      }
+      if (j.error) std::rethrow_exception(j.error);
+    }
+  };
+
+  namespace details {
+
+    inline pool_params params_from_env() {
+      pool_params p;
+      if (auto *s = std::getenv("NDA_NUM_THREADS")) p.n_threads = std::atoi(s);
+      if (auto *s = std::getenv("NDA_PIN_THREADS")) p.pin = (std::atoi(s) != 0);
+      return p;
+    }
+
+    inline std::unique_ptr<thread_pool> &pool_ptr() {
+      static std::unique_ptr<thread_pool> p;
+      return p;
+    }
+
+    inline std::mutex &pool_mutex() {
+      static std::mutex mu;
+      return mu;
+    }
+
+  } // namespace details
+
+  /// The pool of nda, created at the first use
+  inline thread_pool &default_pool() {
+    std::lock_guard lock{details::pool_mutex()};
+    auto &p = details::pool_ptr();
+    if (not p) p = std::make_unique<thread_pool>(details::params_from_env());
+    return *p;
+  }
+
+  /// Replaces the pool of nda. It must not be called while a parallel loop is running.
+  inline void configure(pool_params const &params) {
+    std::lock_guard lock{details::pool_mutex()};
+    auto &p = details::pool_ptr();
+    p.reset();
+    p = std::make_unique<thread_pool>(params);
+  }
+
+  /// Number of workers of the pool
+  inline int n_threads() { return default_pool().n_threads(); }
+
+  /// Index of the worker running the calling thread (0 for a thread outside the pool)
+  inline int worker_index() noexcept { return details::this_worker; }
+
+  /// Is the calling thread running a parallel loop ? (a new parallel loop would then run sequentially)
+  inline bool in_parallel() noexcept { return details::in_parallel; }
+
+  // --------------- parallel_for -----------------------
+
+  /**
+   * Calls f(begin, end) on chunks covering [0, n[, in parallel
+   *
+   * @param grain Size of the chunks. 0 : a default, see thread_pool::parallel_for_chunks
+   * @param work Work of one iteration, in the units of pool_params::min_work (e.g. the number of elements it processes)
+   */
+  template <typename F>
+  void parallel_for_chunks(long n, F &&f, long grain = 0, long work = 1) {
+    default_pool().parallel_for_chunks(n, std::function<void(long, long)>{std::ref(f)}, grain, work);
+  }
+
+  /// Calls f(i) for i in [0, n[, in parallel
+  template <typename F>
+  void parallel_for(long n, F &&f, long grain = 0, long work = 1) {
+    parallel_for_chunks(
+       n,
+       [&f](long b, long e) {
+         for (long i = b; i < e; ++i) f(i);
+       },
+       grain, work);
+  }
+
+  /**
+   * Calls f(i0, i1, ...) for all indices of the domain shape, as nda::for_each(shape, f), in parallel.
+   * The domain is cut in chunks of its C order linear index. Within a chunk, the order is the C order.
+   */
+  template <size_t R, typename F>
+  void parallel_for(std::array<long, R> const &shape, F &&f, long grain = 0, long work = 1) {
+    long n = 1;
+    for (auto l : shape) n *= l;
+    parallel_for_chunks(
+       n,
+       [&f, &shape](long b, long e) {
+         // the multi-index of b, then an odometer
+         std::array<long, R> idx;
+         for (long r = R - 1, l = b; r >= 0; --r) {
+           idx[r] = l % shape[r];
+           l /= shape[r];
+         }
+         for (long i = b; i < e; ++i) {
+           std::apply(f, idx);
+           for (long r = R - 1; r >= 0; --r) {
+             if (++idx[r] < shape[r]) break;
+             idx[r] = 0;
+           }
+         }
+       },
+       grain, work);
+  }
+
+} // namespace nda::exec
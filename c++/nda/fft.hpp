@@ -0,0 +1,321 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <fftw3.h>
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./nda.hpp"
+
+/*
+ * Complex FFT along any set of axes of an array or a strided view, with FFTW.
+ *
+ *   fft(in, out, axes)    : out = the forward transform of in along axes, sum_j in_j exp(-2 i pi j k / n)
+ *   ifft(in, out, axes)   : out = the backward transform of in along axes, normalized : (1/n) sum_j in_j exp(2 i pi j k / n)
+ *   fft(a, axes)          : returns the transform in a new array (idem for ifft)
+ *   fft_inplace(a, axes)  : transforms a in place (idem for ifft_inplace)
+ *
+ * An empty list of axes means all the axes. The transform is batched over the other axes.
+ *
+ * The layouts of the arrays are given as they are to the FFTW guru interface : no copy is made, for any strides.
+ * The plans are created once for a given (shape, strides, axes, direction, ...) and kept in a cache.
+ * Plan creation and destruction are serialized with a mutex, which the lookups in the cache do not wait for.
+ * The execution of the plans is thread safe.
+ *
+ * This header requires FFTW (nda::nda_fftw target in CMake, defined when FFTW is found).
+ */
+
+namespace nda::fft {
+
+  /// Parameters of the transforms
+  struct fft_params {
+
+    /// Number of threads of the FFTW plan. Ignored if the threaded FFTW library is not available.
+    int n_threads = 1;
+
+    /// The FFTW planner flag : FFTW_ESTIMATE, FFTW_MEASURE or FFTW_PATIENT. With a measuring planner, the plan is made on scratch arrays.
+    unsigned planner = FFTW_ESTIMATE;
+  };
+
+  namespace details {
+
+    // The plans are reusable for any arrays with the same key (FFTW new-array execute rules : same layouts, in-place-ness and alignments)
+    struct plan_key {
+      std::vector<long> shape, in_strides, out_strides;
+      std::vector<int> axes;
+      int sign       = FFTW_FORWARD;
+      bool in_place  = false;
+      int in_align   = 0;
+      int out_align  = 0;
+      int n_threads  = 1;
+      unsigned flags = FFTW_ESTIMATE;
+
+      auto operator<=>(plan_key const &) const = default;
+    };
+
+    // A plan, shared by the cache and the transforms executing it
+    using shared_plan = std::shared_ptr<std::remove_pointer_t<fftw_plan>>;
+
+    // The cache of the FFTW plans. A plan is destroyed when it is removed from the cache and no transform executes it.
+    // Only fftw_execute is thread safe in FFTW : the planner and fftw_destroy_plan are serialized by planner_mtx.
+    class plan_cache {
+      std::mutex planner_mtx;
+      std::mutex mtx;
+      std::map<plan_key, shared_plan> plans;
+
+      public:
+      plan_cache() = default;
+      plan_cache(plan_cache const &) = delete;
+      plan_cache &operator=(plan_cache const &) = delete;
+      ~plan_cache() { clear(); }
+
+      // The plan for the key k, created by make() if not in the cache
+      // The lookups do not wait for the planner : if two threads make the same plan, the first one inserted is kept.
+      template <typename F>
+      shared_plan get(plan_key const &k, F make) {
+        {
+          std::lock_guard lock{mtx};
+          auto it = plans.find(k);
+          if (it != plans.end()) return it->second;
+        }
+        fftw_plan p = [&] {
+          std::lock_guard planner_lock{planner_mtx};
+          return make();
+        }();
+        if (p == nullptr) NDA_RUNTIME_ERROR << "fft : FFTW could not create a plan";
+        auto sp = shared_plan{p, [this](fftw_plan q) {
+                                std::lock_guard planner_lock{planner_mtx};
+                                fftw_destroy_plan(q);
+                              }};
+        shared_plan r;
+        {
+          std::lock_guard lock{mtx};
+          r = plans.try_emplace(k, sp).first->second;
+        }
+        return r; // a plan made twice is destroyed here, out of mtx
+      }
+
+      // The plans executed by other threads are destroyed at the end of their transform, the others here, out of mtx
+      void clear() {
+        std::map<plan_key, shared_plan> removed;
+        {
+          std::lock_guard lock{mtx};
+          removed.swap(plans);
+        }
+      }
+
+      long size() {
+        std::lock_guard lock{mtx};
+        return plans.size();
+      }
+    };
+
+    inline plan_cache &get_plan_cache() {
+      static plan_cache cache;
+      return cache;
+    }
+
+    // The extent [lo, hi] of the offsets of an array with lengths and strides (in elements)
+    inline std::pair<long, long> offset_span(std::vector<long> const &lengths, std::vector<long> const &strides) {
+      long lo = 0, hi = 0;
+      for (size_t d = 0; d < lengths.size(); ++d) (strides[d] < 0 ? lo : hi) += (lengths[d] - 1) * strides[d];
+      return {lo, hi};
+    }
+
+    // A scratch array for a measuring planner, with the same layout and alignment as an array starting at ptr
+    struct scratch_t {
+      char *buf          = nullptr;
+      fftw_complex *data = nullptr;
+
+      scratch_t(std::vector<long> const &lengths, std::vector<long> const &strides, int align) {
+        auto [lo, hi] = offset_span(lengths, strides);
+        buf           = static_cast<char *>(fftw_malloc((hi - lo + 1) * sizeof(fftw_complex) + 64));
+        if (buf == nullptr) NDA_RUNTIME_ERROR << "fft : allocation of a scratch array failed";
+        data = reinterpret_cast<fftw_complex *>(buf + align) - lo; // NOLINT
+      }
+      scratch_t(scratch_t const &) = delete;
+      scratch_t &operator=(scratch_t const &) = delete;
+      ~scratch_t() { fftw_free(buf); }
+    };
+
+    inline void init_threads() {
+#ifdef NDA_HAVE_FFTW_THREADS
+      static bool ok = (fftw_init_threads() != 0);
+      if (not ok) NDA_RUNTIME_ERROR << "fft : FFTW threads initialization failed";
+#endif
+    }
+
+    inline int alignment_of(void const *p) { return fftw_alignment_of(reinterpret_cast<double *>(const_cast<void *>(p))); } // NOLINT
+
+    // Transform of in into out along axes, unnormalized. sign = FFTW_FORWARD or FFTW_BACKWARD
+    template <MemoryArray A, MemoryArray B>
+    void dft(A const &in, B &out, std::vector<int> axes, int sign, fft_params const &p) {
+      static constexpr int R = get_rank<A>;
+      static_assert(get_rank<B> == R, "fft : in and out must have the same rank");
+      static_assert(std::is_same_v<std::remove_const_t<get_value_t<A>>, std::complex<double>>, "fft : the input must be an array of complex<double>");
+      static_assert(std::is_same_v<get_value_t<B>, std::complex<double>>, "fft : the output must be a (non const) array of complex<double>");
+      EXPECTS_WITH_MESSAGE(in.shape() == out.shape(), "fft : in and out have different shapes " << in.shape() << " " << out.shape());
+
+      if (axes.empty())
+        for (int d = 0; d < R; ++d) axes.push_back(d);
+      std::vector<bool> transformed(R, false);
+      for (int d : axes) {
+        if (d < 0 or d >= R or transformed[d]) NDA_RUNTIME_ERROR << "fft : incorrect axis " << d << " in the list of axes of an array of rank " << R;
+        transformed[d] = true;
+      }
+      if (in.size() == 0) return;
+
+      auto *in_ptr  = reinterpret_cast<fftw_complex *>(const_cast<std::complex<double> *>(in.data())); // NOLINT
+      auto *out_ptr = reinterpret_cast<fftw_complex *>(out.data());                                  // NOLINT
+
+      auto const shape = in.shape();
+      auto const is    = in.indexmap().strides();
+      auto const os    = out.indexmap().strides();
+
+      plan_key k;
+      k.shape       = {shape.begin(), shape.end()};
+      k.in_strides  = {is.begin(), is.end()};
+      k.out_strides = {os.begin(), os.end()};
+      k.axes        = axes;
+      k.sign        = sign;
+      k.in_place    = (in_ptr == out_ptr);
+      k.in_align    = alignment_of(in_ptr);
+      k.out_align   = alignment_of(out_ptr);
+      k.n_threads   = p.n_threads;
+      k.flags       = p.planner;
+      if (k.in_place) EXPECTS_WITH_MESSAGE(k.in_strides == k.out_strides, "fft : in place transform with different strides");
+
+      auto make = [&k]() {
+        std::vector<fftw_iodim64> dims, howmany;
+        for (int d : k.axes) dims.push_back({k.shape[d], k.in_strides[d], k.out_strides[d]});
+        for (int d = 0; d < R; ++d)
+          if (std::find(k.axes.begin(), k.axes.end(), d) == k.axes.end()) howmany.push_back({k.shape[d], k.in_strides[d], k.out_strides[d]});
+
+        init_threads();
+#ifdef NDA_HAVE_FFTW_THREADS
+        fftw_plan_with_nthreads(k.n_threads);
+#endif
+        // a measuring planner overwrites the arrays : plan on scratch arrays
+        scratch_t s_in{k.shape, k.in_strides, k.in_align};
+        std::optional<scratch_t> s_out;
+        if (not k.in_place) s_out.emplace(k.shape, k.out_strides, k.out_align);
+        return fftw_plan_guru64_dft(int(dims.size()), dims.data(), int(howmany.size()), howmany.data(), s_in.data,
+                                    (k.in_place ? s_in.data : s_out->data), k.sign, k.flags);
+      };
+
+      auto plan = get_plan_cache().get(k, make);
+      fftw_execute_dft(plan.get(), in_ptr, out_ptr);
+    }
+
+    // Product of the lengths along the axes (all axes if empty)
+    template <typename A>
+    double n_transformed(A const &a, std::vector<int> const &axes) {
+      if (axes.empty()) return double(a.size());
+      double n = 1;
+      for (int d : axes) n *= a.shape()[d];
+      return n;
+    }
+
+  } // namespace details
+
+  /// Number of plans in the cache
+  inline long plan_cache_size() { return details::get_plan_cache().size(); }
+
+  /// Remove all the plans from the cache. It can be called while other threads transform : their plans are destroyed after use.
+  inline void clear_plan_cache() { details::get_plan_cache().clear(); }
+
+  // ----------------  Out of place -------------------------
+
+  /**
+   * Forward transform of in along axes, into out
+   *
+   * @param in An array or a view of complex<double>, with any strides
+   * @param out An array or a view of complex<double>, of the same shape. It can be in itself (in place).
+   * @param axes The transformed axes. Empty : all the axes.
+   * @param p The parameters
+   */
+  template <MemoryArray A, MemoryArray B>
+  void fft(A const &in, B &&out, std::vector<int> const &axes = {}, fft_params const &p = {}) {
+    details::dft(in, out, axes, FFTW_FORWARD, p);
+  }
+
+  /**
+   * Backward transform of in along axes, into out, normalized by the product of the transformed lengths
+   *
+   * @param in An array or a view of complex<double>, with any strides
+   * @param out An array or a view of complex<double>, of the same shape. It can be in itself (in place).
+   * @param axes The transformed axes. Empty : all the axes.
+   * @param p The parameters
+   */
+  template <MemoryArray A, MemoryArray B>
+  void ifft(A const &in, B &&out, std::vector<int> const &axes = {}, fft_params const &p = {}) {
+    details::dft(in, out, axes, FFTW_BACKWARD, p);
+    if (out.size() > 0) out *= 1.0 / details::n_transformed(out, axes);
+  }
+
+  // ----------------  In place -------------------------
+
+  /// Forward transform of a along axes, in place
+  template <MemoryArray A>
+  void fft_inplace(A &&a, std::vector<int> const &axes = {}, fft_params const &p = {}) {
+    fft(a, a, axes, p);
+  }
+
+  /// Backward transform of a along axes, in place, normalized
+  template <MemoryArray A>
+  void ifft_inplace(A &&a, std::vector<int> const &axes = {}, fft_params const &p = {}) {
+    ifft(a, a, axes, p);
+  }
+
+  // ----------------  Returning a new array -------------------------
+
+  /// Forward transform of a along axes, in a new array. a can be any array (e.g. real), converted to complex<double>.
+  template <Array A>
+  array<std::complex<double>, get_rank<A>> fft(A const &a, std::vector<int> const &axes = {}, fft_params const &p = {}) {
+    if constexpr (MemoryArray<A> and std::is_same_v<std::remove_const_t<get_value_t<A>>, std::complex<double>>) {
+      array<std::complex<double>, get_rank<A>> r(a.shape());
+      fft(a, r, axes, p);
+      return r;
+    } else {
+      array<std::complex<double>, get_rank<A>> r = a;
+      fft_inplace(r, axes, p);
+      return r;
+    }
+  }
+
+  /// Backward transform of a along axes, normalized, in a new array. a can be any array, converted to complex<double>.
+  template <Array A>
+  array<std::complex<double>, get_rank<A>> ifft(A const &a, std::vector<int> const &axes = {}, fft_params const &p = {}) {
+    if constexpr (MemoryArray<A> and std::is_same_v<std::remove_const_t<get_value_t<A>>, std::complex<double>>) {
+      array<std::complex<double>, get_rank<A>> r(a.shape());
+      ifft(a, r, axes, p);
+      return r;
+    } else {
+      array<std::complex<double>, get_rank<A>> r = a;
+      ifft_inplace(r, axes, p);
+      return r;
+    }
+  }
+
+} // namespace nda::fft
@@ -20,6 +20,7 @@
 
 #include "basic_array.hpp"
 #include "exceptions.hpp"
+#include "tracing.hpp"
 
 namespace nda {
 
@@ -110,6 +111,7 @@ namespace nda {
     } else if constexpr (is_scalar_v<typename A::value_type>) { // FIXME : register types as USER DEFINED hdf5 types
 
       static constexpr bool is_complex = is_complex_v<typename A::value_type>;
+      NDA_TRACE_REGION("h5_write", "h5", 0, double(a.size()) * sizeof(typename A::value_type));
       h5_details::write(g, name, h5::hdf5_type<get_value_t<A>>(), (void *)(a.data()), A::rank, is_complex, a.indexmap().lengths().data(),
                         a.indexmap().strides().data(), a.size());
 
@@ -174,6 +176,7 @@ namespace nda {
         v.slab.count[u] = L[u];
         v.L_tot[u]      = L[u];
       }
+      NDA_TRACE_REGION("h5_read", "h5", 0, double(a.size()) * sizeof(typename A::value_type));
       h5::array_interface::read(g, name, v, lt);
 
     } else { // generic unknown type to hdf5
@@ -190,4 +193,138 @@ namespace nda {
     }
   }
 
+  /// Write a split complex array. It is stored as a complex array, in the interleaved form.
+  template <typename T, int R>
+  void h5_write(h5::group g, std::string const &name, split_complex_array<T, R> const &a) {
+    h5_write(g, name, array<std::complex<T>, R>{a});
+  }
+
+  /// Read a split complex array, stored as a complex array
+  template <typename T, int R>
+  void h5_read(h5::group g, std::string const &name, split_complex_array<T, R> &a) {
+    array<std::complex<T>, R> z;
+    h5_read(g, name, z);
+    a = z;
+  }
+
+  /// Write a CSR/CSC matrix, as a group with the shape and the compressed arrays ptr, idx, values
+  template <typename T, char Order>
+  void h5_write(h5::group g, std::string const &name, compressed_matrix<T, Order> const &a) {
+    auto g2 = g.create_group(name);
+    h5_write(g2, "shape", a.shape());
+    h5_write(g2, "ptr", a.ptr());
+    h5_write(g2, "idx", a.idx());
+    h5_write(g2, "values", a.values());
+  }
+
+  /// Read a CSR/CSC matrix
+  template <typename T, char Order>
+  void h5_read(h5::group g, std::string const &name, compressed_matrix<T, Order> &a) {
+    auto g2 = g.open_group(name);
+    std::array<long, 2> shape;
+    array<long, 1> ptr, idx;
+    array<T, 1> values;
+    h5_read(g2, "shape", shape);
+    h5_read(g2, "ptr", ptr);
+    h5_read(g2, "idx", idx);
+    h5_read(g2, "values", values);
+    a = compressed_matrix<T, Order>{shape, std::move(ptr), std::move(idx), std::move(values)};
+  }
+
+  /// Write a COO matrix, as a group with the shape and the arrays rows, cols, values
+  template <typename T>
+  void h5_write(h5::group g, std::string const &name, coo_matrix<T> const &a) {
+    auto g2 = g.create_group(name);
+    h5_write(g2, "shape", a.shape());
+    h5_write(g2, "rows", array<long, 1>{a.rows()});
+    h5_write(g2, "cols", array<long, 1>{a.cols()});
+    h5_write(g2, "values", array<T, 1>{a.values()});
+  }
+
+  /// Read a COO matrix
+  template <typename T>
+  void h5_read(h5::group g, std::string const &name, coo_matrix<T> &a) {
+    auto g2 = g.open_group(name);
+    std::array<long, 2> shape;
+    array<long, 1> rows, cols;
+    array<T, 1> values;
+    h5_read(g2, "shape", shape);
+    h5_read(g2, "rows", rows);
+    h5_read(g2, "cols", cols);
+    h5_read(g2, "values", values);
+    a = coo_matrix<T>{shape, std::move(rows), std::move(cols), std::move(values)};
+  }
+
+  /// Write a mean accumulator, as a group with the count, the mean and m2
+  template <typename T, int R>
+  void h5_write(h5::group g, std::string const &name, mean_accumulator<T, R> const &a) {
+    auto g2 = g.create_group(name);
+    h5_write(g2, "count", a.count());
+    h5_write(g2, "mean", a.mean());
+    h5_write(g2, "m2", a.m2());
+  }
+
+  /// Read a mean accumulator
+  template <typename T, int R>
+  void h5_read(h5::group g, std::string const &name, mean_accumulator<T, R> &a) {
+    auto g2 = g.open_group(name);
+    long n  = 0;
+    array<T, R> mean;
+    array<typename mean_accumulator<T, R>::real_t, R> m2;
+    h5_read(g2, "count", n);
+    h5_read(g2, "mean", mean);
+    h5_read(g2, "m2", m2);
+    a = mean_accumulator<T, R>{n, std::move(mean), std::move(m2)};
+  }
+
+  /// Write a logarithmic binning accumulator, as a group with the statistics of the levels and the incomplete bins
+  template <typename T, int R>
+  void h5_write(h5::group g, std::string const &name, log_binning_accumulator<T, R> const &a) {
+    auto g2 = g.create_group(name);
+    h5_write(g2, "n_samples", a.n_samples());
+    h5_write(g2, "counts", a.counts());
+    h5_write(g2, "means", a.means());
+    h5_write(g2, "m2s", a.m2s());
+    h5_write(g2, "pending", a.pending());
+  }
+
+  /// Read a logarithmic binning accumulator
+  template <typename T, int R>
+  void h5_read(h5::group g, std::string const &name, log_binning_accumulator<T, R> &a) {
+    auto g2 = g.open_group(name);
+    long n  = 0;
+    array<long, 1> counts;
+    array<T, R + 1> means, pending;
+    array<typename log_binning_accumulator<T, R>::real_t, R + 1> m2s;
+    h5_read(g2, "n_samples", n);
+    h5_read(g2, "counts", counts);
+    h5_read(g2, "means", means);
+    h5_read(g2, "m2s", m2s);
+    h5_read(g2, "pending", pending);
+    a = log_binning_accumulator<T, R>{n, std::move(counts), std::move(means), std::move(m2s), std::move(pending)};
+  }
+
+  /// Write a jackknife accumulator, as a group with the bins and their sizes
+  template <typename T, int R>
+  void h5_write(h5::group g, std::string const &name, jackknife_accumulator<T, R> const &a) {
+    auto g2 = g.create_group(name);
+    h5_write(g2, "bins", a.bins());
+    h5_write(g2, "n_full", a.n_full_bins());
+    h5_write(g2, "n_partial", a.n_partial());
+    h5_write(g2, "bin_size", a.bin_size());
+  }
+
+  /// Read a jackknife accumulator
+  template <typename T, int R>
+  void h5_read(h5::group g, std::string const &name, jackknife_accumulator<T, R> &a) {
+    auto g2 = g.open_group(name);
+    array<T, R + 1> bins;
+    long n_full = 0, n_partial = 0, bin_size = 1;
+    h5_read(g2, "bins", bins);
+    h5_read(g2, "n_full", n_full);
+    h5_read(g2, "n_partial", n_partial);
+    h5_read(g2, "bin_size", bin_size);
+    a = jackknife_accumulator<T, R>{std::move(bins), n_full, n_partial, bin_size};
+  }
+
 } // namespace nda
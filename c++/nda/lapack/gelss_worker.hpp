@@ -65,10 +65,9 @@ namespace nda::lapack {
       gesvd(A_FL, s_vec, U, VT);
 
       // Calculate the matrix V * Diag(S_vec)^{-1} * UT for the least square procedure
-      matrix<double, F_layout> S_inv(N, M);
-      S_inv = 0.;
-      for (int i : range(std::min(M, N))) S_inv(i, i) = 1.0 / s_vec(i);
-      V_x_InvS_x_UT = dagger(VT) * S_inv * dagger(U);
+      // NB : N <= M, so only the first N columns of U contribute
+      auto S_inv    = inverse(diagonal_matrix{s_vec});
+      V_x_InvS_x_UT = dagger(VT) * (S_inv * dagger(U(range(M), range(N))));
 
       // Read off U_Null for defining the error of the least square procedure
       if (N < M) UT_NULL = dagger(U)(range(N, M), range(M));
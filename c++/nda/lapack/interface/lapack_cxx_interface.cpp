@@ -1,55 +1,90 @@
 #include "lapack_cxx_interface.hpp"
+#include "../../tracing.hpp"
+
+#include <algorithm>
 // Extracted from Reference Lapack (https://github.com/Reference-LAPACK):
 #include "lapack.h"
 
 namespace nda::lapack::f77 {
 
+  // For the tracing : size in bytes of n elements of type T, and flops of the LU factorization of a M x N matrix (real)
+  template <typename T>
+  constexpr double n_bytes(long n, T const *) {
+    return double(n) * sizeof(T);
+  }
+  constexpr double getrf_flops(double m, double n) { return (m >= n ? m * n * n - n * n * n / 3 : n * m * m - m * m * m / 3); }
+
   void gelss(int M, int N, int NRHS, double *A, int LDA, double *B, int LDB, double *S, double RCOND, int &RANK, double *WORK, int LWORK, int &INFO) {
+    NDA_TRACE_REGION((LWORK == -1 ? nullptr : "dgelss"), "lapack", 0, n_bytes(long(M) * N + long(std::max(M, N)) * NRHS, A));
     LAPACK_dgelss(&M, &N, &NRHS, A, &LDA, B, &LDB, S, &RCOND, &RANK, WORK, &LWORK, &INFO);
   }
   void gelss(int M, int N, int NRHS, std::complex<double> *A, int LDA, std::complex<double> *B, int LDB, double *S, double RCOND, int &RANK,
              std::complex<double> *WORK, int LWORK, double *RWORK, int &INFO) {
+    NDA_TRACE_REGION((LWORK == -1 ? nullptr : "zgelss"), "lapack", 0, n_bytes(long(M) * N + long(std::max(M, N)) * NRHS, A));
     LAPACK_zgelss(&M, &N, &NRHS, A, &LDA, B, &LDB, S, &RCOND, &RANK, WORK, &LWORK, RWORK, &INFO);
   }
 
   void gesvd(const char &JOBU, const char &JOBVT, int M, int N, double *A, int LDA, double *S, double *U, int LDU, double *VT, int LDVT, double *WORK,
              int LWORK, int &INFO) {
+    NDA_TRACE_REGION((LWORK == -1 ? nullptr : "dgesvd"), "lapack", 0, n_bytes(long(M) * N, A));
     LAPACK_dgesvd(&JOBU, &JOBVT, &M, &N, A, &LDA, S, U, &LDU, VT, &LDVT, WORK, &LWORK, &INFO);
   }
   void gesvd(const char &JOBU, const char &JOBVT, int M, int N, std::complex<double> *A, int LDA, double *S, std::complex<double> *U, int LDU,
              std::complex<double> *VT, int LDVT, std::complex<double> *WORK, int LWORK, double *RWORK, int &INFO) {
+    NDA_TRACE_REGION((LWORK == -1 ? nullptr : "zgesvd"), "lapack", 0, n_bytes(long(M) * N, A));
     LAPACK_zgesvd(&JOBU, &JOBVT, &M, &N, A, &LDA, S, U, &LDU, VT, &LDVT, WORK, &LWORK, RWORK, &INFO);
   }
 
-  void getrf(int M, int N, double *A, int LDA, int *ipiv, int &info) { LAPACK_dgetrf(&M, &N, A, &LDA, ipiv, &info); }
-  void getrf(int M, int N, std::complex<double> *A, int LDA, int *ipiv, int &info) { LAPACK_zgetrf(&M, &N, A, &LDA, ipiv, &info); }
+  void getrf(int M, int N, double *A, int LDA, int *ipiv, int &info) {
+    NDA_TRACE_REGION("dgetrf", "lapack", getrf_flops(M, N), n_bytes(long(M) * N, A));
+    LAPACK_dgetrf(&M, &N, A, &LDA, ipiv, &info);
+  }
+  void getrf(int M, int N, std::complex<double> *A, int LDA, int *ipiv, int &info) {
+    NDA_TRACE_REGION("zgetrf", "lapack", 4 * getrf_flops(M, N), n_bytes(long(M) * N, A));
+    LAPACK_zgetrf(&M, &N, A, &LDA, ipiv, &info);
+  }
 
-  void getri(int N, double *A, int LDA, int *ipiv, double *work, int lwork, int &info) { LAPACK_dgetri(&N, A, &LDA, ipiv, work, &lwork, &info); }
+  void getri(int N, double *A, int LDA, int *ipiv, double *work, int lwork, int &info) {
+    NDA_TRACE_REGION((lwork == -1 ? nullptr : "dgetri"), "lapack", 4.0 / 3 * N * N * N, n_bytes(long(N) * N, A));
+    LAPACK_dgetri(&N, A, &LDA, ipiv, work, &lwork, &info);
+  }
   void getri(int N, std::complex<double> *A, int LDA, int *ipiv, std::complex<double> *work, int lwork, int &info) {
+    NDA_TRACE_REGION((lwork == -1 ? nullptr : "zgetri"), "lapack", 16.0 / 3 * N * N * N, n_bytes(long(N) * N, A));
     LAPACK_zgetri(&N, A, &LDA, ipiv, work, &lwork, &info);
   }
 
-  void gtsv(int N, int NRHS, double *DL, double *D, double *DU, double *B, int LDB, int &info) { LAPACK_dgtsv(&N, &NRHS, DL, D, DU, B, &LDB, &info); }
+  void gtsv(int N, int NRHS, double *DL, double *D, double *DU, double *B, int LDB, int &info) {
+    NDA_TRACE_REGION("dgtsv", "lapack", 8.0 * N * NRHS, n_bytes(3l * N + long(N) * NRHS, B));
+    LAPACK_dgtsv(&N, &NRHS, DL, D, DU, B, &LDB, &info);
+  }
   void gtsv(int N, int NRHS, std::complex<double> *DL, std::complex<double> *D, std::complex<double> *DU, std::complex<double> *B, int LDB,
             int &info) {
+    NDA_TRACE_REGION("zgtsv", "lapack", 32.0 * N * NRHS, n_bytes(3l * N + long(N) * NRHS, B));
     LAPACK_zgtsv(&N, &NRHS, DL, D, DU, B, &LDB, &info);
   }
 
-  void stev(char J, int N, double *D, double *E, double *Z, int ldz, double *work, int &info) { LAPACK_dstev(&J, &N, D, E, Z, &ldz, work, &info); }
+  void stev(char J, int N, double *D, double *E, double *Z, int ldz, double *work, int &info) {
+    NDA_TRACE_REGION("dstev", "lapack", 0, n_bytes(2l * N + (J == 'V' ? long(N) * N : 0l), D));
+    LAPACK_dstev(&J, &N, D, E, Z, &ldz, work, &info);
+  }
 
   void syev(char JOBZ, char UPLO, int N, double *A, int LDA, double *W, double *work, int &lwork, int &info) {
+    NDA_TRACE_REGION((lwork == -1 ? nullptr : "dsyev"), "lapack", 0, n_bytes(long(N) * N, A));
     LAPACK_dsyev(&JOBZ, &UPLO, &N, A, &LDA, W, work, &lwork, &info);
   }
 
   void heev(char JOBZ, char UPLO, int N, std::complex<double> *A, int LDA, double *W, std::complex<double> *work, int &lwork, double *work2,
             int &info) {
+    NDA_TRACE_REGION((lwork == -1 ? nullptr : "zheev"), "lapack", 0, n_bytes(long(N) * N, A));
     LAPACK_zheev(&JOBZ, &UPLO, &N, A, &LDA, W, work, &lwork, work2, &info);
   }
 
   void getrs(char TRANS, int N, int NRHS, double const *A, int LDA, int *ipiv, double *B, int LDB, int &info) {
+    NDA_TRACE_REGION("dgetrs", "lapack", 2.0 * N * N * NRHS, n_bytes(long(N) * N + long(N) * NRHS, A));
     LAPACK_dgetrs(&TRANS, &N, &NRHS, A, &LDA, ipiv, B, &LDB, &info);
   }
   void getrs(char TRANS, int N, int NRHS, std::complex<double> const *A, int LDA, int *ipiv, std::complex<double> *B, int LDB, int &info) {
+    NDA_TRACE_REGION("zgetrs", "lapack", 8.0 * N * N * NRHS, n_bytes(long(N) * N + long(N) * NRHS, A));
     LAPACK_zgetrs(&TRANS, &N, &NRHS, A, &LDA, ipiv, B, &LDB, &info);
   }
 
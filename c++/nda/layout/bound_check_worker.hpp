@@ -32,14 +32,26 @@ namespace nda::details {
     }
 
     void f(range::all_t) { ++N; }
-    void f(range) { ++N; }
+
+    // all the elements of the range must be in [0, length[
+    void f(range r) {
+      if (r.size() > 0) {
+        long l  = r.first() + (r.size() - 1) * r.step();
+        bool pb = ((r.first() < 0) or (r.first() >= lengths[N]) or (l < 0) or (l >= lengths[N]));
+        if (pb) error_code += 1ul << N;
+      }
+      ++N;
+    }
     void f(ellipsis) { N += ellipsis_loss + 1; }
 
     void g(std::stringstream &fs, long key) {
       if (error_code & (1ull << N)) fs << "argument " << N << " = " << key << " is not within [0," << lengths[N] << "[\n";
       N++;
     }
-    void g(std::stringstream &, range) { ++N; }
+    void g(std::stringstream &fs, range r) {
+      if (error_code & (1ull << N)) fs << "argument " << N << " = " << r << " is not within [0," << lengths[N] << "[\n";
+      N++;
+    }
     void g(std::stringstream &, range::all_t) { ++N; }
     void g(std::stringstream &, ellipsis) { N += ellipsis_loss + 1; }
   };
@@ -15,6 +15,9 @@
 // Authors: Olivier Parcollet, Nils Wentzell
 
 #pragma once
+#include <type_traits>
+
+#include "../macros.hpp"
 #include "permutation.hpp"
 
 namespace nda {
@@ -43,6 +46,39 @@ namespace nda {
 
   namespace details {
 
+    // ----------------  loop index  -------------------------
+
+    /*
+     * An index produced by the internal loops of nda, over a shape that nda has already checked
+     * (the assignment of an array or an expression, see assign_from_ndarray).
+     *
+     * With NDA_BOUNDCHECK_HOISTED, the bounds are checked once at the entry of slices, assignments and expressions (shapes),
+     * and the element accesses with such indices are not checked again (see idx_map::operator()).
+     * The indices of these loops are then hoisted_index instead of long. They convert implicitly to long.
+     *
+     * The user facing loops (nda::for_each, for_each_tiled) pass long : their body can index any array.
+     */
+    struct hoisted_index {
+      long value;
+      constexpr operator long() const noexcept { return value; } // NOLINT
+    };
+
+    template <typename T>
+    inline constexpr bool is_hoisted_index_v = std::is_same_v<T, hoisted_index>;
+
+    // The index passed by the loops of nda. Hoisted only for the internal loops.
+    template <bool Hoisted>
+    FORCEINLINE constexpr auto loop_index(long i) noexcept {
+#if defined(NDA_BOUNDCHECK_HOISTED) and not defined(NDA_ENFORCE_BOUNDCHECK)
+      if constexpr (Hoisted)
+        return hoisted_index{i};
+      else
+        return i;
+#else
+      return i;
+#endif
+    }
+
     // return the i th index in Strider
     template <int R>
     constexpr int index_from_stride_order(uint64_t StrideOrder, int i) {
@@ -68,15 +104,16 @@ namespace nda {
 
     // ----------------  for_each
 
-    template <int I, uint64_t StaticExtents, uint64_t StrideOrder, typename F, size_t R, std::integral Int = long>
+    template <int I, uint64_t StaticExtents, uint64_t StrideOrder, bool Hoisted, typename F, size_t R, std::integral Int = long>
     FORCEINLINE void for_each_static_impl(std::array<Int, R> const &idx_lengths, F &&f) {
       if constexpr (I == R)
         f();
       else {
         static constexpr int J = details::index_from_stride_order<R>(StrideOrder, I);
         const long imax        = details::get_extent<J, R, StaticExtents>(idx_lengths);
-        for (long i = 0; i < imax; ++i) {
-          for_each_static_impl<I + 1, StaticExtents, StrideOrder>(
+        for (long i0 = 0; i0 < imax; ++i0) {
+          auto i = loop_index<Hoisted>(i0);
+          for_each_static_impl<I + 1, StaticExtents, StrideOrder, Hoisted>(
              idx_lengths,
              [ i, &f ](auto &&... x)
 // Great: clang and gcc want the lambda mutable and attribute in a different order !:
@@ -96,13 +133,23 @@ namespace nda {
   ///
   template <uint64_t StaticExtents, uint64_t StrideOrder, typename F, auto R, std::integral Int = long>
   FORCEINLINE void for_each_static(std::array<Int, R> const &idx_lengths, F &&f) {
-    details::for_each_static_impl<0, StaticExtents, StrideOrder>(idx_lengths, f);
+    details::for_each_static_impl<0, StaticExtents, StrideOrder, false>(idx_lengths, f);
   }
 
   /// A loop in C order
   template <typename F, auto R, std::integral Int = long>
   FORCEINLINE void for_each(std::array<Int, R> const &idx_lengths, F &&f) {
-    details::for_each_static_impl<0, 0, 0>(idx_lengths, f);
+    details::for_each_static_impl<0, 0, 0, false>(idx_lengths, f);
   }
 
+  namespace details {
+
+    // A loop in C order, with hoisted indices. Only for shapes checked by nda (see hoisted_index).
+    template <typename F, auto R, std::integral Int = long>
+    FORCEINLINE void for_each_hoisted(std::array<Int, R> const &idx_lengths, F &&f) {
+      details::for_each_static_impl<0, 0, 0, true>(idx_lengths, f);
+    }
+
+  } // namespace details
+
 } // namespace nda
@@ -58,7 +58,10 @@ namespace nda {
    *   where d1, d3 are static dimensions for index 1,3
    *         NB Limitation : d1, d3 < 16 (until C++20)
    *         0 mean dynamic dimension
-   *   NB : if StaticExtents ==0, it means all dimensions are static
+   *   NB : if StaticExtents ==0, all dimensions are dynamic
+   *
+   *   If all the extents are static and the layout is contiguous, the layout is "fully static" : the lengths and the strides
+   *   are compile time constants, the idx_map is empty and its call operator is a constant expression in the strides.
    *
    * @tparam StrideOrder : a permutation for the memory stride_order of the array
    *    
@@ -78,7 +81,6 @@ namespace nda {
   class idx_map {
     static_assert(Rank < 16, "Rank must be < 16"); // C++17 constraint. Relax this in C++20
     static_assert((StrideOrder != 0) or (Rank == 1), "Oops");
-    std::array<long, Rank> len, str; // lenghts and strides
 
     public:
     static constexpr uint64_t static_extents_encoded      = StaticExtents;
@@ -105,6 +107,47 @@ namespace nda {
       return r;
     }();
 
+    public:
+    /// Are the lengths and the strides known at compile time ? i.e. all extents are static and the layout is contiguous.
+    static constexpr bool is_fully_static = (n_dynamic_extents == 0) and has_contiguous(LayoutProp);
+
+    private:
+    // The lengths and the strides of a fully static layout (unused otherwise)
+    static constexpr std::array<long, Rank> static_len = []() {
+      std::array<long, Rank> r{};
+      for (int u = 0; u < Rank; ++u) r[u] = static_extents[u];
+      return r;
+    }();
+
+    static constexpr std::array<long, Rank> static_str = []() {
+      std::array<long, Rank> r{};
+      long s = 1;
+      for (int v = Rank - 1; v >= 0; --v) {
+        r[stride_order[v]] = s;
+        s *= static_len[stride_order[v]];
+      }
+      return r;
+    }();
+
+    // The lengths and the strides, stored only if the layout is not fully static
+    struct len_str_t {
+      std::array<long, Rank> len, str;
+      bool operator==(len_str_t const &) const = default;
+    };
+    struct no_len_str_t {
+      bool operator==(no_len_str_t const &) const = default;
+    };
+    [[no_unique_address]] std::conditional_t<is_fully_static, no_len_str_t, len_str_t> ls;
+
+    // stride of dimension I
+    template <size_t I>
+    [[nodiscard]] FORCEINLINE long stride() const noexcept {
+      if constexpr (is_fully_static)
+        return std::get<I>(static_str);
+      else
+        return std::get<I>(ls.str);
+    }
+
     public:
     // ----------------  Accessors -------------------------
 
@@ -113,7 +156,12 @@ namespace nda {
 
     /// Total number of elements (products of lengths in each dimension).
     // NB recomputed at each call (FIXME Optimize this ?)
-    [[nodiscard]] long size() const noexcept { return std::accumulate(len.cbegin(), len.cend(), 1L, std::multiplies<>{}); }
+    [[nodiscard]] long size() const noexcept {
+      if constexpr (is_fully_static)
+        return ce_size();
+      else
+        return std::accumulate(ls.len.cbegin(), ls.len.cend(), 1L, std::multiplies<>{});
+    }
 
     /// Compile time size, 0 means "dynamical"
     static constexpr long ce_size() noexcept {
@@ -127,24 +175,38 @@ namespace nda {
     }
 
     /// Lengths of each dimension.
-    [[nodiscard]] std::array<long, Rank> const &lengths() const noexcept { return len; }
+    [[nodiscard]] std::array<long, Rank> const &lengths() const noexcept {
+      if constexpr (is_fully_static)
+        return static_len;
+      else
+        return ls.len;
+    }
 
     /// Strides of each dimension.
-    [[nodiscard]] std::array<long, Rank> const &strides() const noexcept { return str; }
+    [[nodiscard]] std::array<long, Rank> const &strides() const noexcept {
+      if constexpr (is_fully_static)
+        return static_str;
+      else
+        return ls.str;
+    }
 
     /// Value of the minimum stride (i.e the fastest one)
-    [[nodiscard]] long min_stride() const noexcept { return str[stride_order[Rank - 1]]; }
+    [[nodiscard]] long min_stride() const noexcept { return strides()[stride_order[Rank - 1]]; }
 
     /// Is the data contiguous in memory ? [NB recomputed at each call]
     [[nodiscard]] bool is_contiguous() const noexcept {
+      if constexpr (is_fully_static) return true;
+      auto const &str   = strides();
       int slowest_index = std::distance(str.begin(), std::max_element(str.begin(), str.end())); // index with minimal stride
-      return (str[slowest_index] * len[slowest_index] == size());
+      return (str[slowest_index] * lengths()[slowest_index] == size());
     }
 
     /// Is the data strided 1d in memory ? [NB recomputed at each call]
     [[nodiscard]] bool is_strided_1d() const noexcept {
+      if constexpr (is_fully_static) return true;
+      auto const &str   = strides();
       int slowest_index = std::distance(str.begin(), std::max_element(str.begin(), str.end())); // index with minimal stride
-      return (str[slowest_index] * len[slowest_index] == size() * min_stride());
+      return (str[slowest_index] * lengths()[slowest_index] == size() * min_stride());
     }
 
     /// Is the order in memory C ?
@@ -165,13 +227,26 @@ namespace nda {
     private:
     // compute strides for a contiguous array from len
     void compute_strides_contiguous() {
-      long s = 1;
-      for (int v = rank() - 1; v >= 0; --v) { // rank() is constexpr, allowing compiler to transform loop...
-        int u  = stride_order[v];
-        str[u] = s;
-        s *= len[u];
+      if constexpr (not is_fully_static) {
+        long s = 1;
+        for (int v = rank() - 1; v >= 0; --v) { // rank() is constexpr, allowing compiler to transform loop...
+          int u     = stride_order[v];
+          ls.str[u] = s;
+          s *= ls.len[u];
+        }
+        ENSURES(s == size());
+      }
+    }
+
+    // Initialize the lengths and the strides. For a fully static layout, they are only checked.
+    void set_len_str(std::array<long, Rank> const &l, std::array<long, Rank> const &s) {
+      if constexpr (is_fully_static) {
+        // NB : the stride of a dimension of length 1 is irrelevant
+        for (int u = 0; u < Rank; ++u) EXPECTS(l[u] == static_len[u] and (l[u] <= 1 or s[u] == static_str[u]));
+      } else {
+        ls.len = l;
+        ls.str = s;
       }
-      ENSURES(s == size());
     }
 
     // FIXME ADD A CHECK layout_prop_e ... compare to stride and
@@ -179,12 +254,13 @@ namespace nda {
     public:
     /// Default constructor. Strides are not initiliazed.
     idx_map() {
-      if constexpr (n_dynamic_extents == 0) { // full static array
-        for (int u = 0; u < Rank; ++u) len[u] = static_extents[u];
+      if constexpr (is_fully_static) { // nothing to store
+      } else if constexpr (n_dynamic_extents == 0) { // static extents, but a non contiguous layout
+        for (int u = 0; u < Rank; ++u) ls.len[u] = static_extents[u];
         compute_strides_contiguous();
       } else {
         for (int u = 0; u < Rank; ++u)
-          len[u] = 0; // FIXME. Needed ? To have the proper invariant of the array : shape = (0,0,...) and pointer is null
+          ls.len[u] = 0; // FIXME. Needed ? To have the proper invariant of the array : shape = (0,0,...) and pointer is null
       }
     }
 
@@ -194,8 +270,9 @@ namespace nda {
     idx_map &operator=(idx_map &&) = default;
 
     /**
-     * Check if the strides of all non-trivial dimensions (l[d] > 1)
-     * respect the stride_order
+     * Check if the strides of all non-trivial dimensions (l[d] > 1 and s[d] != 0)
+     * respect the stride_order.
+     * Dimensions of zero stride (broadcasted) have no memory order.
      * @param lenptr Pointer to the lengths
      * @param strptr Pointer to the strides
      */
@@ -204,7 +281,7 @@ namespace nda {
       auto dims_to_check = std::vector<int>{};
       dims_to_check.reserve(Rank);
       for (auto dim : stride_order)
-        if (lenptr[dim] > 1) dims_to_check.push_back(dim);
+        if (lenptr[dim] > 1 and strptr[dim] != 0) dims_to_check.push_back(dim);
 
       for (int n = 1; n < dims_to_check.size(); ++n)
         if (strptr[dims_to_check[n - 1]] < strptr[dims_to_check[n]]) return false;
@@ -212,14 +289,15 @@ namespace nda {
       return true;
     }
 
-    [[nodiscard]] bool is_stride_order_valid() const { return is_stride_order_valid(len.data(), str.data()); }
+    [[nodiscard]] bool is_stride_order_valid() const { return is_stride_order_valid(lengths().data(), strides().data()); }
 
     /** 
      * From an idxmap with other info flags
      * @param idxm
      */
     template <layout_prop_e P>
-    idx_map(idx_map<Rank, StaticExtents, StrideOrder, P> const &idxm) noexcept : len(idxm.lengths()), str(idxm.strides()) {
+    idx_map(idx_map<Rank, StaticExtents, StrideOrder, P> const &idxm) noexcept {
+      set_len_str(idxm.lengths(), idxm.strides());
       EXPECTS(is_stride_order_valid());
       if constexpr (not layout_property_compatible(P, LayoutProp)) {
         if constexpr (has_contiguous(LayoutProp)) {
@@ -242,7 +320,7 @@ namespace nda {
 // to avoid warning
 #ifndef NDEBUG
         for (int u = 0; u < Rank; ++u)
-          if (static_extents[u] != 0) EXPECTS(static_extents[u] == len[u]);
+          if (static_extents[u] != 0) EXPECTS(static_extents[u] == lengths()[u]);
 #endif
       }
 #endif
@@ -251,7 +329,8 @@ namespace nda {
     public:
     /// Construct from a compatible static_extents
     template <uint64_t SE, layout_prop_e P>
-    idx_map(idx_map<Rank, SE, StrideOrder, P> const &idxm) noexcept(false) : len(idxm.lengths()), str(idxm.strides()) { // can throw
+    idx_map(idx_map<Rank, SE, StrideOrder, P> const &idxm) noexcept(false) { // can throw
+      set_len_str(idxm.lengths(), idxm.strides());
       EXPECTS(is_stride_order_valid());
       if constexpr (not layout_property_compatible(P, LayoutProp)) {
         if constexpr (has_contiguous(LayoutProp)) {
@@ -276,7 +355,8 @@ namespace nda {
 #endif
 
     public:
-    idx_map(std::array<long, Rank> const &shape, std::array<long, Rank> const &strides) noexcept(!check_stride_order) : len(shape), str(strides) {
+    idx_map(std::array<long, Rank> const &shape, std::array<long, Rank> const &strides) noexcept(!check_stride_order) {
+      set_len_str(shape, strides);
       if constexpr (check_stride_order)
         if (not is_stride_order_valid())
           throw std::runtime_error("ERROR: strides of idx_map do not match stride order of the type\n");
@@ -284,9 +364,14 @@ namespace nda {
 
     /// Construct from the shape. If StaticExtents are present, the corresponding component of the shape must be equal to it.
     template <std::integral Int = long>
-    idx_map(std::array<Int, Rank> const &shape) noexcept : len(stdutil::make_std_array<long>(shape)) {
-      assert_static_extents_and_len_are_compatible();
-      compute_strides_contiguous();
+    idx_map(std::array<Int, Rank> const &shape) noexcept {
+      if constexpr (is_fully_static) {
+        for (int u = 0; u < Rank; ++u) EXPECTS(shape[u] == static_len[u]);
+      } else {
+        ls.len = stdutil::make_std_array<long>(shape);
+        assert_static_extents_and_len_are_compatible();
+        compute_strides_contiguous();
+      }
     }
 
     private:
@@ -328,7 +413,7 @@ namespace nda {
       if constexpr (skip_stride and (Is == stride_order[Rank - 1])) // this is the slowest stride
         return arg;
       else
-        return arg * std::get<Is>(str);
+        return arg * stride<Is>();
     }
 
     static constexpr bool smallest_stride_is_one = has_smallest_stride_is_one(LayoutProp);
@@ -342,7 +427,7 @@ namespace nda {
         if constexpr (smallest_stride_is_one)
           return (myget<true, Is>(args) + ...);
         else
-          return ((args * std::get<Is>(str)) + ...);
+          return ((args * stride<Is>()) + ...);
       } else {
         // there is an empty ellipsis to skip
         return (myget<smallest_stride_is_one, (Is < e_pos ? Is : Is - 1)>(args) + ...);
@@ -362,7 +447,11 @@ namespace nda {
     FORCEINLINE long operator()(Args const &...args) const
 #ifdef NDA_ENFORCE_BOUNDCHECK
        noexcept(false) {
-      details::assert_in_bounds(rank(), len.data(), args...);
+      details::assert_in_bounds(rank(), lengths().data(), args...);
+#elif defined(NDA_BOUNDCHECK_HOISTED)
+       noexcept(false) {
+      // the indices of the nda loops have been checked at the loop entry
+      if constexpr (not(details::is_hoisted_index_v<Args> and ...)) details::assert_in_bounds(rank(), lengths().data(), args...);
 #else
        noexcept(true) {
 #endif
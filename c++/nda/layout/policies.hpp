@@ -16,6 +16,7 @@
 
 #pragma once
 #include "idx_map.hpp"
+#include "tiled_idx_map.hpp"
 
 namespace nda {
 
@@ -64,6 +65,16 @@ namespace nda {
     using contiguous_t            = basic_layout<StaticExtents, StrideOrder, layout_prop_e::contiguous>;
   };
 
+  /// Tiles of TileSize^Rank elements, see tiled_idx_map
+  template <int TileSize>
+  struct tiled_layout {
+    template <int Rank>
+    using mapping = tiled_idx_map<Rank, TileSize>;
+
+    using with_lowest_guarantee_t = tiled_layout;
+    using contiguous_t            = tiled_layout;
+  };
+
   template <uint64_t StrideOrder>
   using contiguous_layout_with_stride_order = basic_layout<0, StrideOrder, layout_prop_e::contiguous>;
 
@@ -77,6 +88,11 @@ namespace nda {
       using type = basic_layout<StaticExtents, StrideOrder, LayoutProp>;
     };
 
+    template <int Rank, int TileSize>
+    struct layout_to_policy<tiled_idx_map<Rank, TileSize>> {
+      using type = tiled_layout<TileSize>;
+    };
+
     template <int Rank>
     struct layout_to_policy<idx_map<Rank, 0, C_stride_order<Rank>, layout_prop_e::contiguous>> {
       using type = C_layout;
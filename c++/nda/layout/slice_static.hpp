@@ -230,7 +230,7 @@ namespace nda::slice_static {
   FORCEINLINE auto slice_stride_order_impl(std::index_sequence<Ps...>, std::index_sequence<Ns...>, std::index_sequence<Qs...>, IdxMap const &idxm,
                                            Args const &... args) {
 
-#ifdef NDA_ENFORCE_BOUNDCHECK
+#if defined(NDA_ENFORCE_BOUNDCHECK) or defined(NDA_BOUNDCHECK_HOISTED)
     details::assert_in_bounds(idxm.rank(), idxm.lengths().data(), args...);
 #endif
 
@@ -0,0 +1,180 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+#include "./idx_map.hpp"
+
+namespace nda {
+
+  /**
+   * A tiled (blocked) layout.
+   *
+   * The array is cut into tiles of TileSize^Rank elements. Each tile is stored contiguously, in C order,
+   * and the tiles are stored one after the other, also in C order.
+   * The tiles at the upper boundary of each dimension are truncated (no padding),
+   * so the data occupies exactly size() contiguous elements.
+   *
+   * @tparam Rank The rank
+   * @tparam TileSize The linear size of a tile. Use a power of 2 to make the index computation cheap.
+   *
+   * NB : the layout has no strides, so it does not model the strided layouts used by slices, BLAS, h5, ...
+   * The only view of a tiled array is the full view a().
+   */
+  template <int Rank, int TileSize>
+  class tiled_idx_map {
+    static_assert(TileSize > 0, "The tile size must be > 0");
+
+    std::array<long, Rank> len; // lengths
+    std::array<long, Rank> sfx; // sfx[d] = product of len[e] for e > d
+
+    public:
+    static constexpr int tile_size = TileSize;
+
+    // tiles are in C order, and so are the elements in one tile
+    static constexpr std::array<int, Rank> stride_order = permutations::identity<Rank>();
+    static constexpr uint64_t stride_order_encoded      = encode(stride_order);
+
+    // The data is contiguous, but not in the order of any strided layout :
+    // layout_info does not advertise it, so that no linear loop is used to mix it with a strided array.
+    static constexpr layout_prop_e layout_prop = layout_prop_e::contiguous;
+    static constexpr layout_info_t layout_info = layout_info_t{stride_order_encoded, layout_prop_e::none};
+
+    template <typename T>
+    static constexpr int argument_is_allowed_for_call = std::is_constructible_v<long, T>;
+
+    template <typename T>
+    static constexpr int argument_is_allowed_for_call_or_slice = std::is_constructible_v<long, T>;
+
+    // ----------------  Accessors -------------------------
+
+    /// Rank of the map (number of arguments)
+    static constexpr int rank() noexcept { return Rank; }
+
+    /// Total number of elements (products of lengths in each dimension).
+    [[nodiscard]] long size() const noexcept { return std::accumulate(len.cbegin(), len.cend(), 1L, std::multiplies<>{}); }
+
+    /// Compile time size, 0 means "dynamical"
+    static constexpr long ce_size() noexcept { return 0; }
+
+    /// Lengths of each dimension.
+    [[nodiscard]] std::array<long, Rank> const &lengths() const noexcept { return len; }
+
+    /// The data is always contiguous
+    [[nodiscard]] bool is_contiguous() const noexcept { return true; }
+
+    static constexpr bool is_stride_order_C() { return false; }
+    static constexpr bool is_stride_order_Fortran() { return false; }
+
+    // ----------------  Constructors -------------------------
+
+    private:
+    void compute_suffix_products() {
+      long s = 1;
+      for (int d = Rank - 1; d >= 0; --d) {
+        sfx[d] = s;
+        s *= len[d];
+      }
+    }
+
+    public:
+    tiled_idx_map() {
+      for (int u = 0; u < Rank; ++u) len[u] = 0;
+      compute_suffix_products();
+    }
+
+    /// Construct from the shape
+    template <std::integral Int = long>
+    tiled_idx_map(std::array<Int, Rank> const &shape) noexcept : len(stdutil::make_std_array<long>(shape)) {
+      compute_suffix_products();
+    }
+
+    // ----------------  Call operator -------------------------
+
+    /// The linear position of the element (i0, i1, ...)
+    template <typename... Args>
+    FORCEINLINE long operator()(Args const &...args) const
+#ifdef NDA_ENFORCE_BOUNDCHECK
+       noexcept(false) {
+      details::assert_in_bounds(rank(), len.data(), args...);
+#elif defined(NDA_BOUNDCHECK_HOISTED)
+       noexcept(false) {
+      if constexpr (not(details::is_hoisted_index_v<Args> and ...)) details::assert_in_bounds(rank(), len.data(), args...);
+#else
+       noexcept(true) {
+#endif
+      static_assert(sizeof...(Args) == Rank, "Incorrect number of arguments");
+      std::array<long, Rank> idx{long(args)...};
+      long offset = 0, h_prod = 1, inner = 0;
+      for (int d = 0; d < Rank; ++d) {
+        long t = idx[d] / TileSize, r = idx[d] % TileSize;
+        long h = std::min(long(TileSize), len[d] - t * TileSize); // extent of the tile in dimension d
+        // elements in the tiles before, with the same tile indices in the dimensions < d
+        offset += h_prod * t * TileSize * sfx[d];
+        h_prod *= h;
+        inner = inner * h + r;
+      }
+      return offset + inner;
+    }
+
+    // ----------------  Comparison -------------------------
+
+    bool operator==(tiled_idx_map const &x) const = default;
+  };
+
+  // ----------------  for_each_tiled  -------------------------
+
+  namespace details {
+
+    // The loop of for_each_tiled, with hoisted indices if Hoisted (see hoisted_index)
+    template <int TileSize, bool Hoisted, typename F, auto R, std::integral Int = long>
+    void for_each_tiled_impl(std::array<Int, R> const &idx_lengths, F &&f) {
+      std::array<long, R> n_tiles;
+      for (int d = 0; d < int(R); ++d) n_tiles[d] = (idx_lengths[d] + TileSize - 1) / TileSize;
+
+      nda::for_each(n_tiles, [&](auto const &...ts) {
+        std::array<long, R> start{long(ts) * TileSize...}, h;
+        for (int d = 0; d < int(R); ++d) h[d] = std::min(long(TileSize), long(idx_lengths[d]) - start[d]);
+        [&]<size_t... Is>(std::index_sequence<Is...>) {
+          nda::for_each(h, [&](auto const &...is) { f(details::loop_index<Hoisted>(start[Is] + is)...); });
+        }
+        (std::make_index_sequence<R>{});
+      });
+    }
+
+  } // namespace details
+
+  /**
+   * A loop over all indices, tile by tile : the tiles of size TileSize^R in C order, and C order inside each tile.
+   * It is the memory order of tiled_idx_map<R, TileSize>, and a blocked (cache friendly) order for any strided layout.
+   */
+  template <int TileSize, typename F, auto R, std::integral Int = long>
+  void for_each_tiled(std::array<Int, R> const &idx_lengths, F &&f) {
+    details::for_each_tiled_impl<TileSize, false>(idx_lengths, f);
+  }
+
+  // ----------------  get_tile_size  -------------------------
+
+  /// The tile size of the layout of an array, or 0 if the layout is not tiled
+  template <typename A>
+  inline constexpr int get_tile_size = 0;
+
+  template <typename A>
+  requires requires { std::decay_t<A>::layout_t::tile_size; }
+  inline constexpr int get_tile_size<A> = std::decay_t<A>::layout_t::tile_size;
+
+} // namespace nda
@@ -176,4 +176,63 @@ namespace nda {
     return map_layout_transform(std::forward<A>(a), new_lay_t{stdutil::join(lay.lengths(), shap1111), stdutil::join(lay.strides(), shap1111)});
   }
 
+  // --------------- Broadcasting------------------------
+
+  namespace impl {
+
+    // stride order of a rank R layout, with N new slowest dimensions in front
+    template <int N, auto R>
+    constexpr std::array<int, R + N> complete_stride_order_with_slow(std::array<int, R> const &a) {
+      auto r = stdutil::make_initialized_array<R + N>(0);
+      for (int i = 0; i < N; ++i) r[i] = i;
+      for (int i = 0; i < R; ++i) r[N + i] = a[i] + N;
+      return r;
+    }
+  } // namespace impl
+
+  /**
+   * Broadcast a view to a new shape, following the numpy rules, without copy
+   *
+   * The dimensions of a are aligned with the last dimensions of new_shape. Each of them must either match
+   * the corresponding extent of new_shape, or be 1, in which case it is repeated with a zero stride.
+   * The new leading dimensions are also repeated with a zero stride.
+   *
+   * @param a The view to broadcast
+   * @param new_shape The new shape, of rank >= the rank of a
+   * @return A const view of shape new_shape. Elements which are repeated share the same memory.
+   *
+   * @example
+   *    array<double, 2> A(3, 4);
+   *    array<double, 1> v(4);
+   *    A += broadcast_to(v, A.shape()); // adds v to each row of A
+   */
+  template <typename T, int R, typename L, char Algebra, typename AccessorPolicy, typename OwningPolicy, std::integral Int, auto NewRank>
+  auto broadcast_to(basic_array_view<T, R, L, Algebra, AccessorPolicy, OwningPolicy> a, std::array<Int, NewRank> const &new_shape) {
+    static_assert(NewRank >= R, "broadcast_to : the new rank must be at least the rank of the array");
+    static constexpr int N = NewRank - R;
+
+    using lay_t                                        = typename basic_array_view<T, R, L, Algebra, AccessorPolicy, OwningPolicy>::layout_t;
+    static constexpr uint64_t new_stride_order_encoded = encode(impl::complete_stride_order_with_slow<N>(lay_t::stride_order));
+    using new_lay_t                                    = idx_map<NewRank, 0, new_stride_order_encoded, layout_prop_e::none>;
+
+    std::array<long, NewRank> len, str;
+    for (int u = 0; u < N; ++u) {
+      len[u] = new_shape[u];
+      str[u] = 0;
+    }
+    for (int u = 0; u < R; ++u) {
+      long l = a.extent(u);
+      len[N + u] = new_shape[N + u];
+      EXPECTS_WITH_MESSAGE((l == len[N + u]) or (l == 1),
+                           "broadcast_to : incompatible extent " << l << " in dimension " << u << " for the new extent " << len[N + u]);
+      str[N + u] = (l == len[N + u] ? a.indexmap().strides()[u] : 0);
+    }
+    return map_layout_transform(basic_array_view<std::add_const_t<T>, R, L, Algebra, AccessorPolicy, OwningPolicy>{a}, new_lay_t{len, str});
+  }
+
+  template <typename T, int R, typename L, char Algebra, typename ContainerPolicy, std::integral Int, auto NewRank>
+  auto broadcast_to(basic_array<T, R, L, Algebra, ContainerPolicy> const &a, std::array<Int, NewRank> const &new_shape) {
+    return broadcast_to(basic_array_view<T const, R, L, Algebra, default_accessor, borrowed>(a), new_shape);
+  }
+
 } // namespace nda
@@ -21,7 +21,13 @@
 #include "lapack.hpp"
 #include "blas.hpp"
 
+#include "linalg/block_diagonal.hpp"
 #include "linalg/cross_product.hpp"
 #include "linalg/det_and_inverse.hpp"
+#include "linalg/einsum.hpp"
 #include "linalg/eigenelements.hpp"
+#include "linalg/eigensolvers.hpp"
+#include "linalg/kron.hpp"
+#include "linalg/linear_solvers.hpp"
 #include "linalg/matmul.hpp"
+#include "linalg/matrix_function.hpp"
@@ -0,0 +1,309 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "../exec.hpp"
+#include "./det_and_inverse.hpp"
+#include "./eigenelements.hpp"
+#include "./matmul.hpp"
+
+namespace nda {
+
+  /**
+   * The structure of a block diagonal matrix : the dimensions of its square blocks.
+   *
+   * It gives the position of each block in the full matrix, and in the arena, where the blocks are stored
+   * one after the other, each in C order.
+   */
+  class block_structure {
+    std::vector<long> _dims, _offsets, _arena_offsets;
+
+    public:
+    block_structure() : _offsets{0}, _arena_offsets{0} {}
+
+    /// Construct from the dimensions of the blocks
+    explicit block_structure(std::vector<long> dims) : _dims(std::move(dims)), _offsets{0}, _arena_offsets{0} {
+      for (auto d : _dims) {
+        EXPECTS_WITH_MESSAGE(d >= 0, "block_structure : negative block dimension " << d);
+        _offsets.push_back(_offsets.back() + d);
+        _arena_offsets.push_back(_arena_offsets.back() + d * d);
+      }
+    }
+
+    /// Number of blocks
+    [[nodiscard]] long n_blocks() const noexcept { return _dims.size(); }
+
+    /// Dimension of the block b
+    [[nodiscard]] long block_dim(long b) const noexcept { return _dims[b]; }
+
+    /// Dimensions of the blocks
+    [[nodiscard]] std::vector<long> const &block_dims() const noexcept { return _dims; }
+
+    /// Position of the first row/column of the block b in the full matrix
+    [[nodiscard]] long offset(long b) const noexcept { return _offsets[b]; }
+
+    /// Position of the block b in the arena
+    [[nodiscard]] long arena_offset(long b) const noexcept { return _arena_offsets[b]; }
+
+    /// Number of elements of all the blocks
+    [[nodiscard]] long arena_size() const noexcept { return _arena_offsets.back(); }
+
+    /// Dimension of the full matrix
+    [[nodiscard]] long dim() const noexcept { return _offsets.back(); }
+
+    bool operator==(block_structure const &) const = default;
+  };
+
+  namespace details {
+
+    // Call f(b) for all blocks, in parallel (nda::exec).
+    // The blocks have different sizes : one block per chunk, the largest blocks first, the idle workers steal the others.
+    // An exception thrown for a block is rethrown after the loop.
+    template <typename F>
+    void for_each_block(block_structure const &bs, F &&f) {
+      long n = bs.n_blocks();
+      std::vector<long> order(n);
+      std::iota(order.begin(), order.end(), 0);
+      std::stable_sort(order.begin(), order.end(), [&bs](long a, long b) { return bs.block_dim(a) > bs.block_dim(b); });
+      exec::parallel_for(n, [&](long u) { f(order[u]); }, 1);
+    }
+
+  } // namespace details
+
+  /**
+   * A block diagonal matrix, e.g. an operator which conserves a quantum number, one block per symmetry sector.
+   *
+   * All the blocks are stored contiguously in one arena. The linear algebra (matmul, inverse, determinant,
+   * eigenelements) is done block by block, in parallel over the blocks (nda::exec),
+   * so its cost is the sum of the costs of the blocks.
+   *
+   * @tparam T The value type
+   */
+  template <typename T>
+  class block_diagonal_matrix {
+    block_structure _bs;
+    array<T, 1> _arena;
+
+    public:
+    using value_type = T;
+
+    block_diagonal_matrix() = default;
+
+    /// Construct with a given block structure. The elements are not initialized.
+    explicit block_diagonal_matrix(block_structure bs) : _bs(std::move(bs)), _arena(_bs.arena_size()) {}
+
+    /// Construct from the blocks
+    explicit block_diagonal_matrix(std::vector<matrix<T>> const &blocks) {
+      std::vector<long> dims;
+      for (auto const &m : blocks) {
+        EXPECTS(is_matrix_square(m, true));
+        dims.push_back(m.extent(0));
+      }
+      _bs    = block_structure{std::move(dims)};
+      _arena = array<T, 1>(_bs.arena_size());
+      for (long b = 0; b < n_blocks(); ++b) block(b) = blocks[b];
+    }
+
+    /// Assign a scalar : s on the diagonal of each block, 0 elsewhere
+    block_diagonal_matrix &operator=(T const &s) {
+      for (long b = 0; b < n_blocks(); ++b) block(b) = s;
+      return *this;
+    }
+
+    // ------------------ Accessors ------------------
+
+    [[nodiscard]] block_structure const &structure() const noexcept { return _bs; }
+
+    [[nodiscard]] long n_blocks() const noexcept { return _bs.n_blocks(); }
+
+    /// Shape of the full matrix
+    [[nodiscard]] std::array<long, 2> shape() const noexcept { return {_bs.dim(), _bs.dim()}; }
+
+    /// The block b, as a view in the arena
+    [[nodiscard]] matrix_view<T> block(long b) {
+      long d = _bs.block_dim(b);
+      return {std::array<long, 2>{d, d}, _arena.data() + _bs.arena_offset(b)};
+    }
+
+    /// The block b, as a view in the arena
+    [[nodiscard]] matrix_const_view<T> block(long b) const {
+      long d = _bs.block_dim(b);
+      return {std::array<long, 2>{d, d}, _arena.data() + _bs.arena_offset(b)};
+    }
+
+    /// All the elements of the blocks
+    [[nodiscard]] array<T, 1> const &arena() const noexcept { return _arena; }
+    [[nodiscard]] auto arena() noexcept { return _arena(); }
+
+    // ------------------ Arithmetic on the arena ------------------
+
+    block_diagonal_matrix &operator+=(block_diagonal_matrix const &x) {
+      EXPECTS(_bs == x._bs);
+      _arena += x._arena;
+      return *this;
+    }
+
+    block_diagonal_matrix &operator-=(block_diagonal_matrix const &x) {
+      EXPECTS(_bs == x._bs);
+      _arena -= x._arena;
+      return *this;
+    }
+
+    block_diagonal_matrix &operator*=(T const &s) {
+      _arena *= s;
+      return *this;
+    }
+
+    friend block_diagonal_matrix operator+(block_diagonal_matrix x, block_diagonal_matrix const &y) { return x += y; }
+    friend block_diagonal_matrix operator-(block_diagonal_matrix x, block_diagonal_matrix const &y) { return x -= y; }
+    friend block_diagonal_matrix operator*(block_diagonal_matrix x, T const &s) { return x *= s; }
+    friend block_diagonal_matrix operator*(T const &s, block_diagonal_matrix x) { return x *= s; }
+
+    bool operator==(block_diagonal_matrix const &) const = default;
+  };
+
+  template <typename T>
+  inline constexpr bool is_block_diagonal_matrix_v = false;
+
+  template <typename T>
+  inline constexpr bool is_block_diagonal_matrix_v<block_diagonal_matrix<T>> = true;
+
+  // ----------------  Conversion to dense -------------------------
+
+  /// The dense matrix
+  template <typename T>
+  matrix<T> to_dense(block_diagonal_matrix<T> const &a) {
+    matrix<T> r(a.shape());
+    r()            = 0;
+    auto const &bs = a.structure();
+    for (long b = 0; b < a.n_blocks(); ++b) {
+      auto R = range(bs.offset(b), bs.offset(b + 1));
+      r(R, R) = a.block(b);
+    }
+    return r;
+  }
+
+  // ----------------  Products -------------------------
+
+  /// Product of two block diagonal matrices with the same block structure, block by block
+  template <typename L, typename R>
+  auto matmul(L &&l, R &&r) requires(is_block_diagonal_matrix_v<std::decay_t<L>> and is_block_diagonal_matrix_v<std::decay_t<R>>) {
+    using T = typename std::decay_t<L>::value_type;
+    static_assert(std::is_same_v<T, typename std::decay_t<R>::value_type>, "matmul : the block diagonal matrices must have the same value type");
+    EXPECTS_WITH_MESSAGE(l.structure() == r.structure(), "matmul : the block diagonal matrices have different block structures");
+
+    block_diagonal_matrix<T> res(l.structure());
+    details::for_each_block(l.structure(), [&](long b) {
+      if constexpr (blas::is_blas_lapack_v<T>) {
+        if (l.structure().block_dim(b) > 0) blas::gemm(1, l.block(b), r.block(b), 0, res.block(b));
+      } else {
+        auto rb = res.block(b);
+        blas::gemm_generic(1, l.block(b), r.block(b), 0, rb);
+      }
+    });
+    return res;
+  }
+
+  template <typename T>
+  block_diagonal_matrix<T> operator*(block_diagonal_matrix<T> const &l, block_diagonal_matrix<T> const &r) {
+    return matmul(l, r);
+  }
+
+  /// Product of a block diagonal matrix with a vector
+  template <typename T, ArrayOfRank<1> X>
+  vector<T> operator*(block_diagonal_matrix<T> const &a, X const &x) {
+    EXPECTS(a.shape()[1] == x.shape()[0]);
+    if constexpr (not MemoryArray<X>) {
+      return a * make_regular(x);
+    } else {
+      vector<T> y(a.shape()[0]);
+      auto const &bs = a.structure();
+      details::for_each_block(bs, [&](long b) {
+        auto R = range(bs.offset(b), bs.offset(b + 1));
+        y(R)   = matvecmul(a.block(b), x(R));
+      });
+      return y;
+    }
+  }
+
+  // ----------------  Inverse, determinant -------------------------
+
+  /// Inverse, block by block
+  template <typename T>
+  void inverse_in_place(block_diagonal_matrix<T> &a) {
+    details::for_each_block(a.structure(), [&](long b) { inverse_in_place(a.block(b)); });
+  }
+
+  /// Inverse, block by block
+  template <typename T>
+  block_diagonal_matrix<T> inverse(block_diagonal_matrix<T> const &a) {
+    auto r = a;
+    inverse_in_place(r);
+    return r;
+  }
+
+  /// Determinant : the product of the determinants of the blocks
+  template <typename T>
+  T determinant(block_diagonal_matrix<T> const &a) {
+    std::vector<T> dets(a.n_blocks());
+    details::for_each_block(a.structure(), [&](long b) { dets[b] = T(determinant(a.block(b))); });
+    return std::accumulate(dets.begin(), dets.end(), T{1}, std::multiplies<>{});
+  }
+
+} // namespace nda
+
+namespace nda::linalg {
+
+  /**
+   * Eigenvalues and eigenvectors of a symmetric(real) or hermitian(complex) block diagonal matrix, block by block
+   *
+   * @return Pair consisting of the eigenvalues, block after block (sorted within each block only),
+   *         and the block diagonal matrix of the eigenvectors (as columns of the blocks)
+   */
+  template <typename T>
+  std::pair<array<double, 1>, block_diagonal_matrix<T>> eigenelements(block_diagonal_matrix<T> const &a) {
+    auto const &bs = a.structure();
+    array<double, 1> ev(bs.dim());
+    block_diagonal_matrix<T> vecs(bs);
+    details::for_each_block(bs, [&](long b) {
+      if (bs.block_dim(b) == 0) return;
+      auto m_copy                               = matrix<T, F_layout>(a.block(b));
+      ev(range(bs.offset(b), bs.offset(b + 1))) = _eigen_element_impl(m_copy, 'V');
+      vecs.block(b)                             = m_copy;
+    });
+    return {ev, vecs};
+  }
+
+  /**
+   * Eigenvalues of a symmetric(real) or hermitian(complex) block diagonal matrix, block by block
+   *
+   * @return The eigenvalues, block after block (sorted within each block only)
+   */
+  template <typename T>
+  array<double, 1> eigenvalues(block_diagonal_matrix<T> const &a) {
+    auto const &bs = a.structure();
+    array<double, 1> ev(bs.dim());
+    details::for_each_block(bs, [&](long b) {
+      if (bs.block_dim(b) == 0) return;
+      auto m_copy                               = matrix<T, F_layout>(a.block(b));
+      ev(range(bs.offset(b), bs.offset(b + 1))) = _eigen_element_impl(m_copy, 'N');
+    });
+    return ev;
+  }
+
+} // namespace nda::linalg
@@ -0,0 +1,270 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <type_traits>
+
+#include "./eigenelements.hpp"
+#include "./krylov_tools.hpp"
+
+/*
+ * Matrix free iterative eigensolvers for hermitian operators : thick restart Lanczos and Davidson.
+ *
+ * The operator is given by a callable op, applied to one vector or to a block of vectors (see krylov_tools.hpp).
+ * The basis is stored in a matrix<T, F_layout> (one vector per column), and the orthogonalization
+ * and Rayleigh-Ritz steps are done with blas::gemv and blas::gemm.
+ */
+
+namespace nda::linalg {
+
+  /// Parameters of the iterative eigensolvers
+  struct eigensolver_params {
+
+    /// Number of wanted eigenpairs
+    long n_eigen = 1;
+
+    /// 'S' for the smallest eigenvalues, 'L' for the largest ones
+    char which = 'S';
+
+    /// Maximal dimension of the subspace, before a restart. 0 : chosen from n_eigen
+    long max_subspace = 0;
+
+    /// Maximal number of iterations : restarts for lanczos, subspace expansions for davidson
+    long max_iterations = 1000;
+
+    /// Convergence criterion : ||A x - lambda x|| < tolerance * max(1, |lambda|) for all wanted eigenpairs
+    double tolerance = 1.e-10;
+  };
+
+  /// Result of the iterative eigensolvers
+  template <typename T>
+  struct eigensolver_result {
+
+    /// The eigenvalues, the wanted one first (i.e. increasing for 'S', decreasing for 'L')
+    array<double, 1> eigenvalues;
+
+    /// The eigenvectors as columns, in the order of the eigenvalues
+    matrix<T, F_layout> eigenvectors;
+
+    /// The residual norms ||A x - lambda x||
+    array<double, 1> residuals;
+
+    /// Number of iterations, number of applications of the operator on a vector
+    long n_iterations = 0, n_matvec = 0;
+
+    bool converged = false;
+  };
+
+  namespace eigensolver_details {
+
+    // Position of the i-th wanted eigenvalue among m eigenvalues sorted in increasing order
+    inline long wanted(long i, long m, char which) { return (which == 'S' ? i : m - 1 - i); }
+
+    // The columns of Y for the first k wanted eigenvalues
+    template <typename T>
+    matrix<T, F_layout> wanted_columns(matrix<T, F_layout> const &Y, long k, char which) {
+      matrix<T, F_layout> r(Y.extent(0), k);
+      for (long i = 0; i < k; ++i) r(_, i) = Y(_, wanted(i, Y.extent(1), which));
+      return r;
+    }
+
+    inline void check_params(eigensolver_params const &p, long n, long m_max) {
+      EXPECTS_WITH_MESSAGE(p.which == 'S' or p.which == 'L', "eigensolver : which must be 'S' or 'L', not " << p.which);
+      EXPECTS_WITH_MESSAGE(p.n_eigen >= 1 and p.n_eigen <= n, "eigensolver : incorrect number of eigenpairs " << p.n_eigen);
+      EXPECTS_WITH_MESSAGE(m_max > p.n_eigen or m_max == n, "eigensolver : the subspace dimension " << m_max << " is too small");
+    }
+
+  } // namespace eigensolver_details
+
+  /**
+   * Thick restart Lanczos, with full reorthogonalization.
+   *
+   * Finds the p.n_eigen extremal eigenpairs of the hermitian operator op of dimension n.
+   * The Krylov basis has at most p.max_subspace vectors (default max(2 n_eigen + 10, 20)). At a restart, the basis
+   * is contracted to the best Ritz vectors, and the Lanczos recursion continues from the last residual vector.
+   *
+   * @tparam T The value type (double or dcomplex)
+   * @param op The operator, see above
+   * @param n The dimension of the vector space
+   * @param p The parameters
+   * @param v0 The starting vector. If empty, a random vector.
+   */
+  template <typename T, typename Op>
+  eigensolver_result<T> lanczos(Op const &op, long n, eigensolver_params const &p = {}, array<T, 1> const &v0 = {}) {
+    using namespace krylov_details;
+    using namespace eigensolver_details;
+    long k     = p.n_eigen;
+    long m_max = std::min(n, (p.max_subspace > 0 ? p.max_subspace : std::max(2 * k + 10, 20l)));
+    check_params(p, n, m_max);
+
+    basis_t<T> V(n, m_max + 1), w(n, 1);
+    matrix<T, F_layout> H(m_max, m_max);
+    H() = 0;
+
+    V(_, 0) = (v0.empty() ? random_vector<T>(n) : vector<T>{v0});
+    V(_, 0) /= norm(V(_, 0));
+
+    eigensolver_result<T> res;
+    long j0 = 0; // number of vectors kept at the last restart
+    for (res.n_iterations = 0;; ++res.n_iterations) {
+
+      // Lanczos expansion from j0 to m_max. NB : the coefficients are stored in the upper triangle of H only
+      double beta = 0;
+      for (long j = j0; j < m_max; ++j) {
+        apply<T>(op, V(_, range(j, j + 1)), w());
+        ++res.n_matvec;
+        auto wj               = w(_, 0);
+        H(range(0, j + 1), j) = orthogonalize(V, j + 1, wj);
+        beta                  = norm(wj);
+        if (beta > 1.e-14 * std::max(1.0, std::abs(H(j, j)))) {
+          V(_, j + 1) = wj / beta;
+        } else { // invariant subspace : continue with a random vector, orthogonal to the basis
+          beta        = 0;
+          vector<T> r = random_vector<T>(n);
+          orthogonalize(V, j + 1, r);
+          double nr   = norm(r);
+          V(_, j + 1) = (nr > 1.e-10 ? vector<T>{r / nr} : vector<T>{r * 0});
+        }
+      }
+
+      // Ritz pairs. The residual of a Ritz pair is beta times the last component of its Ritz vector.
+      auto [theta, Y] = eigenelements(H);
+      res.residuals   = array<double, 1>(k);
+      res.eigenvalues = array<double, 1>(k);
+      res.converged   = true;
+      for (long i = 0; i < k; ++i) {
+        long u             = wanted(i, m_max, p.which);
+        res.eigenvalues(i) = theta(u);
+        res.residuals(i)   = beta * std::abs(Y(m_max - 1, u));
+        res.converged &= (res.residuals(i) < p.tolerance * std::max(1.0, std::abs(theta(u))));
+      }
+
+      if (res.converged or res.n_iterations >= p.max_iterations) {
+        res.eigenvectors = combine(V, m_max, wanted_columns(matrix<T, F_layout>{Y}, k, p.which));
+        return res;
+      }
+
+      // Thick restart : keep the best Ritz vectors and the residual vector
+      j0                 = std::min(m_max - 1, k + (m_max - k) / 2);
+      auto Yk            = wanted_columns(matrix<T, F_layout>{Y}, j0, p.which);
+      V(_, range(0, j0)) = combine(V, m_max, Yk);
+      V(_, j0)           = V(_, m_max);
+      H()                = 0;
+      for (long i = 0; i < j0; ++i) H(i, i) = theta(wanted(i, m_max, p.which));
+    }
+  }
+
+  /**
+   * Davidson, with a diagonal preconditioner (a block method : one correction vector per unconverged eigenpair).
+   *
+   * Finds the p.n_eigen extremal eigenpairs of the hermitian operator op of dimension n.
+   * The correction vectors are the residuals r preconditioned by (lambda - D)^-1, where D is the diagonal of the operator
+   * (if given, otherwise no preconditioner). At most p.max_subspace vectors are kept (default max(4 n_eigen, 20)),
+   * after which the basis is contracted to the current Ritz vectors.
+   *
+   * @tparam T The value type (double or dcomplex)
+   * @param op The operator, see above
+   * @param n The dimension of the vector space
+   * @param p The parameters
+   * @param diagonal The diagonal of the operator, for the preconditioner. If empty, no preconditioner.
+   */
+  template <typename T, typename Op>
+  eigensolver_result<T> davidson(Op const &op, long n, eigensolver_params const &p = {}, array<double, 1> const &diagonal = {}) {
+    using namespace krylov_details;
+    using namespace eigensolver_details;
+    long k     = p.n_eigen;
+    long m_max = std::min(n, (p.max_subspace > 0 ? p.max_subspace : std::max(4 * k, 20l)));
+    check_params(p, n, m_max);
+    EXPECTS(diagonal.empty() or diagonal.size() == n);
+
+    basis_t<T> V(n, m_max), W(n, m_max);
+
+    // a random orthonormal starting block
+    long m = 0;
+    while (m < k) {
+      vector<T> r = random_vector<T>(n);
+      orthogonalize(V, m, r);
+      double nr = norm(r);
+      if (nr < 1.e-10) continue;
+      V(_, m++) = r / nr;
+    }
+    apply<T>(op, V(_, range(0, m)), W(_, range(0, m)));
+
+    eigensolver_result<T> res;
+    res.n_matvec = m;
+    for (res.n_iterations = 0;; ++res.n_iterations) {
+
+      // Rayleigh-Ritz
+      auto [theta, Y] = eigenelements(project(V, W, m));
+      auto Yk         = wanted_columns(matrix<T, F_layout>{Y}, k, p.which);
+      auto X          = combine(V, m, Yk);
+      auto R          = combine(W, m, Yk); // A X
+
+      res.eigenvalues = array<double, 1>(k);
+      res.residuals   = array<double, 1>(k);
+      res.converged   = true;
+      std::vector<long> unconverged;
+      for (long i = 0; i < k; ++i) {
+        double lambda      = theta(wanted(i, m, p.which));
+        res.eigenvalues(i) = lambda;
+        R(_, i) -= lambda * X(_, i);
+        res.residuals(i) = norm(R(_, i));
+        if (res.residuals(i) >= p.tolerance * std::max(1.0, std::abs(lambda))) {
+          res.converged = false;
+          unconverged.push_back(i);
+        }
+      }
+
+      if (res.converged or res.n_iterations >= p.max_iterations or m == n) {
+        res.eigenvectors = std::move(X);
+        return res;
+      }
+
+      // Restart : contract the basis to the Ritz vectors
+      if (m + long(unconverged.size()) > m_max) {
+        W(_, range(0, k)) = combine(W, m, Yk);
+        V(_, range(0, k)) = X;
+        m                 = k;
+      }
+
+      // Correction vectors
+      long m_old = m;
+      for (long i : unconverged) {
+        vector<T> t = R(_, i);
+        if (not diagonal.empty()) {
+          double lambda = res.eigenvalues(i);
+          for (long u = 0; u < n; ++u) {
+            double d = lambda - diagonal(u);
+            t(u) /= (std::abs(d) > 1.e-8 ? d : std::copysign(1.e-8, d));
+          }
+        }
+        orthogonalize(V, m, t);
+        double nt = norm(t);
+        if (nt < 1.e-12 * std::max(1.0, norm(R(_, i)))) continue;
+        V(_, m++) = t / nt;
+        if (m == m_max) break;
+      }
+      if (m == m_old) { // no new direction : stagnation
+        res.eigenvectors = std::move(X);
+        return res;
+      }
+      apply<T>(op, V(_, range(m_old, m)), W(_, range(m_old, m)));
+      res.n_matvec += m - m_old;
+    }
+  }
+
+} // namespace nda::linalg
@@ -0,0 +1,662 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "../basic_functions.hpp"
+#include "../blas/tools.hpp"
+#include "../blas/interface/cxx_interface.hpp"
+
+namespace nda {
+
+  // -------------------------------------------------------------------------------------------
+  //                         Index labels and parsing of the specification
+  // -------------------------------------------------------------------------------------------
+
+  namespace einsum_details {
+
+    // Maximal number of labels in one operand (or in the union of the two operands of a pairwise contraction)
+    inline constexpr int max_labels = 32;
+
+    // Maximal number of operands in one einsum
+    inline constexpr int max_operands = 8;
+
+    // An ordered list of index labels, e.g. "ijk". Structural, hence usable as a template parameter.
+    struct labels_t {
+      std::array<char, max_labels> c{};
+      int n = 0;
+
+      [[nodiscard]] constexpr int find(char x) const {
+        for (int i = 0; i < n; ++i)
+          if (c[i] == x) return i;
+        return -1;
+      }
+      [[nodiscard]] constexpr bool contains(char x) const { return find(x) >= 0; }
+      [[nodiscard]] constexpr int size() const { return n; }
+      constexpr void push_back(char x) {
+        if (n == max_labels) throw "einsum : too many index labels";
+        c[n++] = x;
+      }
+      constexpr char operator[](int i) const { return c[i]; }
+      constexpr bool operator==(labels_t const &) const = default;
+    };
+
+    constexpr bool is_label(char x) { return (x >= 'a' and x <= 'z') or (x >= 'A' and x <= 'Z'); }
+
+  } // namespace einsum_details
+
+  /**
+   * The specification of a contraction in numpy's einsum notation, e.g. "abk,kc->abc".
+   *
+   * Each operand is described by one label per index, operands are separated by a ','.
+   * Labels of the result are given after '->'. If '->' is absent, the result consists of the labels
+   * appearing exactly once, in alphabetical order (as in numpy).
+   *
+   * Every label not in the result is summed over. Parsed at compile time, so that the rank of the result is known.
+   *
+   * Limitations : repeated labels within one operand (diagonals) and ellipsis are not supported.
+   */
+  template <size_t N>
+  struct einsum_spec {
+    std::array<einsum_details::labels_t, einsum_details::max_operands> inputs{};
+    int n_inputs = 0;
+    einsum_details::labels_t output{};
+
+    constexpr einsum_spec(const char (&s)[N]) { // NOLINT : implicit on purpose, einsum<"ij,jk->ik">
+      using einsum_details::is_label;
+      int i = 0;
+      n_inputs = 1;
+      for (; i < int(N) - 1; ++i) {
+        char x = s[i];
+        if (x == ' ') continue;
+        if (x == '-') break;
+        if (x == ',') {
+          if (++n_inputs > einsum_details::max_operands) throw "einsum : too many operands";
+          continue;
+        }
+        if (not is_label(x)) throw "einsum : labels must be letters";
+        if (inputs[n_inputs - 1].contains(x)) throw "einsum : repeated label within one operand is not supported";
+        inputs[n_inputs - 1].push_back(x);
+      }
+
+      if (i < int(N) - 1) { // explicit result
+        if (i + 1 >= int(N) - 1 or s[i + 1] != '>') throw "einsum : expected '->'";
+        for (i += 2; i < int(N) - 1; ++i) {
+          char x = s[i];
+          if (x == ' ') continue;
+          if (not is_label(x)) throw "einsum : labels must be letters";
+          if (output.contains(x)) throw "einsum : repeated label in the result";
+          output.push_back(x);
+        }
+      } else { // implicit result : labels appearing once, in alphabetical order
+        for (char x = 'A'; x <= 'z'; ++x) {
+          if (not is_label(x)) continue;
+          int count = 0;
+          for (int u = 0; u < n_inputs; ++u) count += (inputs[u].contains(x) ? 1 : 0);
+          if (count == 1) output.push_back(x);
+        }
+      }
+
+      for (int u = 0; u < output.n; ++u) {
+        bool found = false;
+        for (int v = 0; v < n_inputs; ++v) found = found or inputs[v].contains(output[u]);
+        if (not found) throw "einsum : a label of the result is absent from all operands";
+      }
+    }
+  };
+
+  namespace einsum_details {
+
+    // -------------------------------------------------------------------------------------------
+    //                                 Runtime description of a tensor
+    // -------------------------------------------------------------------------------------------
+
+    // A strided tensor seen through its labels : data, lengths and strides (in the order of the labels)
+    template <typename T>
+    struct tensor_desc {
+      T *data = nullptr;
+      labels_t labels;
+      std::array<long, max_labels> len{}, str{};
+
+      [[nodiscard]] long extent(char x) const {
+        int p = labels.find(x);
+        return (p < 0 ? 1 : len[p]);
+      }
+      [[nodiscard]] long stride(char x) const {
+        int p = labels.find(x);
+        return (p < 0 ? 0 : str[p]);
+      }
+      [[nodiscard]] long size() const {
+        long s = 1;
+        for (int u = 0; u < labels.n; ++u) s *= len[u];
+        return s;
+      }
+    };
+
+    // Make the descriptor of a basic_array or basic_array_view
+    template <typename T, typename A>
+    tensor_desc<T> make_desc(A &&a, labels_t const &l) {
+      tensor_desc<T> d{a.data(), l};
+      auto const &sh = a.indexmap().lengths();
+      auto const &st = a.indexmap().strides();
+      for (int u = 0; u < l.n; ++u) {
+        d.len[u] = sh[u];
+        d.str[u] = st[u];
+      }
+      return d;
+    }
+
+    // Descriptor of a contiguous C ordered tensor with the given labels and extents, using memory at p
+    template <typename T>
+    tensor_desc<T> make_contiguous_desc(T *p, labels_t const &l, auto const &extent_of) {
+      tensor_desc<T> d{p, l};
+      long s = 1;
+      for (int u = l.n - 1; u >= 0; --u) {
+        d.len[u] = extent_of(l[u]);
+        d.str[u] = s;
+        s *= d.len[u];
+      }
+      return d;
+    }
+
+    // -------------------------------------------------------------------------------------------
+    //                                    Strided loops and copies
+    // -------------------------------------------------------------------------------------------
+
+    // Calls f(o[0], ..., o[NT-1]) for all index tuples of lengths len[0..rank[,
+    // where o[t] is the offset in tensor t computed with the strides str[t][...].
+    // The last index is the fastest.
+    template <int NT, typename F>
+    void for_each_offset(int rank, long const *len, std::array<long const *, NT> const &str, F &&f) {
+      for (int u = 0; u < rank; ++u)
+        if (len[u] == 0) return;
+
+      std::array<long, max_labels> idx{};
+      std::array<long, NT> o{};
+      if (rank == 0) {
+        std::apply(f, o);
+        return;
+      }
+      long const n_last = len[rank - 1];
+      while (true) {
+        // inner loop on the fastest index
+        auto o2 = o;
+        for (long i = 0; i < n_last; ++i) {
+          std::apply(f, o2);
+          for (int t = 0; t < NT; ++t) o2[t] += str[t][rank - 1];
+        }
+        // odometer on the other indices
+        int u = rank - 2;
+        for (; u >= 0; --u) {
+          for (int t = 0; t < NT; ++t) o[t] += str[t][u];
+          if (++idx[u] < len[u]) break;
+          for (int t = 0; t < NT; ++t) o[t] -= idx[u] * str[t][u];
+          idx[u] = 0;
+        }
+        if (u < 0) return;
+      }
+    }
+
+    // Lengths and strides of the tensors in the order of labels l. Absent labels have length 1 and stride 0.
+    template <typename... T>
+    auto strides_in_order(labels_t const &l, tensor_desc<T> const &...d) {
+      std::array<long, max_labels> len{};
+      std::array<std::array<long, max_labels>, sizeof...(T)> str{};
+      for (int u = 0; u < l.n; ++u) {
+        len[u] = std::max({d.extent(l[u])...});
+        int t  = 0;
+        ((str[t++][u] = d.stride(l[u])), ...);
+      }
+      return std::make_pair(len, str);
+    }
+
+    // dst = src, with the labels of src permuted into the labels of dst
+    template <typename T, typename U>
+    void copy(tensor_desc<U> const &src, tensor_desc<T> const &dst) {
+      auto [len, str] = strides_in_order(dst.labels, src, dst);
+      U const *ps     = src.data;
+      T *pd           = dst.data;
+      for_each_offset<2>(dst.labels.n, len.data(), {str[0].data(), str[1].data()}, [ps, pd](long os, long od) { pd[od] = ps[os]; });
+    }
+
+    // dst = sum over the labels of src absent from dst
+    template <typename T, typename U>
+    void reduce(tensor_desc<U> const &src, tensor_desc<T> const &dst) {
+      for (int u = 0; u < dst.labels.n; ++u) EXPECTS(src.labels.contains(dst.labels[u]));
+      {
+        auto [len, str] = strides_in_order(dst.labels, dst);
+        T *pd           = dst.data;
+        for_each_offset<1>(dst.labels.n, len.data(), {str[0].data()}, [pd](long od) { pd[od] = T{}; });
+      }
+      auto [len, str] = strides_in_order(src.labels, src, dst);
+      U const *ps     = src.data;
+      T *pd           = dst.data;
+      for_each_offset<2>(src.labels.n, len.data(), {str[0].data(), str[1].data()}, [ps, pd](long os, long od) { pd[od] += ps[os]; });
+    }
+
+    // -------------------------------------------------------------------------------------------
+    //                                       Planning
+    // -------------------------------------------------------------------------------------------
+
+    // A group of indices seen as one strided dimension, if possible.
+    struct merged_dim_t {
+      long len = 1, str = 0;
+      bool ok = true;
+    };
+
+    // Merge the labels g of tensor d (in the order of g, slowest first) into one dimension.
+    // Length 1 dimensions are irrelevant. Same check as group_indices_layout, but at runtime on any strides.
+    template <typename T>
+    merged_dim_t merge(labels_t const &g, tensor_desc<T> const &d) {
+      merged_dim_t r;
+      long expected = -1;
+      for (int u = g.n - 1; u >= 0; --u) {
+        long l = d.extent(g[u]), s = d.stride(g[u]);
+        if (l == 1) continue;
+        if (expected == -1)
+          r.str = s;
+        else if (s != expected)
+          r.ok = false;
+        expected = s * l;
+        r.len *= l;
+      }
+      for (int u = 0; u < g.n; ++u)
+        if (d.extent(g[u]) == 0) r.len = 0;
+      return r;
+    }
+
+    // How to pass a strided (r x c) matrix to a Fortran BLAS : 'N' or 'T' and the leading dimension.
+    // trans == 0 if the matrix has no unit stride
+    struct blas_op_t {
+      char trans = 0;
+      int ld     = 1;
+    };
+
+    inline blas_op_t blas_op(long r, long sr, long c, long sc) {
+      // column major : (i,j) at i + j * ld
+      if (sr == 1 or r == 1) {
+        long ld = (c == 1 ? std::max(r, 1l) : sc);
+        if (ld >= std::max(r, 1l)) return {'N', int(ld)};
+      }
+      // row major : transposed column major
+      if (sc == 1 or c == 1) {
+        long ld = (r == 1 ? std::max(c, 1l) : sr);
+        if (ld >= std::max(c, 1l)) return {'T', int(ld)};
+      }
+      return {};
+    }
+
+    /**
+     * The plan of a pairwise contraction C = A * B.
+     *
+     * Each label is either
+     *   - a loop label (batch labels, present in A, B and C, and the free labels moved out of the GEMM) : loop_labels
+     *   - a row label (in A and C only) : m_labels
+     *   - a column label (in B and C only) : n_labels
+     *   - a contracted label (in A and B only) : k_labels
+     *
+     * For each value of the loop labels, a GEMM C(m, n) = sum_k A(m, k) B(k, n) is called.
+     * An operand for which the groups can not be merged into a BLAS matrix is first copied in the correct order
+     * (the transpositions of the transpose-transpose-GEMM-transpose scheme).
+     */
+    struct contraction_plan {
+      labels_t loop_labels, m_labels, n_labels, k_labels;
+      bool copy_a = false, copy_b = false, copy_c = false;
+      long n_gemm = 1, m = 1, n = 1, k = 1;
+    };
+
+    // Minimal number of flops per GEMM call in a loop-over-GEMM plan. Below, transposing is cheaper.
+    inline constexpr long loop_over_gemm_min_flops = 32 * 32 * 32;
+
+    template <typename T, typename U, typename V>
+    contraction_plan make_plan(tensor_desc<T> const &a, tensor_desc<U> const &b, tensor_desc<V> const &c) {
+      contraction_plan base;
+      auto const &lc = c.labels;
+
+      // classification. m, n, loop labels in the order of C (i.e. its memory order when C is allocated by us)
+      for (int u = 0; u < lc.n; ++u) {
+        char x  = lc[u];
+        bool ia = a.labels.contains(x), ib = b.labels.contains(x);
+        if (ia and ib)
+          base.loop_labels.push_back(x);
+        else if (ia)
+          base.m_labels.push_back(x);
+        else if (ib)
+          base.n_labels.push_back(x);
+        else
+          NDA_RUNTIME_ERROR << "einsum : label " << x << " of the result is in none of the operands";
+      }
+
+      // k labels in the memory order of A
+      {
+        std::array<int, max_labels> pos{};
+        int nk = 0;
+        for (int u = 0; u < a.labels.n; ++u)
+          if (b.labels.contains(a.labels[u]) and not lc.contains(a.labels[u])) pos[nk++] = u;
+        std::stable_sort(pos.begin(), pos.begin() + nk, [&a](int i, int j) { return a.str[i] > a.str[j]; });
+        for (int u = 0; u < nk; ++u) base.k_labels.push_back(a.labels[pos[u]]);
+      }
+
+      auto product = [&c, &a, &b](labels_t const &l) {
+        long r = 1;
+        for (int u = 0; u < l.n; ++u) r *= std::max({a.extent(l[u]), b.extent(l[u]), c.extent(l[u])});
+        return r;
+      };
+
+      // Complete a plan : compute sizes and decide which operands must be copied
+      auto finalize = [&](contraction_plan p) {
+        p.n_gemm = product(p.loop_labels);
+        p.m      = product(p.m_labels);
+        p.n      = product(p.n_labels);
+        p.k      = product(p.k_labels);
+
+        auto ma_m = merge(p.m_labels, a), ma_k = merge(p.k_labels, a);
+        auto mb_k = merge(p.k_labels, b), mb_n = merge(p.n_labels, b);
+        auto mc_m = merge(p.m_labels, c), mc_n = merge(p.n_labels, c);
+
+        p.copy_a = not(ma_m.ok and ma_k.ok and blas_op(ma_m.len, ma_m.str, ma_k.len, ma_k.str).trans);
+        p.copy_b = not(mb_k.ok and mb_n.ok and blas_op(mb_k.len, mb_k.str, mb_n.len, mb_n.str).trans);
+        p.copy_c = not(mc_m.ok and mc_n.ok and blas_op(mc_m.len, mc_m.str, mc_n.len, mc_n.str).trans);
+        return p;
+      };
+
+      // 1- transpose-transpose-GEMM-transpose plan : copy what is not mergeable
+      auto ttgt = finalize(base);
+      if (not(ttgt.copy_a or ttgt.copy_b or ttgt.copy_c)) return ttgt; // zero copy, we are done
+
+      // 2- loop-over-GEMM plan : move the slowest m (resp. n) labels to the loop until the groups can be merged
+      auto log = base;
+      auto peel = [&log](labels_t &g, auto const &x, auto const &y) {
+        while (g.n > 0 and not(merge(g, x).ok and merge(g, y).ok)) {
+          log.loop_labels.push_back(g[0]);
+          for (int u = 1; u < g.n; ++u) g.c[u - 1] = g.c[u];
+          --g.n;
+        }
+      };
+      peel(log.m_labels, a, c);
+      peel(log.n_labels, b, c);
+      log = finalize(log);
+
+      int n_copy_ttgt = int(ttgt.copy_a) + int(ttgt.copy_b) + int(ttgt.copy_c);
+      int n_copy_log  = int(log.copy_a) + int(log.copy_b) + int(log.copy_c);
+      if (n_copy_log < n_copy_ttgt and log.m * log.n * log.k >= loop_over_gemm_min_flops) return log;
+      return ttgt;
+    }
+
+    // -------------------------------------------------------------------------------------------
+    //                                     Execution
+    // -------------------------------------------------------------------------------------------
+
+    // C(m,n) = sum_k A(m,k) B(k,n) for strided matrices
+    template <typename T>
+    void gemm_strided(long m, long n, long k, T const *a, merged_dim_t am, merged_dim_t ak, T const *b, merged_dim_t bk, merged_dim_t bn, T *c,
+                      merged_dim_t cm, merged_dim_t cn) {
+      if (m == 0 or n == 0) return;
+      if (k == 0) {
+        for (long i = 0; i < m; ++i)
+          for (long j = 0; j < n; ++j) c[i * cm.str + j * cn.str] = T{};
+        return;
+      }
+      if constexpr (blas::is_blas_lapack_v<T>) {
+        auto opc = blas_op(m, cm.str, n, cn.str);
+        if (opc.trans == 'N') {
+          auto opa = blas_op(m, am.str, k, ak.str);
+          auto opb = blas_op(k, bk.str, n, bn.str);
+          blas::f77::gemm(opa.trans, opb.trans, m, n, k, T{1}, a, opa.ld, b, opb.ld, T{0}, c, opc.ld);
+        } else { // C^T = B^T A^T
+          auto opct = blas_op(n, cn.str, m, cm.str);
+          auto opb  = blas_op(n, bn.str, k, bk.str);
+          auto opa  = blas_op(k, ak.str, m, am.str);
+          blas::f77::gemm(opb.trans, opa.trans, n, m, k, T{1}, b, opb.ld, a, opa.ld, T{0}, c, opct.ld);
+        }
+      } else {
+        for (long i = 0; i < m; ++i)
+          for (long j = 0; j < n; ++j) {
+            T acc{};
+            for (long l = 0; l < k; ++l) acc += a[i * am.str + l * ak.str] * b[l * bk.str + j * bn.str];
+            c[i * cm.str + j * cn.str] = acc;
+          }
+      }
+    }
+
+    // Execute the plan p for C = A * B. All labels of A and B are in C or contracted.
+    template <typename T>
+    void execute(contraction_plan const &p, tensor_desc<T const> a, tensor_desc<T const> b, tensor_desc<T> c) {
+
+      // labels of x, in the order of the groups ls
+      auto concat = [](auto const &x, auto const &...ls) {
+        labels_t r;
+        (
+           [&r, &x](labels_t const &l) {
+             for (int u = 0; u < l.n; ++u)
+               if (x.labels.contains(l[u])) r.push_back(l[u]);
+           }(ls),
+           ...);
+        return r;
+      };
+      auto extent = [&a, &b, &c](char x) { return std::max({a.extent(x), b.extent(x), c.extent(x)}); };
+
+      // Transpositions when needed : copy into a contiguous buffer, in the plan order
+      std::vector<T> buf_a, buf_b, buf_c;
+      if (p.copy_a) {
+        buf_a.resize(a.size());
+        auto d = make_contiguous_desc(buf_a.data(), concat(a, p.loop_labels, p.m_labels, p.k_labels), extent);
+        copy(a, d);
+        a = tensor_desc<T const>{d.data, d.labels, d.len, d.str};
+      }
+      if (p.copy_b) {
+        buf_b.resize(b.size());
+        auto d = make_contiguous_desc(buf_b.data(), concat(b, p.loop_labels, p.k_labels, p.n_labels), extent);
+        copy(b, d);
+        b = tensor_desc<T const>{d.data, d.labels, d.len, d.str};
+      }
+      auto c_target = c;
+      if (p.copy_c) {
+        buf_c.resize(c.size());
+        c = make_contiguous_desc(buf_c.data(), concat(c, p.loop_labels, p.m_labels, p.n_labels), extent);
+      }
+
+      auto am = merge(p.m_labels, a), ak = merge(p.k_labels, a);
+      auto bk = merge(p.k_labels, b), bn = merge(p.n_labels, b);
+      auto cm = merge(p.m_labels, c), cn = merge(p.n_labels, c);
+      EXPECTS(am.ok and ak.ok and bk.ok and bn.ok and cm.ok and cn.ok);
+
+      // Loop over GEMM
+      auto [len, str] = strides_in_order(p.loop_labels, a, b, c);
+      T const *pa = a.data, *pb = b.data;
+      T *pc = c.data;
+      for_each_offset<3>(p.loop_labels.n, len.data(), {str[0].data(), str[1].data(), str[2].data()}, [&](long oa, long ob, long oc) {
+        gemm_strided(p.m, p.n, p.k, pa + oa, am, ak, pb + ob, bk, bn, pc + oc, cm, cn);
+      });
+
+      if (p.copy_c) copy(tensor_desc<T const>{c.data, c.labels, c.len, c.str}, c_target);
+    }
+
+    // C = A * B, summing over the labels of A and B absent from C
+    template <typename T>
+    void contract_pair(tensor_desc<T const> a, tensor_desc<T const> b, tensor_desc<T> c) {
+      // Labels of A (resp. B) absent from both B (resp. A) and C are summed first
+      auto drop_lonely = [&c](tensor_desc<T const> const &x, tensor_desc<T const> const &y, std::vector<T> &buf) {
+        labels_t kept;
+        for (int u = 0; u < x.labels.n; ++u)
+          if (y.labels.contains(x.labels[u]) or c.labels.contains(x.labels[u])) kept.push_back(x.labels[u]);
+        if (kept.n == x.labels.n) return x;
+        long s = 1;
+        for (int u = 0; u < kept.n; ++u) s *= x.extent(kept[u]);
+        buf.resize(s);
+        auto d = make_contiguous_desc(buf.data(), kept, [&x](char l) { return x.extent(l); });
+        reduce(x, d);
+        return tensor_desc<T const>{d.data, d.labels, d.len, d.str};
+      };
+      std::vector<T> buf_a, buf_b;
+      a = drop_lonely(a, b, buf_a);
+      b = drop_lonely(b, a, buf_b);
+
+      for (int u = 0; u < c.labels.n; ++u) {
+        char x = c.labels[u];
+        if (a.labels.contains(x)) EXPECTS_WITH_MESSAGE(a.extent(x) == c.extent(x), "einsum : dimension mismatch for label " << x);
+        if (b.labels.contains(x)) EXPECTS_WITH_MESSAGE(b.extent(x) == c.extent(x), "einsum : dimension mismatch for label " << x);
+      }
+      for (int u = 0; u < a.labels.n; ++u) {
+        char x = a.labels[u];
+        if (b.labels.contains(x)) EXPECTS_WITH_MESSAGE(a.extent(x) == b.extent(x), "einsum : dimension mismatch for label " << x);
+      }
+
+      execute(make_plan(a, b, c), a, b, c);
+    }
+
+    // -------------------------------------------------------------------------------------------
+    //                               Multi-operand : greedy pairwise order
+    // -------------------------------------------------------------------------------------------
+
+    /**
+     * Contract all operands into c.
+     * The pairwise order is chosen greedily : at each step, contract the pair with the smallest cost (number of flops),
+     * keeping in the intermediate only the labels still needed by the result or by the other operands.
+     */
+    template <typename T>
+    void contract_all(std::vector<tensor_desc<T const>> ops, tensor_desc<T> c) {
+      std::vector<std::vector<T>> buffers;
+      buffers.reserve(ops.size());
+
+      auto extent = [&ops, &c](char x) {
+        long r = c.extent(x);
+        for (auto const &o : ops) r = std::max(r, o.extent(x));
+        return r;
+      };
+
+      while (ops.size() > 2) {
+        // needed(i, j) : labels of ops[i], ops[j] which appear in the result or in one of the other operands
+        auto intermediate_labels = [&](int i, int j) {
+          labels_t r;
+          for (auto const *o : {&ops[i], &ops[j]})
+            for (int u = 0; u < o->labels.n; ++u) {
+              char x = o->labels[u];
+              if (r.contains(x)) continue;
+              bool needed = c.labels.contains(x);
+              for (int v = 0; v < int(ops.size()); ++v)
+                if (v != i and v != j) needed = needed or ops[v].labels.contains(x);
+              if (needed) r.push_back(x);
+            }
+          return r;
+        };
+
+        int bi = 0, bj = 1;
+        double best_cost = -1;
+        for (int i = 0; i < int(ops.size()); ++i)
+          for (int j = i + 1; j < int(ops.size()); ++j) {
+            labels_t all = ops[i].labels;
+            for (int u = 0; u < ops[j].labels.n; ++u)
+              if (not all.contains(ops[j].labels[u])) all.push_back(ops[j].labels[u]);
+            double cost = 1;
+            for (int u = 0; u < all.n; ++u) cost *= double(extent(all[u]));
+            if (best_cost < 0 or cost < best_cost) {
+              best_cost = cost;
+              bi        = i;
+              bj        = j;
+            }
+          }
+
+        auto l_int = intermediate_labels(bi, bj);
+        long s     = 1;
+        for (int u = 0; u < l_int.n; ++u) s *= extent(l_int[u]);
+        auto &buf = buffers.emplace_back(s);
+        auto d    = make_contiguous_desc(buf.data(), l_int, extent);
+        contract_pair(ops[bi], ops[bj], d);
+
+        ops.erase(ops.begin() + bj);
+        ops[bi] = tensor_desc<T const>{d.data, d.labels, d.len, d.str};
+      }
+
+      if (ops.size() == 2)
+        contract_pair(ops[0], ops[1], c);
+      else {
+        auto const &o = ops[0];
+        for (int u = 0; u < c.labels.n; ++u) EXPECTS_WITH_MESSAGE(o.extent(c.labels[u]) == c.extent(c.labels[u]), "einsum : dimension mismatch");
+        reduce(o, c);
+      }
+    }
+
+  } // namespace einsum_details
+
+  // -------------------------------------------------------------------------------------------
+  //                                         einsum
+  // -------------------------------------------------------------------------------------------
+
+  /**
+   * Tensor contraction in einsum notation.
+   *
+   * @tparam Spec The contraction, e.g. "abk,kc->abc"
+   * @param a The operands, one per operand in Spec, of ranks given by Spec
+   * @return An array with the labels of the result of Spec (in C layout), or a scalar if the result has no label
+   *
+   * @example
+   *    auto C = nda::einsum<"akb,kc->abc">(A, B); // C(a,b,c) = sum_k A(a,k,b) B(k,c)
+   *
+   * Each pairwise contraction is done with GEMM. Index groups are merged directly on the strides of the operands
+   * (like group_indices_view) so that views with any layout (permuted_indices_view, slices, Fortran, ...) are used without copy
+   * whenever possible. Otherwise, the plan chooses between transposing the operands (copy) and looping over smaller GEMMs.
+   * For more than two operands, the pairwise order is chosen greedily to minimize the number of operations.
+   */
+  template <einsum_spec Spec, Array... A>
+  auto einsum(A const &...a) {
+    static_assert(sizeof...(A) == Spec.n_inputs, "einsum : the number of operands does not match the specification");
+    static constexpr std::array<int, sizeof...(A)> ranks{get_rank<A>...};
+    static_assert(
+       [] {
+         for (int u = 0; u < int(sizeof...(A)); ++u)
+           if (ranks[u] != Spec.inputs[u].n) return false;
+         return true;
+       }(),
+       "einsum : the rank of an operand does not match the number of its labels in the specification");
+
+    using T                = std::decay_t<decltype((get_value_t<A>{} * ...))>;
+    static constexpr int R = Spec.output.n;
+
+    // operands must be in memory with value_type T, otherwise we evaluate them
+    auto as_memory = [](auto const &x) -> decltype(auto) {
+      using X = std::decay_t<decltype(x)>;
+      if constexpr (MemoryArray<X> and std::is_same_v<std::remove_const_t<get_value_t<X>>, T>)
+        return x;
+      else
+        return array<T, get_rank<X>>{x};
+    };
+
+    return [&]<size_t... Is>(std::index_sequence<Is...>, auto const &...ops) {
+      std::vector<einsum_details::tensor_desc<T const>> descs{einsum_details::make_desc<T const>(ops, Spec.inputs[Is])...};
+
+      auto extent_of = [&descs](char x) {
+        long r = 1;
+        for (auto const &d : descs) r = std::max(r, d.extent(x));
+        return r;
+      };
+      std::array<long, std::max(R, 1)> shape{};
+      for (int u = 0; u < R; ++u) shape[u] = extent_of(Spec.output[u]);
+
+      if constexpr (R == 0) {
+        T r{};
+        einsum_details::contract_all(std::move(descs), einsum_details::tensor_desc<T>{&r, Spec.output});
+        return r;
+      } else {
+        array<T, R> r(shape);
+        einsum_details::contract_all(std::move(descs), einsum_details::make_desc<T>(r, Spec.output));
+        return r;
+      }
+    }(std::index_sequence_for<A...>{}, as_memory(a)...);
+  }
+
+} // namespace nda
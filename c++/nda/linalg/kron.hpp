@@ -0,0 +1,216 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <array>
+#include <utility>
+
+#include "../blas/ger.hpp"
+#include "./matmul.hpp"
+
+/*
+ * Lazy outer and Kronecker products of matrices (algebra 'M').
+ *
+ *   outer(x, y)  : the matrix x y^T, of two vectors
+ *   kron(a, b)   : the Kronecker product of two matrices, kron(a, b)(i1 m2 + i2, j1 n2 + j2) = a(i1, j1) b(i2, j2)
+ *
+ * They model Array and can be used in any expression. When assigned to an array, outer is evaluated by blas::ger,
+ * kron block by block. Their products with a vector (or a matrix) never form them :
+ *
+ *   outer(x, y) * v = x (y . v)
+ *   kron(a, b) * v  = vec(a V b^T), with V the n1 x n2 matrix of v in C order (i.e. the (b V^T a^T) identity in Fortran order)
+ */
+
+namespace nda {
+
+  // --------------- outer ------------------------
+
+  /// Lazy outer product x y^T of two vectors
+  template <typename X, typename Y>
+  struct expr_outer {
+    using X_t = std::decay_t<X>; // X, Y can be lvalue references
+    using Y_t = std::decay_t<Y>;
+
+    using value_type = decltype(get_value_t<X_t>{} * get_value_t<Y_t>{});
+
+    X x;
+    Y y;
+
+    [[nodiscard]] std::array<long, 2> shape() const { return {x.shape()[0], y.shape()[0]}; }
+
+    [[nodiscard]] long size() const { return x.shape()[0] * y.shape()[0]; }
+
+    value_type operator()(long i, long j) const { return x(i) * y(j); }
+
+    /// Evaluates into target, with blas::ger if possible
+    template <typename V>
+    void evaluate_into(V &target) const {
+      EXPECTS(target.shape() == shape());
+      using T = get_value_t<V>;
+      if constexpr (blas::is_blas_lapack_v<T> and MemoryArray<X_t> and MemoryArray<Y_t> and std::is_same_v<get_value_t<X_t>, T>
+                    and std::is_same_v<get_value_t<Y_t>, T>) {
+        if (target.indexmap().min_stride() == 1) {
+          nda::for_each(target.shape(), [&target](auto i, auto j) { target(i, j) = 0; });
+          blas::ger(T{1}, x, y, target);
+          return;
+        }
+      }
+      nda::for_each(target.shape(), [&](auto i, auto j) { target(i, j) = x(i) * y(j); });
+    }
+  };
+
+  template <typename X, typename Y>
+  inline constexpr char get_algebra<expr_outer<X, Y>> = 'M';
+
+  template <typename T>
+  inline constexpr bool is_outer_expr_v = false;
+
+  template <typename X, typename Y>
+  inline constexpr bool is_outer_expr_v<expr_outer<X, Y>> = true;
+
+  /// The lazy outer product x y^T of two vectors, as a matrix
+  template <ArrayOfRank<1> X, ArrayOfRank<1> Y>
+  expr_outer<X, Y> outer(X &&x, Y &&y) {
+    return {std::forward<X>(x), std::forward<Y>(y)};
+  }
+
+  // --------------- kron ------------------------
+
+  /// Lazy Kronecker product of two matrices
+  template <typename A, typename B>
+  struct expr_kron {
+    using A_t = std::decay_t<A>; // A, B can be lvalue references
+    using B_t = std::decay_t<B>;
+
+    using value_type = decltype(get_value_t<A_t>{} * get_value_t<B_t>{});
+
+    A a;
+    B b;
+
+    [[nodiscard]] std::array<long, 2> shape() const { return {a.shape()[0] * b.shape()[0], a.shape()[1] * b.shape()[1]}; }
+
+    [[nodiscard]] long size() const { return a.size() * b.size(); }
+
+    value_type operator()(long i, long j) const {
+      auto [m2, n2] = b.shape();
+      return a(i / m2, j / n2) * b(i % m2, j % n2);
+    }
+
+    /// Evaluates into target, block by block : the block (i1, j1) is a(i1, j1) * b
+    template <typename V>
+    void evaluate_into(V &target) const {
+      EXPECTS(target.shape() == shape());
+      auto [m1, n1] = a.shape();
+      auto [m2, n2] = b.shape();
+      for (long i1 = 0; i1 < m1; ++i1)
+        for (long j1 = 0; j1 < n1; ++j1) {
+          auto a_ij = a(i1, j1);
+          auto blk  = target(range(i1 * m2, (i1 + 1) * m2), range(j1 * n2, (j1 + 1) * n2));
+          nda::for_each(blk.shape(), [&](auto i2, auto j2) { blk(i2, j2) = a_ij * b(i2, j2); });
+        }
+    }
+  };
+
+  template <typename A, typename B>
+  inline constexpr char get_algebra<expr_kron<A, B>> = 'M';
+
+  template <typename T>
+  inline constexpr bool is_kron_expr_v = false;
+
+  template <typename A, typename B>
+  inline constexpr bool is_kron_expr_v<expr_kron<A, B>> = true;
+
+  /// The lazy Kronecker product of two matrices
+  template <ArrayOfRank<2> A, ArrayOfRank<2> B>
+  expr_kron<A, B> kron(A &&a, B &&b) {
+    return {std::forward<A>(a), std::forward<B>(b)};
+  }
+
+  // --------------- products ------------------------
+
+  /// outer(x, y) * v = x (y . v), in O(n)
+  template <typename L, typename R>
+  auto matvecmul(L &&l, R &&r) requires(is_outer_expr_v<std::decay_t<L>>) {
+    EXPECTS_WITH_MESSAGE(l.shape()[1] == r.shape()[0], "Matrix Vector product : dimension mismatch in matrix product " << l.shape() << " " << r.shape());
+    using promoted_type = decltype(get_value_t<std::decay_t<L>>{} * get_value_t<std::decay_t<R>>{});
+    promoted_type s     = 0;
+    for (long j = 0; j < r.shape()[0]; ++j) s += l.y(j) * r(j);
+    array<promoted_type, 1> result(l.shape()[0]);
+    for (long i = 0; i < l.shape()[0]; ++i) result(i) = l.x(i) * s;
+    return result;
+  }
+
+  /**
+   * kron(a, b) * v, without forming kron(a, b).
+   *
+   * With V (resp. Y) the n1 x n2 (resp. m1 x m2) matrix of v (resp. of the result) in C order, Y = a V b^T,
+   * computed with two gemm in the cheapest order, in O(m1 n1 n2 + m1 m2 n2) or O(n1 n2 m2 + m1 n1 m2) instead of O(m1 m2 n1 n2).
+   */
+  template <typename L, typename R>
+  auto matvecmul(L &&l, R &&r) requires(is_kron_expr_v<std::decay_t<L>>) {
+    EXPECTS_WITH_MESSAGE(l.shape()[1] == r.shape()[0], "Matrix Vector product : dimension mismatch in matrix product " << l.shape() << " " << r.shape());
+    using promoted_type = decltype(get_value_t<std::decay_t<L>>{} * get_value_t<std::decay_t<R>>{});
+    using T             = promoted_type;
+
+    auto [m1, n1] = l.a.shape();
+    auto [m2, n2] = l.b.shape();
+    array<T, 1> result(m1 * m2);
+
+    if constexpr (blas::is_blas_lapack_v<T>) {
+      auto as_matrix = [](auto const &x) -> decltype(auto) {
+        using X = std::decay_t<decltype(x)>;
+        if constexpr (is_regular_or_view_v<X> and get_algebra<X> == 'M' and std::is_same_v<get_value_t<X>, T>)
+          return x;
+        else
+          return matrix<T>{x};
+      };
+      auto const &a = as_matrix(l.a);
+      auto const &b = as_matrix(l.b);
+      auto v        = array<T, 1>{r};
+
+      auto V = matrix_const_view<T>{std::array{n1, n2}, v.data()};
+      auto Y = matrix_view<T>{std::array{m1, m2}, result.data()};
+      if (n1 * n2 * m2 + m1 * n1 * m2 <= m1 * n1 * n2 + m1 * n2 * m2) {
+        auto Vbt = matrix<T>(n1, m2);
+        blas::gemm(1, V, transpose(b), 0, Vbt);
+        blas::gemm(1, a, Vbt, 0, Y);
+      } else {
+        auto aV = matrix<T>(m1, n2);
+        blas::gemm(1, a, V, 0, aV);
+        blas::gemm(1, aV, transpose(b), 0, Y);
+      }
+    } else {
+      for (long i1 = 0; i1 < m1; ++i1)
+        for (long i2 = 0; i2 < m2; ++i2) {
+          T s = 0;
+          for (long j1 = 0; j1 < n1; ++j1)
+            for (long j2 = 0; j2 < n2; ++j2) s += l.a(i1, j1) * l.b(i2, j2) * r(j1 * n2 + j2);
+          result(i1 * m2 + i2) = s;
+        }
+    }
+    return result;
+  }
+
+  /// kron(a, b) * m, column by column, without forming kron(a, b)
+  template <typename L, typename R>
+  auto matmul(L &&l, R &&r) requires(is_kron_expr_v<std::decay_t<L>>) {
+    EXPECTS_WITH_MESSAGE(l.shape()[1] == r.shape()[0], "Matrix product : dimension mismatch in matrix product " << l.shape() << " " << r.shape());
+    using promoted_type = decltype(get_value_t<std::decay_t<L>>{} * get_value_t<std::decay_t<R>>{});
+    matrix<promoted_type> result(l.shape()[0], r.shape()[1]);
+    auto r_reg = make_regular(r);
+    for (long c = 0; c < r.shape()[1]; ++c) result(range::all, c) = matvecmul(l, r_reg(range::all, c));
+    return result;
+  }
+
+} // namespace nda
@@ -0,0 +1,99 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <cmath>
+#include <complex>
+#include <type_traits>
+
+#include "../blas/gemm.hpp"
+#include "../blas/gemv.hpp"
+#include "../blas/dot.hpp"
+
+/*
+ * Common tools of the Krylov methods (eigensolvers.hpp, linear_solvers.hpp).
+ *
+ * The operator A is given by a callable op, applied to one vector
+ *
+ *     op(array_const_view<T, 1> x, array_view<T, 1> y)              // y <- A x
+ *
+ * or to a block of vectors (the columns of X, Y), if it can not be called on a single vector
+ *
+ *     op(matrix_const_view<T, F_stride_layout> X, matrix_view<T, F_stride_layout> Y)
+ */
+
+namespace nda::linalg::krylov_details {
+
+  template <typename T>
+  using basis_t = matrix<T, F_layout>;
+
+  // Apply the operator on the columns of X, into the columns of Y
+  template <typename T, typename Op>
+  void apply(Op const &op, matrix_const_view<T, F_stride_layout> X, matrix_view<T, F_stride_layout> Y) {
+    if constexpr (std::is_invocable_v<Op const &, array_const_view<T, 1>, array_view<T, 1>>) {
+      for (long j = 0; j < X.extent(1); ++j) op(array_const_view<T, 1>{X(_, j)}, array_view<T, 1>{Y(_, j)});
+    } else {
+      static_assert(std::is_invocable_v<Op const &, matrix_const_view<T, F_stride_layout>, matrix_view<T, F_stride_layout>>,
+                    "krylov : the operator must be callable on (array_const_view<T, 1>, array_view<T, 1>) or on a block of vectors "
+                    "(matrix_const_view<T, F_stride_layout>, matrix_view<T, F_stride_layout>)");
+      op(X, Y);
+    }
+  }
+
+  template <typename V>
+  double norm(V const &v) {
+    return std::sqrt(std::real(blas::dotc(v, v)));
+  }
+
+  template <typename T>
+  vector<T> random_vector(long n) {
+    if constexpr (is_complex_v<T>)
+      return vector<T>{rand<double>(n) - 0.5 + dcomplex{0, 1} * (rand<double>(n) - 0.5)};
+    else
+      return vector<T>{rand<double>(n) - 0.5};
+  }
+
+  // Orthogonalize w against the first m columns of V, by classical Gram-Schmidt done twice.
+  // Returns the coefficients V^H w of the original w.
+  template <typename T, typename W>
+  vector<T> orthogonalize(basis_t<T> const &V, long m, W &&w) {
+    vector<T> h(m), c(m);
+    h = 0;
+    if (m == 0) return h;
+    auto Vm = V(_, range(0, m));
+    for (int pass = 0; pass < 2; ++pass) {
+      blas::gemv(1, dagger(Vm), w, 0, c);
+      blas::gemv(-1, Vm, c, 1, w);
+      h += c;
+    }
+    return h;
+  }
+
+  // The Rayleigh quotient V^H W on the first m columns
+  template <typename T>
+  matrix<T, F_layout> project(basis_t<T> const &V, basis_t<T> const &W, long m) {
+    matrix<T, F_layout> H(m, m);
+    blas::gemm(1, dagger(V(_, range(0, m))), W(_, range(0, m)), 0, H);
+    return H;
+  }
+
+  // X = V(:, 0:m) * Y
+  template <typename T>
+  basis_t<T> combine(basis_t<T> const &V, long m, matrix<T, F_layout> const &Y) {
+    basis_t<T> X(V.extent(0), Y.extent(1));
+    blas::gemm(1, V(_, range(0, m)), Y, 0, X);
+    return X;
+  }
+
+} // namespace nda::linalg::krylov_details
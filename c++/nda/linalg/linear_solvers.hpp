@@ -0,0 +1,316 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <type_traits>
+
+#include "./krylov_tools.hpp"
+
+/*
+ * Iterative (Krylov) solvers of A x = b : CG, GMRES(m), BiCGStab.
+ *
+ * The operator A and the preconditioner M (M ~ A^-1) are callables, applied to one vector
+ *
+ *     op(array_const_view<T, 1> x, array_view<T, 1> y)              // y <- A x
+ *     prec(array_const_view<T, 1> r, array_view<T, 1> z)            // z <- M r
+ *
+ * x is the initial guess on input, the solution on output.
+ */
+
+namespace nda::linalg {
+
+  /// Parameters of the iterative linear solvers
+  struct linear_solver_params {
+
+    /// Convergence criterion : ||b - A x|| < tolerance * ||b||
+    double tolerance = 1.e-10;
+
+    /// Maximal number of iterations (applications of the operator)
+    long max_iterations = 1000;
+
+    /// Dimension of the Krylov space of GMRES, before a restart
+    long restart = 30;
+  };
+
+  /// Result of the iterative linear solvers
+  struct linear_solver_result {
+
+    /// Number of iterations
+    long n_iterations = 0;
+
+    /// The final relative residual ||b - A x|| / ||b||
+    double residual = 0;
+
+    bool converged = false;
+  };
+
+  /// The identity, as a preconditioner (i.e. no preconditioner)
+  struct identity_preconditioner {
+    template <typename R, typename Z>
+    void operator()(R const &r, Z &&z) const {
+      z = r;
+    }
+  };
+
+  namespace krylov_details {
+
+    // y <- A x, for vectors
+    template <typename T, typename Op>
+    void apply_vec(Op const &op, vector<T> const &x, vector<T> &y) {
+      static_assert(std::is_invocable_v<Op const &, array_const_view<T, 1>, array_view<T, 1>>,
+                    "krylov : the operator and the preconditioner must be callable on (array_const_view<T, 1>, array_view<T, 1>)");
+      op(array_const_view<T, 1>{x}, array_view<T, 1>{y});
+    }
+
+    // Givens rotation (c real, s) such that [c s; -conj(s) c] (a, b) = (r, 0)
+    template <typename T>
+    std::pair<double, T> givens(T a, T b) {
+      if (b == T{0}) return {1.0, T{0}};
+      if (a == T{0}) return {0.0, T{1}};
+      double t = std::sqrt(std::norm(a) + std::norm(b));
+      if constexpr (is_complex_v<T>)
+        return {std::abs(a) / t, (a / std::abs(a)) * std::conj(b) / t};
+      else
+        return {std::abs(a) / t, (a / std::abs(a)) * b / t};
+    }
+
+    template <typename T>
+    T conj_if_complex(T x) {
+      if constexpr (is_complex_v<T>)
+        return std::conj(x);
+      else
+        return x;
+    }
+
+  } // namespace krylov_details
+
+  /**
+   * Preconditioned conjugate gradient, for a hermitian positive definite operator
+   *
+   * @param op The operator A
+   * @param b The right hand side
+   * @param x The initial guess on input, the solution on output
+   * @param p The parameters
+   * @param prec The preconditioner, hermitian positive definite
+   */
+  template <typename Op, ArrayOfRank<1> B, MemoryArrayOfRank<1> X, typename Prec = identity_preconditioner>
+  linear_solver_result cg(Op const &op, B const &b, X &&x, linear_solver_params const &p = {}, Prec const &prec = {}) {
+    using namespace krylov_details;
+    using T = std::remove_const_t<get_value_t<X>>;
+    long n  = x.shape()[0];
+    EXPECTS(b.shape()[0] == n);
+
+    linear_solver_result res;
+    double b_norm = norm(vector<T>{b});
+    if (b_norm == 0) {
+      x = 0;
+      res.converged = true;
+      return res;
+    }
+
+    vector<T> r(n), z(n), d(n), Ad(n);
+    apply_vec<T>(op, vector<T>{x}, r);
+    r = b - r;
+    apply_vec<T>(prec, r, z);
+    d    = z;
+    T rz = blas::dotc(r, z);
+
+    for (;;) {
+      res.residual  = norm(r) / b_norm;
+      res.converged = (res.residual < p.tolerance);
+      if (res.converged or res.n_iterations >= p.max_iterations) return res;
+
+      apply_vec<T>(op, d, Ad);
+      ++res.n_iterations;
+      T alpha = rz / blas::dotc(d, Ad);
+      x += alpha * d;
+      r -= alpha * Ad;
+      apply_vec<T>(prec, r, z);
+      T rz_new = blas::dotc(r, z);
+      d        = z + (rz_new / rz) * d;
+      rz       = rz_new;
+    }
+  }
+
+  /**
+   * Restarted GMRES(m), with right (flexible) preconditioning.
+   *
+   * The Krylov basis (p.restart + 1 vectors) is allocated once, in one matrix, and orthogonalized by
+   * classical Gram-Schmidt done twice with blas::gemv. The least square problem is solved by Givens rotations.
+   *
+   * @param op The operator A
+   * @param b The right hand side
+   * @param x The initial guess on input, the solution on output
+   * @param p The parameters
+   * @param prec The preconditioner. It can change from one iteration to the next (flexible GMRES).
+   */
+  template <typename Op, ArrayOfRank<1> B, MemoryArrayOfRank<1> X, typename Prec = identity_preconditioner>
+  linear_solver_result gmres(Op const &op, B const &b, X &&x, linear_solver_params const &p = {}, Prec const &prec = {}) {
+    using namespace krylov_details;
+    using T                       = std::remove_const_t<get_value_t<X>>;
+    static constexpr bool is_prec = not std::is_same_v<Prec, identity_preconditioner>;
+    long n                        = x.shape()[0];
+    long m                        = std::min(p.restart, n);
+    EXPECTS(b.shape()[0] == n);
+    EXPECTS(m > 0);
+
+    linear_solver_result res;
+    double b_norm = norm(vector<T>{b});
+    if (b_norm == 0) {
+      x = 0;
+      res.converged = true;
+      return res;
+    }
+
+    basis_t<T> V(n, m + 1), Z(n, is_prec ? m : 0);
+    matrix<T, F_layout> H(m + 1, m);
+    vector<T> g(m + 1), w(n), z(n);
+    std::vector<std::pair<double, T>> rot(m);
+
+    for (;;) {
+      // residual and first vector of the basis
+      apply_vec<T>(op, vector<T>{x}, w);
+      w             = b - w;
+      double beta   = norm(w);
+      res.residual  = beta / b_norm;
+      res.converged = (res.residual < p.tolerance);
+      if (res.converged or res.n_iterations >= p.max_iterations) return res;
+
+      V(_, 0) = w / beta;
+      g       = 0;
+      g(0)    = beta;
+      H()     = 0;
+
+      // Arnoldi
+      long j = 0;
+      while (j < m and res.n_iterations < p.max_iterations) {
+        if constexpr (is_prec) {
+          apply_vec<T>(prec, vector<T>{V(_, j)}, z);
+          Z(_, j) = z;
+        } else {
+          z = V(_, j);
+        }
+        apply_vec<T>(op, z, w);
+        ++res.n_iterations;
+
+        H(range(0, j + 1), j) = orthogonalize(V, j + 1, w);
+        double h              = norm(w);
+        H(j + 1, j)           = h;
+        if (h > 0) V(_, j + 1) = w / h;
+
+        // previous rotations on the new column, then the new rotation
+        for (long i = 0; i < j; ++i) {
+          auto [c, s] = rot[i];
+          T a = H(i, j), bb = H(i + 1, j);
+          H(i, j)     = c * a + s * bb;
+          H(i + 1, j) = -conj_if_complex(s) * a + c * bb;
+        }
+        rot[j]      = givens(H(j, j), H(j + 1, j));
+        auto [c, s] = rot[j];
+        H(j, j)     = c * H(j, j) + s * H(j + 1, j);
+        H(j + 1, j) = 0;
+        g(j + 1)    = -conj_if_complex(s) * g(j);
+        g(j)        = c * g(j);
+        ++j;
+
+        if (std::abs(g(j)) < p.tolerance * b_norm or h == 0) break;
+      }
+
+      // solve the triangular system H y = g, and update x
+      vector<T> y(j);
+      for (long i = j - 1; i >= 0; --i) {
+        T s = g(i);
+        for (long k = i + 1; k < j; ++k) s -= H(i, k) * y(k);
+        y(i) = s / H(i, i);
+      }
+      if constexpr (is_prec)
+        blas::gemv(1, Z(_, range(0, j)), y, 1, x);
+      else
+        blas::gemv(1, V(_, range(0, j)), y, 1, x);
+    }
+  }
+
+  /**
+   * Preconditioned BiCGStab, for a general operator
+   *
+   * @param op The operator A
+   * @param b The right hand side
+   * @param x The initial guess on input, the solution on output
+   * @param p The parameters
+   * @param prec The preconditioner
+   */
+  template <typename Op, ArrayOfRank<1> B, MemoryArrayOfRank<1> X, typename Prec = identity_preconditioner>
+  linear_solver_result bicgstab(Op const &op, B const &b, X &&x, linear_solver_params const &p = {}, Prec const &prec = {}) {
+    using namespace krylov_details;
+    using T = std::remove_const_t<get_value_t<X>>;
+    long n  = x.shape()[0];
+    EXPECTS(b.shape()[0] == n);
+
+    linear_solver_result res;
+    double b_norm = norm(vector<T>{b});
+    if (b_norm == 0) {
+      x = 0;
+      res.converged = true;
+      return res;
+    }
+
+    vector<T> r(n), r0(n), d(n), v(n), s(n), t(n), d_hat(n), s_hat(n);
+    apply_vec<T>(op, vector<T>{x}, r);
+    r  = b - r;
+    r0 = r;
+    d  = 0;
+    v  = 0;
+    T rho = 1, alpha = 1, omega = 1;
+
+    for (;;) {
+      res.residual  = norm(r) / b_norm;
+      res.converged = (res.residual < p.tolerance);
+      if (res.converged or res.n_iterations >= p.max_iterations) return res;
+
+      T rho_new = blas::dotc(r0, r);
+      if (rho_new == T{0}) return res; // breakdown
+      T beta = (rho_new / rho) * (alpha / omega);
+      d      = r + beta * (d - omega * v);
+      apply_vec<T>(prec, d, d_hat);
+      apply_vec<T>(op, d_hat, v);
+      alpha = rho_new / blas::dotc(r0, v);
+      s     = r - alpha * v;
+      ++res.n_iterations;
+
+      if (norm(s) < p.tolerance * b_norm) {
+        x += alpha * d_hat;
+        r = s;
+        continue;
+      }
+
+      apply_vec<T>(prec, s, s_hat);
+      apply_vec<T>(op, s_hat, t);
+      ++res.n_iterations;
+      double t_t = std::real(blas::dotc(t, t));
+      if (t_t > 0) omega = blas::dotc(t, s) / t_t;
+      if (t_t == 0 or std::abs(omega) < std::numeric_limits<double>::epsilon()) { // breakdown : keep the half step
+        x += alpha * d_hat;
+        res.residual = norm(s) / b_norm;
+        return res;
+      }
+      x += alpha * d_hat + omega * s_hat;
+      r   = s - omega * t;
+      rho = rho_new;
+    }
+  }
+
+} // namespace nda::linalg
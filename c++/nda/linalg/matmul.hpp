@@ -46,6 +46,9 @@ namespace nda {
         using A = std::decay_t<decltype(a)>;
         if constexpr (is_regular_or_view_v<A> and std::is_same_v<get_value_t<A>, promoted_type>)
           return a;
+        else if constexpr (is_conj_expr_v<A> and get_rank<A> == 2 and std::is_same_v<get_value_t<A>, promoted_type>
+                           and is_regular_or_view_v<std::decay_t<decltype(blas::get_array(a))>>)
+          return a; // conj(M), dagger(M) : no copy, see blas::gemm, blas::gemv
         else
           return matrix<promoted_type>{a};
       };
@@ -92,6 +95,9 @@ namespace nda {
         using A = std::decay_t<decltype(a)>;
         if constexpr (is_regular_or_view_v<A> and std::is_same_v<get_value_t<A>, promoted_type>)
           return a;
+        else if constexpr (is_conj_expr_v<A> and get_rank<A> == 2 and std::is_same_v<get_value_t<A>, promoted_type>
+                           and is_regular_or_view_v<std::decay_t<decltype(blas::get_array(a))>>)
+          return a; // conj(M), dagger(M) : no copy, see blas::gemm, blas::gemv
         else
           return array<promoted_type, get_rank<A>>{a};
       };
@@ -0,0 +1,300 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "../lapack/getrf.hpp"
+#include "../lapack/getrs.hpp"
+#include "./eigenelements.hpp"
+
+/*
+ * Functions of matrices.
+ *
+ *   hermitian_eigensystem : the eigendecomposition H = U diag(lambda) U^H of a hermitian matrix, computed once.
+ *                           f(H) = U diag(f(lambda)) U^H then costs a scaling of U^H plus one gemm.
+ *   sqrtm, logm           : square root and logarithm of a hermitian positive (definite) matrix
+ *   expm                  : exponential of any square matrix, by scaling and squaring with a Pade approximant
+ */
+
+namespace nda::linalg {
+
+  /**
+   * The eigendecomposition H = U diag(lambda) U^H of a symmetric(real) or hermitian(complex) matrix,
+   * to evaluate functions f(H) = U diag(f(lambda)) U^H for many f.
+   *
+   * U is kept in Fortran order (as computed by LAPACK) and U^H in C order, so that f(H) = U (diag(f(lambda)) U^H)
+   * is one scaling of the rows of U^H, and one gemm.
+   *
+   * @tparam T The value type (double or dcomplex)
+   */
+  template <typename T>
+  class hermitian_eigensystem {
+    array<double, 1> _ev;
+    matrix<T, F_layout> _vecs; // U : the eigenvectors as columns
+    matrix<T> _vecs_dag;       // U^H
+
+    // The value type of f(H)
+    template <typename F>
+    using result_t = decltype(T{} * std::declval<F const &>()(0.0));
+
+    // U, with the value type R
+    template <typename R>
+    decltype(auto) vecs_as() const {
+      if constexpr (std::is_same_v<R, T>)
+        return (_vecs);
+      else
+        return matrix<R, F_layout>{_vecs};
+    }
+
+    public:
+    using value_type = T;
+
+    /// Diagonalize h (copied)
+    template <ArrayOfRank<2> M>
+    explicit hermitian_eigensystem(M const &h) : hermitian_eigensystem(matrix<T, F_layout>(h)) {}
+
+    /// Diagonalize h in place : no copy of h
+    explicit hermitian_eigensystem(matrix<T, F_layout> &&h) : _vecs(std::move(h)) {
+      EXPECTS(is_matrix_square(_vecs, true));
+      _ev       = (_vecs.extent(0) > 0 ? _eigen_element_impl(_vecs, 'V') : array<double, 1>{});
+      _vecs_dag = dagger(_vecs);
+    }
+
+    /// Dimension of the matrix
+    [[nodiscard]] long dim() const noexcept { return _ev.size(); }
+
+    /// The eigenvalues, in increasing order
+    [[nodiscard]] array<double, 1> const &eigenvalues() const noexcept { return _ev; }
+
+    /// The eigenvectors, as columns
+    [[nodiscard]] matrix<T, F_layout> const &eigenvectors() const noexcept { return _vecs; }
+
+    /**
+     * f(H), written into out (no allocation for the result)
+     *
+     * @param f A function double -> scalar
+     * @param out A matrix (view) of dimension dim() x dim(), with the value type of f(H)
+     */
+    template <typename F, MemoryArrayOfRank<2> Out>
+    void apply(F const &f, Out &&out) const {
+      using R = result_t<F>;
+      static_assert(std::is_same_v<get_value_t<Out>, R>, "hermitian_eigensystem::apply : out must have the value type of f(H)");
+      long n = dim();
+      EXPECTS(out.shape() == (std::array<long, 2>{n, n}));
+      if (n == 0) return;
+      matrix<R> fUh(n, n); // diag(f(lambda)) U^H
+      for (long i = 0; i < n; ++i) {
+        R fi = f(_ev(i));
+        for (long j = 0; j < n; ++j) fUh(i, j) = fi * _vecs_dag(i, j);
+      }
+      blas::gemm(1, vecs_as<R>(), fUh, 0, out);
+    }
+
+    /// f(H), for a function f : double -> scalar
+    template <typename F>
+    matrix<result_t<F>> apply(F const &f) const {
+      matrix<result_t<F>> r(dim(), dim());
+      apply(f, r);
+      return r;
+    }
+
+    /**
+     * f(H, p) for all the parameters p in params, e.g. exp(-tau H) on a grid of tau.
+     *
+     * The products are batched : a chunk of parameters is done in one gemm (U diag(f(lambda, p)))_p U^H.
+     *
+     * @param f A function (double, parameter) -> scalar
+     * @param params The parameters
+     * @return r(k, _, _) = f(H, params[k])
+     */
+    template <typename F, typename P>
+    auto apply_batch(F const &f, P const &params) const {
+      using R = decltype(T{} * f(0.0, params[0]));
+      long n  = dim();
+      long np = std::size(params);
+      array<R, 3> r(np, n, n);
+      if (n == 0 or np == 0) return r;
+
+      // chunks of about 2^20 elements for the stacked U diag(f(lambda, p))
+      long chunk = std::clamp((1l << 20) / (n * n), 1l, np);
+      matrix<R> U_stack(chunk * n, n);
+      decltype(auto) Uh = [this]() -> decltype(auto) {
+        if constexpr (std::is_same_v<R, T>)
+          return (_vecs_dag);
+        else
+          return matrix<R>{_vecs_dag};
+      }();
+
+      for (long k0 = 0; k0 < np; k0 += chunk) {
+        long nk = std::min(chunk, np - k0);
+        for (long k = 0; k < nk; ++k) {
+          for (long l = 0; l < n; ++l) {
+            R fl = f(_ev(l), params[k0 + k]);
+            for (long i = 0; i < n; ++i) U_stack(k * n + i, l) = _vecs(i, l) * fl;
+          }
+        }
+        auto out = matrix_view<R>{std::array<long, 2>{nk * n, n}, r.data() + k0 * n * n};
+        blas::gemm(1, U_stack(range(0, nk * n), range::all), Uh, 0, out);
+      }
+      return r;
+    }
+  };
+
+  template <ArrayOfRank<2> M>
+  hermitian_eigensystem(M const &) -> hermitian_eigensystem<get_value_t<M>>;
+
+  /**
+   * f(H) for a symmetric(real) or hermitian(complex) matrix H, and a function f : double -> scalar.
+   * To apply several functions to the same H, use hermitian_eigensystem.
+   */
+  template <ArrayOfRank<2> M, typename F>
+  auto matrix_function(M const &h, F const &f) {
+    return hermitian_eigensystem{h}.apply(f);
+  }
+
+  namespace matrix_function_details {
+
+    // Eigenvalues within -tol * max |lambda| of 0 are considered to be 0
+    inline void check_positive(array<double, 1> const &ev, bool strict, const char *fname) {
+      if (ev.size() == 0) return;
+      double tol = 1.e-14 * std::max(std::abs(ev(0)), std::abs(ev(ev.size() - 1)));
+      if (ev(0) < -tol or (strict and ev(0) <= 0))
+        NDA_RUNTIME_ERROR << fname << " : the matrix is not positive" << (strict ? " definite" : "") << ". Its lowest eigenvalue is " << ev(0);
+    }
+
+  } // namespace matrix_function_details
+
+  /// The square root of a symmetric(real) or hermitian(complex) positive matrix
+  template <ArrayOfRank<2> M>
+  auto sqrtm(M const &h) {
+    auto es = hermitian_eigensystem{h};
+    matrix_function_details::check_positive(es.eigenvalues(), false, "sqrtm");
+    return es.apply([](double x) { return std::sqrt(std::max(x, 0.0)); });
+  }
+
+  /// The logarithm of a symmetric(real) or hermitian(complex) positive definite matrix
+  template <ArrayOfRank<2> M>
+  auto logm(M const &h) {
+    auto es = hermitian_eigensystem{h};
+    matrix_function_details::check_positive(es.eigenvalues(), true, "logm");
+    return es.apply([](double x) { return std::log(x); });
+  }
+
+  // ----------------  expm -------------------------
+
+  namespace matrix_function_details {
+
+    // The Pade approximants r_m of degree m = 3, 5, 7, 9, 13 of exp, and the bounds theta_m on |A|_1 up to which
+    // r_m(A) = exp(A) to double precision (N. J. Higham, SIAM J. Matrix Anal. Appl. 26, 1179 (2005)).
+    inline constexpr std::array<int, 5> pade_degrees   = {3, 5, 7, 9, 13};
+    inline constexpr std::array<double, 5> pade_thetas = {1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1, 2.097847961257068e0,
+                                                          5.371920351148152e0};
+
+    inline constexpr std::array<double, 14> pade_coefficients(int m) {
+      switch (m) {
+        case 3: return {120., 60., 12., 1.};
+        case 5: return {30240., 15120., 3360., 420., 30., 1.};
+        case 7: return {17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1.};
+        case 9: return {17643225600., 8821612800., 2075673600., 302702400., 30270240., 2162160., 110880., 3960., 90., 1.};
+        default:
+          return {64764752532480000., 32382376266240000., 7771770303897600., 1187353796428800., 129060195264000., 10559470521600., 670442572800.,
+                  33522128640., 1323241920., 40840800., 960960., 16380., 182., 1.};
+      }
+    }
+
+    // r_m(A) = (V - U)^-1 (V + U), with U (resp. V) the odd (resp. even) part of the numerator of the approximant
+    template <typename T>
+    matrix<T> pade(matrix<T> const &A, int m) {
+      long n = A.extent(0);
+      auto b = pade_coefficients(m);
+      matrix<T> U(n, n), V(n, n);
+
+      auto A2 = matrix<T>{A * A};
+      if (m < 13) {
+        // powers A^0, A^2, ... A^(m-1)
+        std::vector<matrix<T>> A_pow{matrix<T>(n, n), A2};
+        A_pow[0] = 1;
+        for (int k = 2; 2 * k < m; ++k) A_pow.emplace_back(A_pow.back() * A2);
+        matrix<T> u(n, n);
+        u = 0;
+        V = 0;
+        for (int k = 0; 2 * k < m; ++k) {
+          u += b[2 * k + 1] * A_pow[k];
+          V += b[2 * k] * A_pow[k];
+        }
+        U = A * u;
+      } else {
+        auto A4 = matrix<T>{A2 * A2};
+        auto A6 = matrix<T>{A4 * A2};
+        matrix<T> u = A6 * matrix<T>{b[13] * A6 + b[11] * A4 + b[9] * A2};
+        u += b[7] * A6 + b[5] * A4 + b[3] * A2;
+        u += b[1]; // on the diagonal
+        U = A * u;
+        V = A6 * matrix<T>{b[12] * A6 + b[10] * A4 + b[8] * A2};
+        V += b[6] * A6 + b[4] * A4 + b[2] * A2;
+        V += b[0];
+      }
+
+      matrix<T, F_layout> P = V - U, Q = V + U;
+      array<int, 1> ipiv(n);
+      int info = lapack::getrf(P, ipiv);
+      if (info != 0) NDA_RUNTIME_ERROR << "expm : the Pade denominator is singular, getrf info = " << info;
+      info = lapack::getrs(P, Q, ipiv);
+      if (info != 0) NDA_RUNTIME_ERROR << "expm : error in getrs, info = " << info;
+      return matrix<T>{Q};
+    }
+
+  } // namespace matrix_function_details
+
+  /**
+   * The exponential of a square matrix, by scaling and squaring (N. J. Higham, SIAM J. Matrix Anal. Appl. 26, 1179 (2005)).
+   *
+   * exp(A) = r_m(A / 2^s)^(2^s), with the Pade approximant r_m of the lowest degree m (and the lowest s) accurate
+   * to double precision for the 1-norm of A.
+   * For a hermitian matrix, hermitian_eigensystem is more accurate, and cheaper for several functions of the same matrix.
+   */
+  template <ArrayOfRank<2> M>
+  auto expm(M const &a) {
+    using namespace matrix_function_details;
+    using T = get_value_t<M>;
+    static_assert(blas::is_blas_lapack_v<T>, "expm : the value type must be double or dcomplex");
+    EXPECTS(is_matrix_square(a, true));
+    long n = a.shape()[0];
+    auto A = matrix<T>{a};
+    if (n == 0) return A;
+
+    double norm1 = 0;
+    for (long j = 0; j < n; ++j) {
+      double s = 0;
+      for (long i = 0; i < n; ++i) s += std::abs(A(i, j));
+      norm1 = std::max(norm1, s);
+    }
+
+    for (int u = 0; u < 4; ++u)
+      if (norm1 <= pade_thetas[u]) return pade(A, pade_degrees[u]);
+
+    int s = std::max(0, int(std::ceil(std::log2(norm1 / pade_thetas[4]))));
+    A /= std::pow(2.0, s);
+    auto X = pade(A, 13);
+    for (int k = 0; k < s; ++k) X = matrix<T>{X * X};
+    return X;
+  }
+
+} // namespace nda::linalg
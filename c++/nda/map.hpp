@@ -94,7 +94,11 @@ namespace nda {
 
     template <typename A0, typename... A>
     expr_call<F, A0, A...> operator()(A0 &&a0, A &&... a) const {
+#if defined(NDA_ENFORCE_BOUNDCHECK) or defined(NDA_BOUNDCHECK_HOISTED)
+      if (not((a.shape() == a0.shape()) and ...)) NDA_RUNTIME_ERROR << "map : shape mismatch";
+#else
       EXPECTS(((a.shape() == a0.shape()) && ...)); // same shape
+#endif
       return {f, {std::forward<A0>(a0), std::forward<A>(a)...}};
     }
   };
@@ -72,4 +72,28 @@ namespace nda {
     })(std::forward<A>(a));
   }
 
+  namespace details {
+
+    // The function mapped by conj on arrays.
+    // It is a named type (not a lambda), so that conj(M) can be recognized, e.g. by blas::gemm.
+    struct conj_f {
+      auto operator()(auto const &x) const { return conj(x); }
+    };
+
+  } // namespace details
+
+  /// Maps conj onto the array
+  /// \ingroup ArrayFunction
+  template <Array A>
+  auto conj(A &&a) {
+    return nda::map(details::conj_f{})(std::forward<A>(a));
+  }
+
+  /// True iff A is the lazy expression conj(X) of an array X (e.g. dagger(M) for a complex matrix M)
+  template <typename A>
+  inline constexpr bool is_conj_expr_v = false;
+
+  template <typename X>
+  inline constexpr bool is_conj_expr_v<expr_call<details::conj_f, X>> = true;
+
 } // namespace nda
@@ -28,7 +28,7 @@
 
  ---------  same, no using std::-------
 
-  VIMEXPAND real conj abs2 isnan
+  VIMEXPAND real abs2 isnan
   /// Maps @ onto the array
   /// \ingroup ArrayFunction
   template <Array A>
@@ -99,14 +99,6 @@ namespace nda {
        [](auto const &x) {return real(x); })(std::forward<A>(a));
   }
 
-  /// Maps conj onto the array
-  /// \ingroup ArrayFunction
-  template <Array A>
-  auto conj(A &&a) {
-    return nda::map(
-       [](auto const &x) {return conj(x); })(std::forward<A>(a));
-  }
-
   /// Maps abs2 onto the array
   /// \ingroup ArrayFunction
   template <Array A>
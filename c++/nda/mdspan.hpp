@@ -0,0 +1,204 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <cstddef>
+#include <utility>
+
+#if __has_include(<mdspan>)
+#include <mdspan>
+#define NDA_MDSPAN_NAMESPACE std
+#elif __has_include(<experimental/mdspan>)
+#include <experimental/mdspan>
+#define NDA_MDSPAN_NAMESPACE std::experimental
+#else
+#error "nda/mdspan.hpp requires <mdspan> (C++23) or the reference implementation <experimental/mdspan>"
+#endif
+
+#include "basic_array.hpp"
+#include "basic_array_view.hpp"
+
+/*
+ * Zero-copy conversions between the nda views and mdspan.
+ *
+ *   to_mdspan(a)         : view of an nda array/view as an mdspan
+ *   make_array_view(m)   : view of an mdspan as an nda basic_array_view
+ *
+ * The layouts are mapped as
+ *
+ *   contiguous, C order        <-> layout_right
+ *   contiguous, Fortran order  <-> layout_left
+ *   any other strided layout   <-> layout_stride
+ *
+ * and the static extents of the nda layout are those of the mdspan extents (and conversely).
+ * Both directions only copy the shape and the strides, never the data.
+ */
+
+namespace nda {
+
+  namespace stdex = ::NDA_MDSPAN_NAMESPACE;
+
+  // ----------------  Accessors -------------------------
+
+  /**
+   * An mdspan accessor built on an nda accessor policy (e.g. no_alias_accessor).
+   * The data handle is the pointer of the nda accessor, so the __restrict qualification is kept.
+   */
+  template <typename AccessorPolicy, typename T>
+  struct mdspan_accessor {
+    using nda_accessor_t   = typename AccessorPolicy::template accessor<T>;
+    using offset_policy    = mdspan_accessor;
+    using element_type     = T;
+    using reference        = typename nda_accessor_t::reference;
+    using data_handle_type = typename nda_accessor_t::pointer;
+
+    constexpr reference access(data_handle_type p, std::size_t i) const noexcept { return nda_accessor_t::access(p, i); }
+    constexpr data_handle_type offset(data_handle_type p, std::size_t i) const noexcept { return nda_accessor_t::offset(p, i); }
+  };
+
+  /// The mdspan accessor for an nda accessor policy : stdex::default_accessor for nda::default_accessor, an mdspan_accessor otherwise
+  template <typename AccessorPolicy, typename T>
+  struct to_mdspan_accessor {
+    using type = mdspan_accessor<AccessorPolicy, T>;
+  };
+
+  template <typename T>
+  struct to_mdspan_accessor<default_accessor, T> {
+    using type = stdex::default_accessor<T>;
+  };
+
+  /// The nda accessor policy for an mdspan accessor. Only the accessors with a plain (or __restrict) pointer as data handle can be mapped.
+  template <typename Accessor>
+  struct to_nda_accessor_policy {
+    static_assert(sizeof(Accessor) == 0, "This mdspan accessor has no equivalent nda accessor policy");
+  };
+
+  template <typename T>
+  struct to_nda_accessor_policy<stdex::default_accessor<T>> {
+    using type = default_accessor;
+  };
+
+  template <typename AccessorPolicy, typename T>
+  struct to_nda_accessor_policy<mdspan_accessor<AccessorPolicy, T>> {
+    using type = AccessorPolicy;
+  };
+
+  namespace details {
+
+    // The extents type of the mdspan for a layout : the static extents of the layout are kept, 0 (dynamic) is mapped to dynamic_extent.
+    template <typename Layout, std::size_t... Is>
+    auto mdspan_extents_type_impl(std::index_sequence<Is...>)
+       -> stdex::extents<long, (Layout::static_extents[Is] == 0 ? stdex::dynamic_extent : std::size_t(Layout::static_extents[Is]))...>;
+
+    template <typename Layout>
+    using mdspan_extents_t = decltype(mdspan_extents_type_impl<Layout>(std::make_index_sequence<Layout::rank()>{}));
+
+    // The static extents of the nda layout for an mdspan extents type, encoded.
+    // NB : encode stores each extent on 4 bits, so static extents >= 16 are kept as dynamic extents in nda.
+    template <typename Extents>
+    constexpr uint64_t nda_static_extents() {
+      std::array<int, Extents::rank()> r{};
+      for (std::size_t u = 0; u < Extents::rank(); ++u) {
+        auto e = Extents::static_extent(u);
+        r[u]   = (e != stdex::dynamic_extent and e < 16 ? int(e) : 0);
+      }
+      return encode(r);
+    }
+
+  } // namespace details
+
+  // ----------------  nda -> mdspan -------------------------
+
+  /**
+   * An mdspan on the data of an nda view, without copy.
+   *
+   * The layout is layout_right (resp. layout_left) if the view is contiguous in C (resp. Fortran) order at compile time,
+   * layout_stride otherwise. The static extents of the view are the static extents of the mdspan.
+   * The accessor is stdex::default_accessor, or an mdspan_accessor for the other nda accessor policies.
+   */
+  template <typename T, int R, typename L, char Algebra, typename AccessorPolicy, typename OwningPolicy>
+  auto to_mdspan(basic_array_view<T, R, L, Algebra, AccessorPolicy, OwningPolicy> a) {
+    using layout_t   = typename L::template mapping<R>;
+    using extents_t  = details::mdspan_extents_t<layout_t>;
+    using accessor_t = typename to_mdspan_accessor<AccessorPolicy, T>::type;
+
+    auto ext = [&]<std::size_t... Is>(std::index_sequence<Is...>) { return extents_t{a.shape()[Is]...}; }(std::make_index_sequence<R>{});
+
+    if constexpr (has_contiguous(layout_t::layout_prop) and layout_t::is_stride_order_C()) {
+      return stdex::mdspan<T, extents_t, stdex::layout_right, accessor_t>{a.data(), stdex::layout_right::mapping<extents_t>{ext}};
+    } else if constexpr (has_contiguous(layout_t::layout_prop) and layout_t::is_stride_order_Fortran()) {
+      return stdex::mdspan<T, extents_t, stdex::layout_left, accessor_t>{a.data(), stdex::layout_left::mapping<extents_t>{ext}};
+    } else {
+      return stdex::mdspan<T, extents_t, stdex::layout_stride, accessor_t>{a.data(),
+                                                                           stdex::layout_stride::mapping<extents_t>{ext, a.indexmap().strides()}};
+    }
+  }
+
+  /// An mdspan on the data of an nda array, without copy
+  template <typename T, int R, typename L, char Algebra, typename ContainerPolicy>
+  auto to_mdspan(basic_array<T, R, L, Algebra, ContainerPolicy> &a) {
+    return to_mdspan(a());
+  }
+
+  /// A const mdspan on the data of an nda array, without copy
+  template <typename T, int R, typename L, char Algebra, typename ContainerPolicy>
+  auto to_mdspan(basic_array<T, R, L, Algebra, ContainerPolicy> const &a) {
+    return to_mdspan(a());
+  }
+
+  // ----------------  mdspan -> nda -------------------------
+
+  /**
+   * An nda view on the data of an mdspan, without copy.
+   *
+   * layout_right (resp. layout_left) gives a contiguous view in C (resp. Fortran) order.
+   * layout_stride (e.g. the result of submdspan) gives a strided view, with the stride order StrideOrder.
+   * The stride order is a property of the nda type, used for the loop order : it should match the strides, and it
+   * is checked in NDA_DEBUG mode.
+   *
+   * The static extents of the mdspan are kept in the nda layout, if they are < 16.
+   *
+   * @tparam StrideOrder The encoded stride order of the view, for layout_stride only
+   */
+  template <uint64_t StrideOrder = 0, typename T, typename Extents, typename LayoutPolicy, typename Accessor>
+  auto make_array_view(stdex::mdspan<T, Extents, LayoutPolicy, Accessor> const &m) {
+    static constexpr int R = Extents::rank();
+    using accessor_policy  = typename to_nda_accessor_policy<Accessor>::type;
+
+    static constexpr uint64_t static_extents = details::nda_static_extents<Extents>();
+    static constexpr uint64_t stride_order =
+       (std::is_same_v<LayoutPolicy, stdex::layout_left> ? Fortran_stride_order<R> : (StrideOrder == 0 ? C_stride_order<R> : StrideOrder));
+    static constexpr layout_prop_e layout_prop =
+       (std::is_same_v<LayoutPolicy, stdex::layout_right> or std::is_same_v<LayoutPolicy, stdex::layout_left> ? layout_prop_e::contiguous :
+                                                                                                                  layout_prop_e::none);
+    static_assert(std::is_same_v<LayoutPolicy, stdex::layout_right> or std::is_same_v<LayoutPolicy, stdex::layout_left>
+                     or std::is_same_v<LayoutPolicy, stdex::layout_stride>,
+                  "make_array_view : only the mdspan layouts layout_right, layout_left and layout_stride are supported");
+    static_assert(StrideOrder == 0 or std::is_same_v<LayoutPolicy, stdex::layout_stride>,
+                  "make_array_view : the stride order can only be given for layout_stride");
+
+    using idx_map_t = idx_map<R, static_extents, stride_order, layout_prop>;
+    using layout_t  = typename details::layout_to_policy<idx_map_t>::type;
+
+    std::array<long, R> shape, strides;
+    for (int u = 0; u < R; ++u) {
+      shape[u]   = m.extent(u);
+      strides[u] = m.stride(u);
+    }
+    return basic_array_view<T, R, layout_t, 'A', accessor_policy, borrowed>{idx_map_t{shape, strides}, m.data_handle()};
+  }
+
+} // namespace nda
+
+#undef NDA_MDSPAN_NAMESPACE
@@ -15,6 +15,7 @@
 // Authors: Olivier Parcollet, Nils Wentzell
 
 #pragma once
+#include <atomic>
 #include <limits>
 #include <complex>
 #include <type_traits>
@@ -88,11 +89,13 @@ namespace nda::mem {
   // The block of memory for the arrays
   // Heap (owns the memory on the heap)
   // Shared (shared memory ownership)
+  // Cow (shared until the first write, copy-on-write)
   // Borrowed (no memory ownership)
   // Stack  (on stack)
   // clang-format off
   template <typename T, typename Allocator> struct handle_heap; 
   template <typename T> struct handle_shared; 
+  template <typename T> struct handle_cow; 
   template <typename T> struct handle_borrowed; 
 
   template <typename T, size_t Size> struct handle_stack;
@@ -517,6 +520,121 @@ namespace nda::mem {
     [[nodiscard]] long size() const noexcept { return _size; }
   };
 
+  // ------------------  Copy on write -------------------------------------
+
+  /**
+   * A heap block shared by the copies of the handle, until one of them writes into it.
+   *
+   * The copy constructor only increments a reference count. The first mutable access through a handle
+   * sharing its block (non-const data(), operator[] or mutable_data()) makes a deep copy of the block first.
+   * The const accessors never copy.
+   *
+   * A pointer obtained from the non-const data() (to build a mutable view) can outlive the access, so it makes the
+   * block unique and unshareable : the next copies of this handle are deep copies, and the views stay views of this
+   * handle only. mutable_data() and operator[] detach without that, their results must not be kept across a copy
+   * of the handle.
+   *
+   * A const view of a shareable block is a read-only co-owner of it (shared_block()) : it does not copy, and the next
+   * write through any handle detaches that handle from the block, so the view keeps the values it was taken with.
+   * A const view of an unshareable block is a view of this handle, as a mutable one.
+   *
+   * Thread safety : the reference count is atomic, so that different handles sharing the same block can be copied,
+   * read, viewed, written (and hence detached) concurrently from different threads. As for any other handle,
+   * a given handle must not be written to while it is accessed (or copied) from another thread.
+   */
+  template <typename T>
+  struct handle_cow {
+    static_assert(std::is_nothrow_destructible_v<T>, "nda::mem::handle requires the value_type to have a non-throwing constructor");
+
+    private:
+    using blk_t = handle_heap<T, void>;
+
+    std::shared_ptr<blk_t> _blk; // The shared block. Null for a null handle
+    bool _shareable = true;      // False when a pointer to the block has escaped
+
+    public:
+    using value_type = T;
+
+    handle_cow() = default;
+
+    handle_cow(handle_cow &&x) noexcept = default;
+
+    handle_cow &operator=(handle_cow &&x) noexcept = default;
+
+    // Shares the block, unless it has become unshareable
+    handle_cow(handle_cow const &x) {
+      if (x._blk and not x._shareable)
+        _blk = std::make_shared<blk_t>(*x._blk);
+      else
+        _blk = x._blk;
+    }
+
+    handle_cow &operator=(handle_cow const &x) {
+      *this = handle_cow{x};
+      return *this;
+    }
+
+    // Construct a new block of memory of given size and init if needed.
+    handle_cow(long size) {
+      if (size != 0) _blk = std::make_shared<blk_t>(size);
+    }
+
+    // Set up a memory block of the correct size without initializing it
+    handle_cow(long size, do_not_initialize_t) {
+      if (size != 0) _blk = std::make_shared<blk_t>(size, do_not_initialize);
+    }
+
+    // Set up a memory block of the correct size, initialized to 0
+    handle_cow(long size, init_zero_t) {
+      if (size != 0) _blk = std::make_shared<blk_t>(size, init_zero);
+    }
+
+    /// Makes the block of this handle unique, with a deep copy if it is shared.
+    void detach() {
+      if (not _blk) return;
+      if (_blk.use_count() == 1) {
+        // the other owners have released the block : synchronize with their last reads before writing in place
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return;
+      }
+      _blk = std::make_shared<blk_t>(*_blk);
+    }
+
+    /// Pointer to the unique block, for an immediate write. It is not valid any more after a copy of the handle.
+    T *mutable_data() {
+      detach();
+      return (_blk ? _blk->data() : nullptr);
+    }
+
+    T &operator[](long i) { return mutable_data()[i]; }
+    T const &operator[](long i) const noexcept { return _blk->data()[i]; }
+
+    [[nodiscard]] bool is_null() const noexcept { return _blk == nullptr; }
+
+    /// Number of handles sharing the block
+    [[nodiscard]] long refcount() const noexcept { return _blk.use_count(); }
+
+    /// False if a pointer to the block has escaped : the copies of this handle are deep copies
+    [[nodiscard]] bool is_shareable() const noexcept { return _shareable; }
+
+    // Unlike the other handles, a constant handle gives only T const data
+    [[nodiscard]] T const *data() const noexcept { return (_blk ? _blk->data() : nullptr); }
+
+    // The pointer can outlive the call : the block is made unique and unshareable
+    [[nodiscard]] T *data() {
+      _shareable = false;
+      return mutable_data();
+    }
+
+    /// The block, for a const view to co-own it. Null if the block is unshareable : the view is then a view of this handle.
+    [[nodiscard]] std::shared_ptr<void const> shared_block() const noexcept {
+      if (not _shareable) return {};
+      return _blk;
+    }
+
+    [[nodiscard]] long size() const noexcept { return (_blk ? _blk->size() : 0); }
+  };
+
   // ------------------  Borrowed -------------------------------------
 
   template <typename T>
@@ -526,6 +644,7 @@ namespace nda::mem {
     private:
     handle_heap<T0, void> const *_parent = nullptr; // Parent, Required for regular->shared promotion in Python Converter
     T *_data                             = nullptr; // Pointer to the start of the memory block
+    std::shared_ptr<void const> _owner;             // The copy-on-write block co-owned by a const view, or null
 
     public:
     using value_type = T;
@@ -535,7 +654,7 @@ namespace nda::mem {
     handle_borrowed(T *ptr) noexcept : _data(ptr) {}
     handle_borrowed(handle_borrowed<T> const &x) = default;
 
-    handle_borrowed(handle_borrowed<T> const &x, long offset) noexcept : _data(x.data() + offset) {}
+    handle_borrowed(handle_borrowed<T> const &x, long offset) noexcept : _data(x.data() + offset), _owner(x.owner()) {}
 
     handle_borrowed(handle_heap<T0, void> const &x, long offset = 0) noexcept : _parent(&x), _data(x.data() + offset) {}
 
@@ -543,7 +662,13 @@ namespace nda::mem {
     handle_borrowed(handle_heap<T0, Alloc> const &x, long offset = 0) noexcept : _parent(nullptr), _data(x.data() + offset) {}
 
     handle_borrowed(handle_shared<T0> const &x, long offset = 0) noexcept : _data(x.data() + offset) {}
-    handle_borrowed(handle_borrowed<T0> const &x, long offset = 0) noexcept requires(std::is_const_v<T>) : _data(x.data() + offset) {}
+    handle_borrowed(handle_borrowed<T0> const &x, long offset = 0) noexcept requires(std::is_const_v<T>)
+       : _data(x.data() + offset), _owner(x.owner()) {}
+
+    // A mutable view of a copy-on-write block makes it unique and unshareable, a const view co-owns it (cf handle_cow)
+    handle_borrowed(handle_cow<T0> &x, long offset = 0) requires(not std::is_const_v<T>) : _data(x.data() + offset) {}
+    handle_borrowed(handle_cow<T0> const &x, long offset = 0) noexcept requires(std::is_const_v<T>)
+       : _data(x.data() + offset), _owner(x.shared_block()) {}
 
     template <size_t Size>
     handle_borrowed(handle_stack<T0, Size> const &x, long offset = 0) noexcept : _data(x.data() + offset) {}
@@ -562,6 +687,8 @@ namespace nda::mem {
 
     [[nodiscard]] handle_heap<T0, void> const *parent() const { return _parent; }
 
+    [[nodiscard]] std::shared_ptr<void const> const &owner() const noexcept { return _owner; }
+
     // A const-handle does not entail T const data
     [[nodiscard]] T *data() const noexcept { return _data; }
   };
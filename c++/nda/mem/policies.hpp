@@ -70,6 +70,12 @@ namespace nda {
     using handle = ::nda::mem::handle_shared<T>;
   };
 
+  // Copies share the data until the first write (copy on write). Cf handle_cow for the rules.
+  struct cow {
+    template <typename T, size_t StackSize = 0> // StackSize is ignored in this case, but called in basic_array
+    using handle = ::nda::mem::handle_cow<T>;
+  };
+
   struct borrowed {
     template <typename T>
     using handle = ::nda::mem::handle_borrowed<T>;
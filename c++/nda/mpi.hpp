@@ -19,6 +19,7 @@
 #include "./mpi/reduce.hpp"
 #include "./mpi/scatter.hpp"
 #include "./mpi/gather.hpp"
+#include "./tracing.hpp"
 
 namespace nda {
 
@@ -40,7 +41,80 @@ namespace nda {
     //FIXME : mpi::std::array
     MPI_Bcast(&sh[0], sh.size(), mpi::mpi_type<typename decltype(sh)::value_type>::get(), root, c.get());
     if (c.rank() != root) { resize_or_check_if_view(a, sh); }
+    NDA_TRACE_SET_RANK(mpi::communicator{}.rank());
+    NDA_TRACE_REGION("MPI_Bcast", "mpi", 0, double(a.size()) * sizeof(typename A::value_type));
     MPI_Bcast(a.data(), a.size(), mpi::mpi_type<typename A::value_type>::get(), root, c.get());
   }
 
+  // ----------------  accumulators -------------------------
+
+  namespace accumulator_details {
+
+    // Merges the (n, mean, m2) of all the nodes (Chan et al.), on all the nodes
+    template <typename V1, typename V2>
+    void mpi_merge_welford(long &n, V1 &&mean, V2 &&m2, mpi::communicator c) {
+      long n_tot = mpi::all_reduce(n, c);
+      if (n_tot == 0) return;
+      get_regular_t<V1> w = mean * double(n);
+      get_regular_t<V1> s = mpi_reduce(w, c, 0, true);
+      s /= double(n_tot);
+      get_regular_t<V2> d   = m2 + double(n) * abs2(mean - s);
+      get_regular_t<V2> m2t = mpi_reduce(d, c, 0, true);
+      mean                  = s;
+      m2                    = m2t;
+      n                     = n_tot;
+    }
+
+  } // namespace accumulator_details
+
+  /**
+   * Merges the accumulators of all the nodes : on return, a has the samples of all the nodes, on all the nodes.
+   *
+   * \param a The accumulator
+   * \param c The MPI communicator
+   */
+  template <typename T, int R>
+  void mpi_merge(mean_accumulator<T, R> &a, mpi::communicator c = {}) {
+    long n = a.count();
+    auto mean = a.mean();
+    auto m2   = a.m2();
+    accumulator_details::mpi_merge_welford(n, mean, m2, c);
+    a = mean_accumulator<T, R>{n, std::move(mean), std::move(m2)};
+  }
+
+  /// Merges the accumulators of all the nodes, level by level. The incomplete bins are the ones of each node.
+  template <typename T, int R>
+  void mpi_merge(log_binning_accumulator<T, R> &a, mpi::communicator c = {}) {
+    auto counts = a.counts();
+    auto means  = a.means();
+    auto m2s    = a.m2s();
+    for (long l = 0; l < a.n_levels(); ++l) {
+      long n = counts(l);
+      accumulator_details::mpi_merge_welford(n, means(l, ellipsis{}), m2s(l, ellipsis{}), c);
+      counts(l) = n;
+    }
+    a = log_binning_accumulator<T, R>{a.n_samples(), std::move(counts), std::move(means), std::move(m2s), a.pending()};
+  }
+
+  /**
+   * Merges the complete bins of all the nodes, after binning them to the same bin size.
+   * The incomplete bins are dropped : the result is the same on all the nodes.
+   */
+  template <typename T, int R>
+  void mpi_merge(jackknife_accumulator<T, R> &a, mpi::communicator c = {}) {
+    auto bins      = a.bins();
+    long n_full    = a.n_full_bins();
+    long n_partial = a.n_partial();
+    long bin_size  = a.bin_size();
+    long bs        = mpi::all_reduce(bin_size, c, MPI_MAX);
+    while (bin_size < bs) accumulator_details::rebin(bins, n_full, n_partial, bin_size);
+
+    array<T, R + 1> mine = bins(range(0, n_full), ellipsis{});
+    array<T, R + 1> all  = mpi_gather(mine, c, 0, true);
+    bins()               = T{};
+    jackknife_accumulator<T, R> r{std::move(bins), 0, 0, bs};
+    r.add_bins(all);
+    a = std::move(r);
+  }
+
 } // namespace nda
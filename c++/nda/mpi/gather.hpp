@@ -17,6 +17,8 @@
 #pragma once
 #include <mpi/mpi.hpp>
 
+#include "./../tracing.hpp"
+
 // Models ArrayInitializer concept
 template <nda::Array A>
 struct mpi::lazy<mpi::tag::gather, A> {
@@ -74,6 +76,8 @@ struct mpi::lazy<mpi::tag::gather, A> {
 
     for (int r = 0; r < c.size(); ++r) displs[r + 1] = recvcounts[r] + displs[r];
 
+    NDA_TRACE_SET_RANK(mpi::communicator{}.rank());
+    NDA_TRACE_REGION((all ? "MPI_Allgatherv" : "MPI_Gatherv"), "mpi", 0, double(displs[c.size()]) * sizeof(value_type));
     if (!all)
       MPI_Gatherv((void *)rhs_p, sendcount, D, v_p, &recvcounts[0], &displs[0], D, root, c.get());
     else
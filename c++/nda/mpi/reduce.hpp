@@ -18,6 +18,7 @@
 #include <mpi/mpi.hpp>
 
 #include "./../map.hpp"
+#include "./../tracing.hpp"
 
 // Models ArrayInitializer concept
 template <nda::Array A>
@@ -67,6 +68,8 @@ struct mpi::lazy<mpi::tag::reduce, A> {
       auto rhs_n_elem = rhs.size();
       auto D          = mpi::mpi_type<value_type>::get();
 
+      NDA_TRACE_SET_RANK(mpi::communicator{}.rank());
+      NDA_TRACE_REGION((all ? "MPI_Allreduce" : "MPI_Reduce"), "mpi", 0, double(rhs_n_elem) * sizeof(value_type));
       if (!all) {
         if (in_place)
           MPI_Reduce((c.rank() == root ? MPI_IN_PLACE : rhs_p), rhs_p, rhs_n_elem, D, op, root, c.get());
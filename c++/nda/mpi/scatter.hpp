@@ -17,6 +17,8 @@
 #pragma once
 #include <mpi/mpi.hpp>
 
+#include "./../tracing.hpp"
+
 // Models ArrayInitializer concept
 template <nda::Array A>
 struct mpi::lazy<mpi::tag::scatter, A> {
@@ -66,6 +68,8 @@ struct mpi::lazy<mpi::tag::scatter, A> {
       displs[r + 1] = sendcounts[r] + displs[r];
     }
 
+    NDA_TRACE_SET_RANK(mpi::communicator{}.rank());
+    NDA_TRACE_REGION("MPI_Scatterv", "mpi", 0, double(recvcount) * sizeof(value_type));
     MPI_Scatterv((void *)rhs.data(), &sendcounts[0], &displs[0], D, (void *)target.data(), recvcount, D, root, c.get());
   }
 };
@@ -42,7 +42,15 @@
 #include "mapped_functions.hpp"
 #include "mapped_functions.hxx"
 
+#include "exec.hpp"
 #include "algorithms.hpp"
+#include "sort.hpp"
+#include "reductions.hpp"
+#include "split_complex.hpp"
+#include "sparse.hpp"
+#include "accumulators.hpp"
+#include "diagonal_matrix.hpp"
+#include "bit_array.hpp"
 #include "print.hpp"
 
 #include "layout/rect_str.hpp"
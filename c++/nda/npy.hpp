@@ -0,0 +1,638 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "./nda.hpp"
+
+/*
+ * NumPy .npy and .npz files, without dependency.
+ *
+ *   npy_save(filename, a)               : writes a (any Array of a supported scalar type) in a .npy file
+ *   npy_load<T, R, Layout>(filename)    : reads a .npy file in an array<T, R, Layout>
+ *   npy_mmap<T, R, Layout>(filename)    : maps a .npy file in memory, and gives a view of its data without copy
+ *   npz_writer, npz_reader              : the .npz archives of np.savez (a zip of .npy files)
+ *
+ * Supported value types : bool, the integers, float, double, std::complex<float>, std::complex<double>.
+ * The value type of the file must be the one of the array (no conversion), in either byte order :
+ * a file of the other byte order is byte swapped when it is loaded.
+ *
+ * Memory layout : a C ordered file (fortran_order : False) is a C_layout array, a Fortran ordered file is a F_layout array.
+ * npy_save writes a C_layout array in C order, and a F_layout array in Fortran order, without copy.
+ * Other layouts and non contiguous views are copied in C order first. npy_load copies into the requested layout if needed,
+ * while npy_mmap requires the layout of the file (no copy is possible).
+ *
+ * npz : the archives are written uncompressed (as np.savez). np.savez_compressed archives (deflate) are not supported.
+ */
+
+namespace nda {
+
+  namespace npy_details {
+
+    // ------------------ dtype ------------------
+
+    inline constexpr char native_order = (std::endian::native == std::endian::little ? '<' : '>');
+
+    // The dtype of T, without the byte order, e.g. "f8"
+    template <typename T>
+    std::string dtype() {
+      if constexpr (std::is_same_v<T, bool>)
+        return "b1";
+      else if constexpr (std::is_integral_v<T>)
+        return (std::is_signed_v<T> ? "i" : "u") + std::to_string(sizeof(T));
+      else if constexpr (std::is_floating_point_v<T>)
+        return "f" + std::to_string(sizeof(T));
+      else if constexpr (is_complex_v<T>)
+        return "c" + std::to_string(sizeof(T));
+      else
+        static_assert(always_false<T>, "npy : unsupported value type");
+    }
+
+    // The descr of the header, e.g. "<f8". Single byte types have no byte order ('|').
+    template <typename T>
+    std::string descr() {
+      return (sizeof(T) == 1 ? '|' : native_order) + dtype<T>();
+    }
+
+    // Reverses the bytes of each scalar of [p, p + n[ (the real and imaginary parts for complex)
+    template <typename T>
+    void byteswap(T *p, long n) {
+      constexpr int w = (is_complex_v<T> ? sizeof(T) / 2 : sizeof(T));
+      auto *b         = reinterpret_cast<unsigned char *>(p);
+      for (long i = 0; i < n * long(sizeof(T)) / w; ++i) std::reverse(b + i * w, b + (i + 1) * w);
+    }
+
+    // ------------------ header ------------------
+
+    inline constexpr char magic[] = "\x93NUMPY";
+
+    struct header_t {
+      std::string descr;
+      bool fortran_order = false;
+      std::vector<long> shape;
+      long data_offset = 0; // from the start of the .npy
+
+      [[nodiscard]] long size() const {
+        long s = 1;
+        for (auto n : shape) s *= n;
+        return s;
+      }
+    };
+
+    // The value of key in the header dictionary (the text after "'key':", trimmed up to the next , or })
+    inline std::string dict_value(std::string const &dict, std::string const &key) {
+      auto k = dict.find("'" + key + "'");
+      if (k == std::string::npos) NDA_RUNTIME_ERROR << "npy : no key " << key << " in the header " << dict;
+      auto p = dict.find(':', k) + 1;
+      while (p < dict.size() and dict[p] == ' ') ++p;
+      if (dict[p] == '(') return dict.substr(p, dict.find(')', p) - p + 1);
+      if (dict[p] == '\'') return dict.substr(p + 1, dict.find('\'', p + 1) - p - 1);
+      auto e = dict.find_first_of(",}", p);
+      return dict.substr(p, e - p);
+    }
+
+    // The length of the preamble (magic, version, header length) and of the whole header, from the first 12 bytes of a .npy
+    inline std::pair<long, long> header_length(char const *p, long n) {
+      if (n < 10 or std::memcmp(p, magic, 6) != 0) NDA_RUNTIME_ERROR << "npy : not a .npy file";
+      auto byte = [p](int i) { return long(static_cast<unsigned char>(p[i])); };
+      int major = int(byte(6));
+      if (major == 1) return {10, 10 + (byte(8) | byte(9) << 8)};
+      if ((major != 2 and major != 3) or n < 12) NDA_RUNTIME_ERROR << "npy : unsupported version " << major;
+      return {12, 12 + (byte(8) | byte(9) << 8 | byte(10) << 16 | byte(11) << 24)};
+    }
+
+    // Parses the header from the first bytes of a .npy (at least the whole header)
+    inline header_t parse_header(char const *p, long n) {
+      auto [start, end] = header_length(p, n);
+      if (end > n) NDA_RUNTIME_ERROR << "npy : truncated header";
+      long len = end - start;
+      std::string dict(p + start, len);
+
+      header_t h;
+      h.descr         = dict_value(dict, "descr");
+      h.fortran_order = (dict_value(dict, "fortran_order") == "True");
+      h.data_offset   = start + len;
+      auto sh         = dict_value(dict, "shape"); // e.g. "(3, 4)", "(5,)", "()"
+      std::stringstream ss(sh.substr(1, sh.size() - 2));
+      std::string item;
+      while (std::getline(ss, item, ','))
+        if (item.find_first_not_of(' ') != std::string::npos) h.shape.push_back(std::stol(item));
+      return h;
+    }
+
+    // The complete header of an array of the given descr, shape and order, padded so that the data is aligned on 64 bytes
+    inline std::string make_header(std::string const &descr, bool fortran_order, std::vector<long> const &shape) {
+      std::string dict = "{'descr': '" + descr + "', 'fortran_order': " + (fortran_order ? "True" : "False") + ", 'shape': (";
+      for (auto n : shape) dict += std::to_string(n) + ", ";
+      if (shape.size() > 1) dict.resize(dict.size() - 2);   // (3, 4)
+      if (shape.size() == 1) dict.resize(dict.size() - 1); // (3,)
+      dict += "), }";
+
+      bool v2     = (dict.size() + 11 > 65535);
+      long start  = (v2 ? 12 : 10);
+      long total  = ((start + long(dict.size()) + 1 + 63) / 64) * 64;
+      long len    = total - start;
+      dict.append(len - dict.size() - 1, ' ');
+      dict += '\n';
+
+      std::string h(magic, 6);
+      h += char(v2 ? 2 : 1);
+      h += char(0);
+      for (int i = 0; i < (v2 ? 4 : 2); ++i) h += char((len >> (8 * i)) & 0xff);
+      return h + dict;
+    }
+
+    // Checks that the descr of the file is the one of T. Returns true if the data must be byte swapped.
+    template <typename T>
+    bool check_descr(header_t const &h) {
+      auto d = h.descr;
+      if (d.size() < 2 or d.substr(1) != dtype<T>())
+        NDA_RUNTIME_ERROR << "npy : the file contains " << d << ", not " << descr<T>() << " (no conversion is done)";
+      return (sizeof(T) > 1 and d[0] != '|' and d[0] != '=' and d[0] != native_order);
+    }
+
+    template <int R>
+    std::array<long, R> check_shape(header_t const &h) {
+      if (long(h.shape.size()) != R) NDA_RUNTIME_ERROR << "npy : the file has rank " << h.shape.size() << ", not " << R;
+      std::array<long, R> sh;
+      std::copy(h.shape.begin(), h.shape.end(), sh.begin());
+      return sh;
+    }
+
+    // Reads an array from the header and read_data(ptr, n_bytes), which copies the data of the file in ptr
+    template <typename T, int R, typename Layout, typename F>
+    array<T, R, Layout> load(header_t const &h, F read_data) {
+      bool swap = check_descr<T>(h);
+      auto sh   = check_shape<R>(h);
+      auto read = [&](auto &a) {
+        read_data(static_cast<void *>(a.data()), a.size() * long(sizeof(T)));
+        if (swap) byteswap(a.data(), a.size());
+      };
+
+      // same order in the file and in memory : read in place, otherwise through an array of the order of the file
+      using map_t = typename Layout::template mapping<R>;
+      bool same   = (R <= 1) or (h.fortran_order ? map_t::is_stride_order_Fortran() : map_t::is_stride_order_C());
+      array<T, R, Layout> r(sh);
+      if (same) {
+        read(r);
+      } else if (h.fortran_order) {
+        array<T, R, F_layout> f(sh);
+        read(f);
+        r = f;
+      } else {
+        array<T, R> c(sh);
+        read(c);
+        r = c;
+      }
+      return r;
+    }
+
+    // Writes the .npy of a with write(ptr, n_bytes) : the header, then the data, in place if a is C or Fortran contiguous,
+    // otherwise through a copy in C order
+    template <MemoryArray A, typename F>
+    void write_npy(A const &a, F write) {
+      using T           = std::remove_const_t<get_value_t<A>>;
+      constexpr int R   = get_rank<A>;
+      auto const &shape = a.shape();
+      bool contiguous   = a.indexmap().is_contiguous();
+      bool f_order      = contiguous and R > 1 and A::layout_t::is_stride_order_Fortran();
+      bool c_order      = contiguous and (R <= 1 or A::layout_t::is_stride_order_C());
+      auto header       = make_header(descr<T>(), f_order, std::vector<long>(shape.begin(), shape.end()));
+      write(header.data(), long(header.size()));
+      if (c_order or f_order) {
+        write(a.data(), long(a.size() * sizeof(T)));
+      } else {
+        array<T, R> c(a);
+        write(c.data(), long(c.size() * sizeof(T)));
+      }
+    }
+
+    // The bytes of a .npy of a
+    template <MemoryArray A>
+    std::string to_bytes(A const &a) {
+      std::string r;
+      write_npy(a, [&r](void const *p, long n) { r.append(static_cast<char const *>(p), n); });
+      return r;
+    }
+
+  } // namespace npy_details
+
+  // --------------- .npy -----------------------
+
+  /// Writes a in the .npy file filename
+  template <Array A>
+  void npy_save(std::string const &filename, A const &a) {
+    if constexpr (not MemoryArray<A>) {
+      npy_save(filename, make_regular(a));
+    } else {
+      std::ofstream f(filename, std::ios::binary);
+      if (not f) NDA_RUNTIME_ERROR << "npy : cannot open " << filename;
+      npy_details::write_npy(a, [&f](void const *p, long n) { f.write(static_cast<char const *>(p), n); });
+      if (not f) NDA_RUNTIME_ERROR << "npy : error writing " << filename;
+    }
+  }
+
+  /// Reads the .npy file filename. The value type and the rank must be the ones of the file.
+  template <typename T, int R, typename Layout = C_layout>
+  array<T, R, Layout> npy_load(std::string const &filename) {
+    std::ifstream f(filename, std::ios::binary);
+    if (not f) NDA_RUNTIME_ERROR << "npy : cannot open " << filename;
+    // the preamble gives the length of the header
+    std::string head(12, '\0');
+    f.read(head.data(), 12);
+    auto [start, end] = npy_details::header_length(head.data(), f.gcount());
+    head.resize(end);
+    f.seekg(0);
+    f.read(head.data(), end);
+    auto h = npy_details::parse_header(head.data(), f.gcount());
+    return npy_details::load<T, R, Layout>(h, [&](void *p, long n) {
+      f.read(static_cast<char *>(p), n);
+      if (f.gcount() != n) NDA_RUNTIME_ERROR << "npy : " << filename << " is truncated";
+    });
+  }
+
+  /**
+   * A .npy file mapped in memory (read only). view() is a view of its data, without copy, valid as long as the mapping.
+   *
+   * The value type, the rank, the byte order and the memory order (C_layout or F_layout) must be the ones of the file.
+   */
+  template <typename T, int R, typename Layout = C_layout>
+  class npy_mapping {
+    void *_addr = nullptr;
+    size_t _len = 0;
+    array_const_view<T, R, Layout> _v;
+
+    public:
+    explicit npy_mapping(std::string const &filename) {
+      int fd = ::open(filename.c_str(), O_RDONLY);
+      if (fd < 0) NDA_RUNTIME_ERROR << "npy : cannot open " << filename;
+      struct stat st {};
+      fstat(fd, &st);
+      _len  = st.st_size;
+      _addr = (_len == 0 ? MAP_FAILED : mmap(nullptr, _len, PROT_READ, MAP_PRIVATE, fd, 0));
+      ::close(fd);
+      if (_addr == MAP_FAILED) {
+        _addr = nullptr;
+        NDA_RUNTIME_ERROR << "npy : cannot map " << filename;
+      }
+
+      auto const *p = static_cast<char const *>(_addr);
+      auto h        = npy_details::parse_header(p, long(_len));
+      try {
+        if (npy_details::check_descr<T>(h)) NDA_RUNTIME_ERROR << "npy : " << filename << " has the other byte order, it can not be mapped (use npy_load)";
+        using map_t = typename Layout::template mapping<R>;
+        bool same   = (R <= 1) or (h.fortran_order ? map_t::is_stride_order_Fortran() : map_t::is_stride_order_C());
+        if (not same) NDA_RUNTIME_ERROR << "npy : the memory order of " << filename << " is not the one of the Layout, it can not be mapped (use npy_load)";
+        auto sh = npy_details::check_shape<R>(h);
+        if (h.data_offset + h.size() * long(sizeof(T)) > long(_len)) NDA_RUNTIME_ERROR << "npy : " << filename << " is truncated";
+        if (h.data_offset % alignof(T) != 0) NDA_RUNTIME_ERROR << "npy : the data of " << filename << " is not aligned";
+        _v.rebind(array_const_view<T, R, Layout>{sh, reinterpret_cast<T const *>(p + h.data_offset)});
+      } catch (...) {
+        munmap(_addr, _len);
+        throw;
+      }
+    }
+
+    npy_mapping(npy_mapping const &)            = delete;
+    npy_mapping &operator=(npy_mapping const &) = delete;
+
+    npy_mapping(npy_mapping &&x) noexcept : _addr(std::exchange(x._addr, nullptr)), _len(x._len), _v(x._v) {}
+
+    npy_mapping &operator=(npy_mapping &&x) noexcept {
+      std::swap(_addr, x._addr);
+      std::swap(_len, x._len);
+      _v.rebind(x._v);
+      return *this;
+    }
+
+    ~npy_mapping() {
+      if (_addr != nullptr) munmap(_addr, _len);
+    }
+
+    /// The data of the file
+    [[nodiscard]] array_const_view<T, R, Layout> const &view() const { return _v; }
+  };
+
+  /// Maps the .npy file filename in memory, cf npy_mapping
+  template <typename T, int R, typename Layout = C_layout>
+  npy_mapping<T, R, Layout> npy_mmap(std::string const &filename) {
+    return npy_mapping<T, R, Layout>{filename};
+  }
+
+  // --------------- .npz -----------------------
+
+  namespace npy_details {
+
+    inline std::uint32_t crc32(char const *p, long n) {
+      static auto const table = [] {
+        std::array<std::uint32_t, 256> t{};
+        for (std::uint32_t i = 0; i < 256; ++i) {
+          std::uint32_t c = i;
+          for (int k = 0; k < 8; ++k) c = (c & 1 ? 0xedb88320u ^ (c >> 1) : c >> 1);
+          t[i] = c;
+        }
+        return t;
+      }();
+      std::uint32_t c = 0xffffffffu;
+      for (long i = 0; i < n; ++i) c = table[(c ^ static_cast<unsigned char>(p[i])) & 0xff] ^ (c >> 8);
+      return c ^ 0xffffffffu;
+    }
+
+    // Little endian integers of the zip format
+    inline void put(std::string &out, std::uint64_t x, int n_bytes) {
+      for (int i = 0; i < n_bytes; ++i) out += char((x >> (8 * i)) & 0xff);
+    }
+
+    inline std::uint64_t get(char const *p, int n_bytes) {
+      std::uint64_t x = 0;
+      for (int i = n_bytes - 1; i >= 0; --i) x = (x << 8) | static_cast<unsigned char>(p[i]);
+      return x;
+    }
+
+    inline constexpr std::uint64_t zip32_max = 0xffffffffu;
+
+  } // namespace npy_details
+
+  /**
+   * Writes a .npz archive, as np.savez : one uncompressed .npy file per array.
+   *
+   *    npz_writer w("data.npz");
+   *    w.add("a", a);       // np.load("data.npz")["a"]
+   *    w.add("b", b);
+   *    w.close();           // or at destruction
+   *
+   * Archives or arrays larger than 4 GB use the zip64 extensions.
+   */
+  class npz_writer {
+    struct entry_t {
+      std::string name;
+      std::uint32_t crc   = 0;
+      std::uint64_t size  = 0;
+      std::uint64_t offset = 0;
+    };
+    std::ofstream out;
+    std::vector<entry_t> entries;
+    std::uint64_t pos = 0;
+
+    void write(std::string const &s) {
+      out.write(s.data(), long(s.size()));
+      pos += s.size();
+    }
+
+    public:
+    explicit npz_writer(std::string const &filename) : out(filename, std::ios::binary) {
+      if (not out) NDA_RUNTIME_ERROR << "npz : cannot open " << filename;
+    }
+
+    npz_writer(npz_writer const &)            = delete;
+    npz_writer &operator=(npz_writer const &) = delete;
+
+    ~npz_writer() {
+      try {
+        close();
+      } catch (...) {}
+    }
+
+    /// Adds a as name.npy
+    template <Array A>
+    void add(std::string const &name, A const &a) {
+      using namespace npy_details;
+      EXPECTS(out.is_open());
+      std::string data;
+      if constexpr (MemoryArray<A>)
+        data = to_bytes(a);
+      else
+        data = to_bytes(make_regular(a));
+      entry_t e{name + ".npy", crc32(data.data(), long(data.size())), data.size(), pos};
+      bool z64 = (e.size >= zip32_max or e.offset >= zip32_max);
+
+      // local file header
+      std::string h;
+      put(h, 0x04034b50, 4);
+      put(h, z64 ? 45 : 20, 2); // version needed
+      put(h, 0, 2);             // flags
+      put(h, 0, 2);             // stored
+      put(h, 0, 2);             // time
+      put(h, 0x21, 2);          // date : 1980-01-01
+      put(h, e.crc, 4);
+      put(h, z64 ? zip32_max : e.size, 4);
+      put(h, z64 ? zip32_max : e.size, 4);
+      put(h, e.name.size(), 2);
+      put(h, z64 ? 20 : 0, 2);
+      h += e.name;
+      if (z64) {
+        put(h, 0x0001, 2);
+        put(h, 16, 2);
+        put(h, e.size, 8);
+        put(h, e.size, 8);
+      }
+      write(h);
+      write(data);
+      entries.push_back(std::move(e));
+    }
+
+    /// Writes the central directory and closes the file. No array can be added after.
+    void close() {
+      using namespace npy_details;
+      if (not out.is_open()) return;
+      std::uint64_t cd_offset = pos;
+      for (auto const &e : entries) {
+        bool z64 = (e.size >= zip32_max or e.offset >= zip32_max);
+        std::string h;
+        put(h, 0x02014b50, 4);
+        put(h, z64 ? 45 : 20, 2); // version made by
+        put(h, z64 ? 45 : 20, 2); // version needed
+        put(h, 0, 2);
+        put(h, 0, 2);
+        put(h, 0, 2);
+        put(h, 0x21, 2);
+        put(h, e.crc, 4);
+        put(h, z64 ? zip32_max : e.size, 4);
+        put(h, z64 ? zip32_max : e.size, 4);
+        put(h, e.name.size(), 2);
+        put(h, z64 ? 28 : 0, 2); // extra
+        put(h, 0, 2);            // comment
+        put(h, 0, 2);            // disk
+        put(h, 0, 2);            // internal attributes
+        put(h, 0, 4);            // external attributes
+        put(h, z64 ? zip32_max : e.offset, 4);
+        h += e.name;
+        if (z64) {
+          put(h, 0x0001, 2);
+          put(h, 24, 2);
+          put(h, e.size, 8);
+          put(h, e.size, 8);
+          put(h, e.offset, 8);
+        }
+        write(h);
+      }
+      std::uint64_t cd_size = pos - cd_offset, n = entries.size();
+      bool z64              = (cd_offset >= zip32_max or n >= 0xffff);
+      std::string h;
+      if (z64) { // zip64 end of central directory, and its locator
+        std::uint64_t eocd64 = pos;
+        put(h, 0x06064b50, 4);
+        put(h, 44, 8);
+        put(h, 45, 2);
+        put(h, 45, 2);
+        put(h, 0, 4);
+        put(h, 0, 4);
+        put(h, n, 8);
+        put(h, n, 8);
+        put(h, cd_size, 8);
+        put(h, cd_offset, 8);
+        put(h, 0x07064b50, 4);
+        put(h, 0, 4);
+        put(h, eocd64, 8);
+        put(h, 1, 4);
+      }
+      put(h, 0x06054b50, 4);
+      put(h, 0, 2);
+      put(h, 0, 2);
+      put(h, std::min<std::uint64_t>(n, 0xffff), 2);
+      put(h, std::min<std::uint64_t>(n, 0xffff), 2);
+      put(h, std::min(cd_size, zip32_max), 4);
+      put(h, std::min(cd_offset, zip32_max), 4);
+      put(h, 0, 2);
+      write(h);
+      out.close();
+      if (out.fail()) NDA_RUNTIME_ERROR << "npz : error writing the archive";
+    }
+  };
+
+  /**
+   * Reads a .npz archive (np.savez, uncompressed).
+   *
+   *    npz_reader r("data.npz");
+   *    auto a = r.load<double, 2>("a");
+   */
+  class npz_reader {
+    struct entry_t {
+      std::uint32_t crc       = 0;
+      std::uint16_t method    = 0;
+      std::uint64_t size      = 0;
+      std::uint64_t local_pos = 0;
+    };
+    std::string filename;
+    mutable std::ifstream in;
+    std::vector<std::pair<std::string, entry_t>> entries;
+
+    std::string read_at(std::uint64_t pos, long n) const {
+      std::string s(n, '\0');
+      in.clear();
+      in.seekg(long(pos));
+      in.read(s.data(), n);
+      if (in.gcount() != n) NDA_RUNTIME_ERROR << "npz : " << filename << " is truncated";
+      return s;
+    }
+
+    public:
+    explicit npz_reader(std::string const &filename_) : filename(filename_), in(filename_, std::ios::binary) {
+      using npy_details::get;
+      using npy_details::zip32_max;
+      if (not in) NDA_RUNTIME_ERROR << "npz : cannot open " << filename;
+      in.seekg(0, std::ios::end);
+      long file_size = in.tellg();
+
+      // the end of central directory record is in the last 22 + 65535 (comment) bytes
+      long tail_size = std::min(file_size, 22l + 65535l);
+      auto tail      = read_at(file_size - tail_size, tail_size);
+      long e         = tail_size - 22;
+      while (e >= 0 and get(tail.data() + e, 4) != 0x06054b50) --e;
+      if (e < 0) NDA_RUNTIME_ERROR << "npz : " << filename << " is not a zip archive";
+      std::uint64_t n         = get(tail.data() + e + 10, 2);
+      std::uint64_t cd_size   = get(tail.data() + e + 12, 4);
+      std::uint64_t cd_offset = get(tail.data() + e + 16, 4);
+
+      // zip64 : the locator is just before
+      if (e >= 20 and get(tail.data() + e - 20, 4) == 0x07064b50) {
+        auto z    = read_at(get(tail.data() + e - 20 + 8, 8), 56);
+        n         = get(z.data() + 32, 8);
+        cd_size   = get(z.data() + 40, 8);
+        cd_offset = get(z.data() + 48, 8);
+      }
+
+      auto cd       = read_at(cd_offset, long(cd_size));
+      char const *p = cd.data();
+      for (std::uint64_t i = 0; i < n; ++i) {
+        if (get(p, 4) != 0x02014b50) NDA_RUNTIME_ERROR << "npz : corrupted central directory in " << filename;
+        entry_t en;
+        en.method      = get(p + 10, 2);
+        en.crc         = get(p + 16, 4);
+        en.size        = get(p + 24, 4);
+        en.local_pos   = get(p + 42, 4);
+        long name_len  = get(p + 28, 2);
+        long extra_len = get(p + 30, 2), comment_len = get(p + 32, 2);
+        std::string name(p + 46, name_len);
+        // zip64 extra field : the values which are 0xffffffff above, in this order
+        for (char const *x = p + 46 + name_len; x < p + 46 + name_len + extra_len; x += 4 + get(x + 2, 2)) {
+          if (get(x, 2) != 0x0001) continue;
+          char const *v = x + 4;
+          if (en.size == zip32_max) { en.size = get(v, 8), v += 8; }
+          if (get(p + 20, 4) == zip32_max) v += 8; // compressed size
+          if (en.local_pos == zip32_max) en.local_pos = get(v, 8);
+        }
+        if (name.size() > 4 and name.substr(name.size() - 4) == ".npy") name.resize(name.size() - 4);
+        entries.emplace_back(name, en);
+        p += 46 + name_len + extra_len + comment_len;
+      }
+    }
+
+    /// The names of the arrays
+    [[nodiscard]] std::vector<std::string> names() const {
+      std::vector<std::string> r;
+      for (auto const &[name, e] : entries) r.push_back(name);
+      return r;
+    }
+
+    /// Is there an array name ?
+    [[nodiscard]] bool contains(std::string const &name) const {
+      return std::any_of(entries.begin(), entries.end(), [&](auto const &x) { return x.first == name; });
+    }
+
+    /// Reads the array name. The value type and the rank must be the ones of the file.
+    template <typename T, int R, typename Layout = C_layout>
+    array<T, R, Layout> load(std::string const &name) const {
+      using npy_details::get;
+      auto it = std::find_if(entries.begin(), entries.end(), [&](auto const &x) { return x.first == name; });
+      if (it == entries.end()) NDA_RUNTIME_ERROR << "npz : no array " << name << " in " << filename;
+      auto const &e = it->second;
+      if (e.method != 0) NDA_RUNTIME_ERROR << "npz : " << name << " is compressed (np.savez_compressed), which is not supported";
+      auto local = read_at(e.local_pos, 30);
+      auto data  = read_at(e.local_pos + 30 + get(local.data() + 26, 2) + get(local.data() + 28, 2), long(e.size));
+      if (npy_details::crc32(data.data(), long(data.size())) != e.crc) NDA_RUNTIME_ERROR << "npz : " << name << " is corrupted (crc)";
+      auto h = npy_details::parse_header(data.data(), long(data.size()));
+      if (h.data_offset + h.size() * long(sizeof(T)) > long(data.size())) NDA_RUNTIME_ERROR << "npz : " << name << " is truncated";
+      return npy_details::load<T, R, Layout>(h, [&](void *p, long n) { std::memcpy(p, data.data() + h.data_offset, n); });
+    }
+  };
+
+} // namespace nda
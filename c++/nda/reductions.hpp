@@ -0,0 +1,423 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <algorithm>
+
+namespace nda {
+
+  // --------------- reducers  ------------------------
+
+  // The binary operations of the axis reductions and scans.
+  // idempotent : op(x, x) == x, so the result can be initialized with any element, without identity.
+  namespace reducers {
+
+    struct sum {
+      static constexpr bool idempotent = false;
+      template <typename T>
+      static T identity() {
+        return T{0};
+      }
+      template <typename X, typename Y>
+      static auto op(X const &x, Y const &y) {
+        return x + y;
+      }
+    };
+
+    struct product {
+      static constexpr bool idempotent = false;
+      template <typename T>
+      static T identity() {
+        return T{1};
+      }
+      template <typename X, typename Y>
+      static auto op(X const &x, Y const &y) {
+        return x * y;
+      }
+    };
+
+    struct max {
+      static constexpr bool idempotent = true;
+      template <typename X, typename Y>
+      static auto op(X const &x, Y const &y) {
+        return (y > x ? y : x);
+      }
+    };
+
+    struct min {
+      static constexpr bool idempotent = true;
+      template <typename X, typename Y>
+      static auto op(X const &x, Y const &y) {
+        return (y < x ? y : x);
+      }
+    };
+
+  } // namespace reducers
+
+  namespace details {
+
+    // Calls f(o1, o2, n, d1, d2) for each line of the fastest (last) dimension, where
+    // o1, o2 are the offsets of the first element of the line, n the length of the line and d1, d2 the strides along it.
+    // The lengths and strides must already be in the order of the loops (slowest first).
+    template <size_t R, typename F>
+    void for_each_line(std::array<long, R> const &len, std::array<long, R> const &s1, std::array<long, R> const &s2, F &&f) {
+      static_assert(R > 0);
+      for (auto l : len)
+        if (l == 0) return;
+      std::array<long, R> idx{};
+      long o1 = 0, o2 = 0;
+      while (true) {
+        f(o1, o2, len[R - 1], s1[R - 1], s2[R - 1]);
+        int u = int(R) - 2;
+        for (; u >= 0; --u) {
+          o1 += s1[u];
+          o2 += s2[u];
+          if (++idx[u] < len[u]) break;
+          o1 -= idx[u] * s1[u];
+          o2 -= idx[u] * s2[u];
+          idx[u] = 0;
+        }
+        if (u < 0) return;
+      }
+    }
+
+    // for_each_line, in parallel (nda::exec) : the range of the dimension k is cut into chunks, run by different threads.
+    // f must not write to the same place for two different indices along k.
+    template <size_t R, typename F>
+    void parallel_for_each_line(int k, std::array<long, R> const &len, std::array<long, R> const &s1, std::array<long, R> const &s2, F &&f) {
+      for (auto l : len)
+        if (l == 0) return;
+      long work = 1; // the number of elements for one index along k
+      for (int u = 0; u < int(R); ++u)
+        if (u != k) work *= len[u];
+      exec::parallel_for_chunks(
+         len[k],
+         [&](long b, long e) {
+           auto l = len;
+           l[k]   = e - b;
+           for_each_line(l, s1, s2, [&f, o1 = b * s1[k], o2 = b * s2[k]](long x1, long x2, long n, long d1, long d2) { f(o1 + x1, o2 + x2, n, d1, d2); });
+         },
+         0, work);
+    }
+
+    // The permutation sorting the dimensions by decreasing strides, i.e. the memory order, whatever the layout.
+    template <size_t R>
+    std::array<int, R> memory_order(std::array<long, R> const &str) {
+      std::array<int, R> p;
+      for (int u = 0; u < int(R); ++u) p[u] = u;
+      std::stable_sort(p.begin(), p.end(), [&str](int i, int j) { return std::abs(str[i]) > std::abs(str[j]); });
+      return p;
+    }
+
+    template <size_t R>
+    std::array<long, R> apply_permutation(std::array<int, R> const &p, std::array<long, R> const &a) {
+      std::array<long, R> r;
+      for (int u = 0; u < int(R); ++u) r[u] = a[p[u]];
+      return r;
+    }
+
+    // An array in memory with a strided layout (e.g. not tiled_layout) : the loops of the reductions can run on its strides
+    template <typename A>
+    concept StridedMemoryArray = MemoryArray<A> and requires(A const &a) { a.indexmap().strides(); };
+
+    // Sorted, checked list of axes of a reduction over an array of rank R
+    template <int R, int... Axes>
+    constexpr std::array<int, sizeof...(Axes)> sorted_axes() {
+      std::array<int, sizeof...(Axes)> r{Axes...};
+      std::sort(r.begin(), r.end());
+      for (int u = 0; u < int(r.size()); ++u) {
+        if (r[u] < 0 or r[u] >= R) throw "Axis out of range";
+        if (u > 0 and r[u] == r[u - 1]) throw "Repeated axis";
+      }
+      return r;
+    }
+
+  } // namespace details
+
+  // --------------- expr_reduce  ------------------------
+
+  /**
+   * Lazy reduction of an array A along the axes Axes..., with the operation Reducer
+   *
+   * It models Array : it can be used in expressions, in which case each element is computed on demand.
+   * When assigned to an array, it is instead evaluated in one pass over A, following its memory layout.
+   */
+  template <typename Reducer, typename A, int... Axes>
+  struct expr_reduce {
+    using A_t = std::decay_t<A>;
+
+    static constexpr int rank_in = get_rank<A_t>;
+    static constexpr int n_axes  = sizeof...(Axes);
+    static constexpr int rank    = rank_in - n_axes;
+    static_assert(n_axes > 0, "Internal error");
+    static_assert(rank > 0, "Reduction over all axes : use the reduction without axes, e.g. sum(a)");
+
+    static constexpr std::array<int, n_axes> axes = details::sorted_axes<rank_in, Axes...>();
+
+    // the axes which are kept, in order
+    static constexpr std::array<int, rank> kept_axes = []() {
+      std::array<int, rank> r{};
+      for (int u = 0, v = 0; u < rank_in; ++u)
+        if (std::find(axes.begin(), axes.end(), u) == axes.end()) r[v++] = u;
+      return r;
+    }();
+
+    using value_type = std::decay_t<decltype(Reducer::op(get_value_t<A_t>{}, get_value_t<A_t>{}))>;
+
+    A a;
+
+    [[nodiscard]] std::array<long, rank> shape() const {
+      auto sh = a.shape();
+      std::array<long, rank> r;
+      for (int u = 0; u < rank; ++u) r[u] = sh[kept_axes[u]];
+      return r;
+    }
+
+    [[nodiscard]] long size() const { return stdutil::product(shape()); }
+
+    template <typename... Args>
+    value_type operator()(Args const &...args) const {
+      static_assert(sizeof...(Args) == rank, "Incorrect number of arguments");
+      auto sh = a.shape();
+      std::array<long, rank_in> idx{};
+      std::array<long, rank> out{long(args)...};
+      for (int u = 0; u < rank; ++u) idx[kept_axes[u]] = out[u];
+
+      std::array<long, n_axes> sh_r;
+      for (int u = 0; u < n_axes; ++u) sh_r[u] = sh[axes[u]];
+
+      value_type r{};
+      bool first = true;
+      if constexpr (not Reducer::idempotent) {
+        r     = Reducer::template identity<value_type>();
+        first = false;
+      }
+      nda::for_each(sh_r, [&](auto const &...js) {
+        std::array<long, n_axes> j{long(js)...};
+        for (int u = 0; u < n_axes; ++u) idx[axes[u]] = j[u];
+        auto x = std::apply(a, idx);
+        r      = (first ? value_type(x) : value_type(Reducer::op(r, x)));
+        first  = false;
+      });
+      EXPECTS_WITH_MESSAGE(not first, "Reduction of an empty array");
+      return r;
+    }
+
+    /**
+     * Evaluates the reduction into target.
+     * If A is in memory, the loops follow the memory order of A (the stride order, computed at runtime),
+     * and the innermost loop is either a contiguous reduction or a elementwise accumulation, both vectorizable.
+     * The loops are run in parallel (nda::exec) over the slowest kept dimension, so that each thread writes its own part of target.
+     * Otherwise (A is lazy, or A or target is not strided, e.g. tiled), the evaluation is an elementwise sequential loop.
+     */
+    template <typename V>
+    void evaluate_into(V &target) const {
+      EXPECTS(target.shape() == shape());
+      using T   = get_value_t<V>;
+      auto sh   = a.shape();
+      auto init = [&](auto const &...is) {
+        if constexpr (Reducer::idempotent) {
+          std::array<long, rank_in> idx{};
+          std::array<long, rank> out{long(is)...};
+          for (int u = 0; u < rank; ++u) idx[kept_axes[u]] = out[u];
+          target(is...) = std::apply(a, idx);
+        } else {
+          target(is...) = Reducer::template identity<T>();
+        }
+      };
+      if constexpr (Reducer::idempotent) {
+        for (int u = 0; u < n_axes; ++u) EXPECTS_WITH_MESSAGE(sh[axes[u]] > 0, "Reduction of an empty array");
+      }
+      nda::for_each(target.shape(), init);
+
+      if constexpr (details::StridedMemoryArray<A_t> and details::StridedMemoryArray<V>) {
+        // strides of the target, seen as an array of rank rank_in, with stride 0 on the reduced axes
+        auto const &st_a = a.indexmap().strides();
+        auto const &st_t = target.indexmap().strides();
+        std::array<long, rank_in> st{};
+        for (int u = 0; u < rank; ++u) st[kept_axes[u]] = st_t[u];
+
+        auto p           = details::memory_order(st_a);
+        auto const *pa   = a.data();
+        T *__restrict pt = target.data();
+        auto st_p        = details::apply_permutation(p, st);
+        int k            = 0; // the slowest kept dimension, in the loop order
+        while (std::find(kept_axes.begin(), kept_axes.end(), p[k]) == kept_axes.end()) ++k;
+        details::parallel_for_each_line(k, details::apply_permutation(p, sh), details::apply_permutation(p, st_a), st_p,
+                                        [pa, pt](long oa, long ot, long n, long da, long dt) {
+                                          if (dt == 0) { // reduction along the line
+                                            T acc = pt[ot];
+                                            for (long i = 0; i < n; ++i) acc = Reducer::op(acc, pa[oa + i * da]);
+                                            pt[ot] = acc;
+                                          } else {
+                                            for (long i = 0; i < n; ++i) pt[ot + i * dt] = Reducer::op(pt[ot + i * dt], pa[oa + i * da]);
+                                          }
+                                        });
+      } else {
+        nda::for_each(sh, [&](auto const &...is) {
+          std::array<long, rank_in> idx{long(is)...};
+          std::array<long, rank> out;
+          for (int u = 0; u < rank; ++u) out[u] = idx[kept_axes[u]];
+          auto &t = std::apply(target, out);
+          t       = Reducer::op(t, a(is...));
+        });
+      }
+    }
+  };
+
+  template <typename Reducer, typename A, int... Axes>
+  inline constexpr char get_algebra<expr_reduce<Reducer, A, Axes...>> = 'A';
+
+  // --------------- expr_scan  ------------------------
+
+  /**
+   * Lazy inclusive scan (prefix reduction) of an array A along the axis Axis, with the operation Reducer
+   *
+   * As expr_reduce, it models Array, and is evaluated in memory order when assigned to an array.
+   */
+  template <typename Reducer, typename A, int Axis>
+  struct expr_scan {
+    using A_t = std::decay_t<A>;
+
+    static constexpr int rank = get_rank<A_t>;
+    static_assert(Axis >= 0 and Axis < rank, "Axis out of range");
+
+    using value_type = std::decay_t<decltype(Reducer::op(get_value_t<A_t>{}, get_value_t<A_t>{}))>;
+
+    A a;
+
+    [[nodiscard]] auto shape() const { return a.shape(); }
+
+    [[nodiscard]] long size() const { return a.size(); }
+
+    template <typename... Args>
+    value_type operator()(Args const &...args) const {
+      static_assert(sizeof...(Args) == rank, "Incorrect number of arguments");
+      std::array<long, rank> idx{long(args)...};
+      long const n = idx[Axis];
+      idx[Axis]    = 0;
+      value_type r = std::apply(a, idx);
+      for (long i = 1; i <= n; ++i) {
+        idx[Axis] = i;
+        r         = Reducer::op(r, std::apply(a, idx));
+      }
+      return r;
+    }
+
+    /**
+     * Evaluates the scan into target : copy a, then accumulate along Axis in the memory order of target.
+     * Both are run in parallel (nda::exec), the accumulation over the slowest dimension other than Axis (sequential for rank 1).
+     * If target is not strided (e.g. tiled), the accumulation is an elementwise sequential loop in C order.
+     */
+    template <typename V>
+    void evaluate_into(V &target) const {
+      EXPECTS(target.shape() == shape());
+      exec::parallel_for(target.shape(), [&](auto const &...is) { target(is...) = a(is...); });
+
+      if constexpr (not details::StridedMemoryArray<V>) {
+        // in C order, the previous element along Axis is already accumulated
+        nda::for_each(target.shape(), [&](auto const &...is) {
+          std::array<long, rank> idx{long(is)...};
+          if (idx[Axis] == 0) return;
+          auto &t = target(is...);
+          idx[Axis] -= 1;
+          t = Reducer::op(std::apply(target, idx), t);
+        });
+      } else {
+        evaluate_strided(target);
+      }
+    }
+
+    private:
+    template <typename V>
+    void evaluate_strided(V &target) const {
+      using T          = get_value_t<V>;
+      auto len         = target.shape();
+      auto const &st_t = target.indexmap().strides();
+      if (len[Axis] < 2) return;
+      long const d = st_t[Axis];
+      len[Axis] -= 1;
+
+      auto p           = details::memory_order(st_t);
+      T *__restrict pt = target.data() + d; // first element with index 1 along Axis
+      auto scan_line   = [pt, d](long o, long, long n, long dt, long) {
+        for (long i = 0; i < n; ++i) pt[o + i * dt] = Reducer::op(pt[o + i * dt - d], pt[o + i * dt]);
+      };
+      auto len_p = details::apply_permutation(p, len);
+      auto st_p  = details::apply_permutation(p, st_t);
+      if constexpr (rank == 1) {
+        details::for_each_line(len_p, st_p, st_p, scan_line);
+      } else {
+        int k = (p[0] == Axis ? 1 : 0); // the slowest dimension other than Axis, in the loop order
+        details::parallel_for_each_line(k, len_p, st_p, st_p, scan_line);
+      }
+    }
+  };
+
+  template <typename Reducer, typename A, int Axis>
+  inline constexpr char get_algebra<expr_scan<Reducer, A, Axis>> = get_algebra<std::decay_t<A>>;
+
+  // --------------- axis reductions  ------------------------
+
+  /**
+   * Sum of the elements of a along the axes Axis, Axes...
+   *
+   * @tparam Axis, Axes The axes to sum over
+   * @param a An array
+   * @return A lazy expression of rank get_rank<A> - number of axes
+   *
+   * @example
+   *   array<double, 3> B = sum<2>(A);      // B(i,j,k) = sum_l A(i,j,k,l)
+   *   array<double, 2> C = sum<1, 3>(A);   // C(i,k) = sum_{j,l} A(i,j,k,l)
+   * \ingroup Algorithms
+   */
+  template <int Axis, int... Axes, Array A>
+  expr_reduce<reducers::sum, A, Axis, Axes...> sum(A &&a) {
+    return {std::forward<A>(a)};
+  }
+
+  /// Product of the elements of a along the axes Axis, Axes... See sum<Axis>
+  template <int Axis, int... Axes, Array A>
+  expr_reduce<reducers::product, A, Axis, Axes...> product(A &&a) {
+    return {std::forward<A>(a)};
+  }
+
+  /// Maximum of the elements of a along the axes Axis, Axes... See sum<Axis>
+  template <int Axis, int... Axes, Array A>
+  expr_reduce<reducers::max, A, Axis, Axes...> max(A &&a) {
+    return {std::forward<A>(a)};
+  }
+
+  /// Minimum of the elements of a along the axes Axis, Axes... See sum<Axis>
+  template <int Axis, int... Axes, Array A>
+  expr_reduce<reducers::min, A, Axis, Axes...> min(A &&a) {
+    return {std::forward<A>(a)};
+  }
+
+  // --------------- scans  ------------------------
+
+  /**
+   * Cumulative sum of the elements of a along the axis Axis
+   *
+   * @tparam Axis The axis of the scan
+   * @param a An array
+   * @return A lazy expression with the shape of a, r(..., i, ...) = sum_{j <= i} a(..., j, ...) (i at position Axis)
+   * \ingroup Algorithms
+   */
+  template <int Axis, Array A>
+  expr_scan<reducers::sum, A, Axis> cumsum(A &&a) {
+    return {std::forward<A>(a)};
+  }
+
+} // namespace nda
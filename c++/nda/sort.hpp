@@ -0,0 +1,303 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * Sorting and searching :
+ *
+ *   sort(a, axis)              : sorts a in place, along axis (by default the last one)
+ *   argsort(a, axis)           : the indices which sort a along axis, as an array<long, R> (stable)
+ *   partial_sort(a, k, axis)   : the k smallest elements first along axis, in order. The others are in an unspecified order.
+ *   searchsorted(s, x, side)   : the indices where to insert the elements of x in the sorted 1d array s
+ *   unique(a)                  : the sorted distinct elements of a, as an array<T, 1>
+ *
+ * Floating point NaN are sorted last.
+ *
+ * A 1d array (or a single lane) is sorted with a parallel merge sort : the chunks are sorted in parallel, then merged
+ * pairwise. Each merge is itself cut in parts of equal size (merge path), so that all the threads work in every round,
+ * including the last one. Along an axis of a rank R array, the lanes are sorted in parallel.
+ * The parallelism is nda::exec, as in the rest of nda. Non contiguous lanes are copied in a contiguous buffer first.
+ */
+
+namespace nda {
+
+  /// For searchsorted : insert before (left) or after (right) the equal elements
+  enum class search_side { left, right };
+
+  namespace sort_details {
+
+    // Below this size, a 1d sort is sequential
+    inline constexpr long parallel_threshold = 1 << 16;
+
+    // a < b, with the NaN last (a strict weak order, unlike < for floating point)
+    struct less_nan_last {
+      template <typename T>
+      bool operator()(T const &a, T const &b) const {
+        if constexpr (std::is_floating_point_v<T>)
+          return (a < b) or (std::isnan(b) and not std::isnan(a));
+        else
+          return a < b;
+      }
+    };
+
+    // The part t (of n_parts, of equal sizes) of the merge of [a, a + na[ and [b, b + nb[ into out.
+    // The parts are split along the merge path, by a binary search on the diagonals.
+    // As std::merge, it is stable : the elements of a come before the equal elements of b.
+    template <typename T, typename Comp>
+    void merge_part(T const *a, long na, T const *b, long nb, T *out, long t, long n_parts, Comp comp) {
+      // the number of elements of a in the first d elements of the merge
+      auto split = [&](long d) {
+        long lo = std::max(0l, d - nb), hi = std::min(d, na);
+        while (lo < hi) {
+          long mid = (lo + hi) / 2;
+          if (comp(b[d - mid - 1], a[mid]))
+            hi = mid;
+          else
+            lo = mid + 1;
+        }
+        return lo;
+      };
+      long d0 = (na + nb) * t / n_parts, d1 = (na + nb) * (t + 1) / n_parts;
+      long i0 = split(d0), i1 = split(d1);
+      std::merge(a + i0, a + i1, b + (d0 - i0), b + (d1 - i1), out + d0, comp);
+    }
+
+    // Sorts [p, p + n[ : chunks sorted in parallel, then merged pairwise (ping-pong with a buffer)
+    template <typename T, typename Comp>
+    void parallel_sort(T *p, long n, Comp comp) {
+      long nc = exec::n_threads();
+      if (nc < 2 or n < parallel_threshold or exec::in_parallel()) {
+        std::sort(p, p + n, comp);
+        return;
+      }
+      std::vector<long> b(nc + 1);
+      for (long c = 0; c <= nc; ++c) b[c] = n * c / nc;
+
+      exec::parallel_for(nc, [&](long c) { std::sort(p + b[c], p + b[c + 1], comp); }, 1);
+
+      std::vector<T> buf(n);
+      T *src = p, *dst = buf.data();
+      for (long w = 1; w < nc; w *= 2) {
+        // each of the n_pairs merges is cut in n_parts, for nc parts in total
+        long n_pairs = (nc + 2 * w - 1) / (2 * w);
+        long n_parts = std::max(1l, nc / n_pairs);
+        exec::parallel_for(
+           n_pairs * n_parts,
+           [&](long q) {
+             long c  = 2 * w * (q / n_parts);
+             long lo = b[c], mid = b[std::min(c + w, nc)], hi = b[std::min(c + 2 * w, nc)];
+             merge_part(src + lo, mid - lo, src + mid, hi - mid, dst + lo, q % n_parts, n_parts, comp);
+           },
+           1);
+        std::swap(src, dst);
+      }
+      if (src != p) std::copy(src, src + n, p);
+    }
+
+    template <int R>
+    void check_axis(int axis) {
+      if (axis < 0 or axis >= R) NDA_RUNTIME_ERROR << "sort : axis " << axis << " out of range for an array of rank " << R;
+    }
+
+    // Offset of the lane l along axis, i.e. of the element with the index 0 along axis, and the index l
+    // in C order over the other dimensions
+    template <size_t R>
+    long lane_offset(long l, std::array<long, R> const &shape, std::array<long, R> const &strides, int axis) {
+      long offset = 0;
+      for (int r = int(R) - 1; r >= 0; --r) {
+        if (r == axis) continue;
+        offset += (l % shape[r]) * strides[r];
+        l /= shape[r];
+      }
+      return offset;
+    }
+
+    // Calls f(lane_index, offset) for each lane of a along axis, in parallel if there is more than one lane
+    template <typename A, typename F>
+    void for_each_lane(A const &a, int axis, F f) {
+      long len     = a.shape()[axis];
+      long n_lanes = (len == 0 ? 0 : a.size() / len);
+      auto sh      = a.shape();
+      auto st      = a.indexmap().strides();
+      if (n_lanes == 1) {
+        f(0, 0);
+        return;
+      }
+      exec::parallel_for(n_lanes, [&](long l) { f(l, lane_offset(l, sh, st, axis)); }, 0, std::max(1l, len));
+    }
+
+    // Applies g(ptr, n) to the lane [p, p + stride * n[, through a contiguous buffer if stride != 1
+    template <typename T, typename G>
+    void on_contiguous_lane(T *p, long stride, long n, G g) {
+      if (stride == 1) {
+        g(p, n);
+        return;
+      }
+      std::vector<T> buf(n);
+      for (long i = 0; i < n; ++i) buf[i] = p[i * stride];
+      g(buf.data(), n);
+      for (long i = 0; i < n; ++i) p[i * stride] = buf[i];
+    }
+
+  } // namespace sort_details
+
+  // --------------- sort -----------------------
+
+  /**
+   * Sorts a in place along axis
+   *
+   * @param a A MemoryArray of rank R
+   * @param axis The axis along which to sort. Default : the last one
+   */
+  template <typename A>
+  void sort(A &&a, int axis = get_rank<A> - 1) requires(MemoryArray<std::decay_t<A>>) {
+    using namespace sort_details;
+    check_axis<get_rank<A>>(axis);
+    auto *p      = a.data();
+    long len     = a.shape()[axis];
+    long stride  = a.indexmap().strides()[axis];
+    bool one_run = (a.size() == len); // only one lane : sort it in parallel
+    for_each_lane(a, axis, [&](long, long offset) {
+      on_contiguous_lane(p + offset, stride, len, [one_run](auto *q, long n) {
+        if (one_run)
+          parallel_sort(q, n, less_nan_last{});
+        else
+          std::sort(q, q + n, less_nan_last{});
+      });
+    });
+  }
+
+  /**
+   * Partial sort of a in place along axis : the k smallest elements come first, in order.
+   * The order of the others is unspecified.
+   */
+  template <typename A>
+  void partial_sort(A &&a, long k, int axis = get_rank<A> - 1) requires(MemoryArray<std::decay_t<A>>) {
+    using namespace sort_details;
+    check_axis<get_rank<A>>(axis);
+    auto *p     = a.data();
+    long len    = a.shape()[axis];
+    long stride = a.indexmap().strides()[axis];
+    EXPECTS(0 <= k and k <= len);
+    for_each_lane(a, axis, [&](long, long offset) {
+      on_contiguous_lane(p + offset, stride, len, [k](auto *q, long n) { std::partial_sort(q, q + k, q + n, less_nan_last{}); });
+    });
+  }
+
+  // --------------- argsort -----------------------
+
+  /**
+   * The indices which sort a along axis (stable : equal elements keep their order)
+   *
+   * @return An array<long, R> r of the shape of a : along axis, a(..., r(..., i, ...), ...) is sorted
+   */
+  template <typename A>
+  array<long, get_rank<A>> argsort(A const &a, int axis = get_rank<A> - 1) requires(MemoryArray<A>) {
+    using namespace sort_details;
+    check_axis<get_rank<A>>(axis);
+    using T = std::remove_const_t<get_value_t<A>>;
+
+    array<long, get_rank<A>> r(a.shape());
+    auto const *p = a.data();
+    long len      = a.shape()[axis];
+    long stride   = a.indexmap().strides()[axis];
+    long r_stride = r.indexmap().strides()[axis];
+    bool one_run  = (a.size() == len);
+
+    // sort (value, index) pairs : contiguous in memory, and the index makes the order stable
+    auto comp = [](std::pair<T, long> const &x, std::pair<T, long> const &y) {
+      if (less_nan_last{}(x.first, y.first)) return true;
+      if (less_nan_last{}(y.first, x.first)) return false;
+      return x.second < y.second;
+    };
+    auto const sh = a.shape();
+    auto const rs = r.indexmap().strides();
+    for_each_lane(a, axis, [&](long l, long offset) {
+      std::vector<std::pair<T, long>> v(len);
+      for (long i = 0; i < len; ++i) v[i] = {p[offset + i * stride], i};
+      if (one_run)
+        parallel_sort(v.data(), len, comp);
+      else
+        std::sort(v.begin(), v.end(), comp);
+      long r_offset = lane_offset(l, sh, rs, axis);
+      for (long i = 0; i < len; ++i) r.data()[r_offset + i * r_stride] = v[i].second;
+    });
+    return r;
+  }
+
+  // --------------- searchsorted -----------------------
+
+  /**
+   * The index where to insert x in the sorted 1d array s to keep it sorted
+   *
+   * @param side left : the first suitable index (before the elements equal to x), right : the last one
+   */
+  template <ArrayOfRank<1> S, typename X>
+  long searchsorted(S const &s, X const &x, search_side side = search_side::left) requires(not Array<X>) {
+    using sort_details::less_nan_last;
+    long lo = 0, hi = s.shape()[0];
+    // binary search, with the same order as sort
+    while (lo < hi) {
+      long mid      = lo + (hi - lo) / 2;
+      bool go_right = (side == search_side::left ? less_nan_last{}(s(mid), x) : not less_nan_last{}(x, s(mid)));
+      if (go_right)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    return lo;
+  }
+
+  /// searchsorted for each element of x, in parallel
+  template <ArrayOfRank<1> S, Array X>
+  array<long, get_rank<X>> searchsorted(S const &s, X const &x, search_side side = search_side::left) {
+    array<long, get_rank<X>> r(x.shape());
+    if constexpr (get_rank<X> == 1) {
+      long n = x.shape()[0];
+      exec::parallel_for(n, [&](long i) { r(i) = searchsorted(s, x(i), side); });
+    } else {
+      nda::for_each(x.shape(), [&](auto const &...is) { r(is...) = searchsorted(s, x(is...), side); });
+    }
+    return r;
+  }
+
+  // --------------- unique -----------------------
+
+  /// The sorted distinct elements of a (of any rank), as an array of rank 1
+  template <Array A>
+  array<std::remove_const_t<get_value_t<A>>, 1> unique(A const &a) {
+    using T = std::remove_const_t<get_value_t<A>>;
+    array<T, 1> v(a.size());
+    long i = 0;
+    nda::for_each(a.shape(), [&](auto const &...is) { v[i++] = a(is...); });
+    sort(v);
+    // NaN are not equal to themselves, but are all kept as one element
+    auto eq = [](T const &x, T const &y) {
+      if constexpr (std::is_floating_point_v<T>)
+        return (x == y) or (std::isnan(x) and std::isnan(y));
+      else
+        return x == y;
+    };
+    auto *p = v.data();
+    long n  = std::unique(p, p + v.size(), eq) - p;
+    return array<T, 1>{v(range(0, n))};
+  }
+
+} // namespace nda
@@ -0,0 +1,381 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace nda {
+
+  // ----------------  COO -------------------------
+
+  /**
+   * A sparse matrix in coordinate (COO) format : a list of (row, col, value) triplets.
+   *
+   * It is the format for the assembly of a sparse matrix : the elements are inserted in any order,
+   * and the duplicates are summed in the conversion to CSR/CSC.
+   *
+   * @tparam T The value type
+   */
+  template <typename T>
+  class coo_matrix {
+    std::array<long, 2> _shape = {0, 0};
+    long _nnz                  = 0;
+    array<long, 1> _rows, _cols;
+    array<T, 1> _values;
+
+    // increase the capacity, keeping the first _nnz elements
+    template <typename A>
+    void grow(A &a, long capacity) {
+      A b(capacity);
+      b(range(0, _nnz)) = a(range(0, _nnz));
+      a                 = std::move(b);
+    }
+
+    public:
+    using value_type = T;
+
+    coo_matrix() = default;
+
+    /// An empty matrix of size n_rows x n_cols
+    coo_matrix(long n_rows, long n_cols) : _shape{n_rows, n_cols} {}
+
+    /// Construct from the triplets
+    coo_matrix(std::array<long, 2> const &shape, array<long, 1> rows, array<long, 1> cols, array<T, 1> values)
+       : _shape(shape), _nnz(values.size()), _rows(std::move(rows)), _cols(std::move(cols)), _values(std::move(values)) {
+      EXPECTS(_rows.size() == _nnz and _cols.size() == _nnz);
+    }
+
+    /// Reserve the memory for n elements
+    void reserve(long n) {
+      if (n <= _values.size()) return;
+      grow(_rows, n);
+      grow(_cols, n);
+      grow(_values, n);
+    }
+
+    /// Add the element (i, j, v). Duplicates are allowed, and summed in the conversion to CSR/CSC.
+    void insert(long i, long j, T const &v) {
+      EXPECTS_WITH_MESSAGE(i >= 0 and i < _shape[0] and j >= 0 and j < _shape[1],
+                           "coo_matrix::insert : element (" << i << ", " << j << ") out of bounds " << _shape);
+      if (_nnz == _values.size()) reserve(std::max(2 * _nnz, 16l));
+      _rows(_nnz)   = i;
+      _cols(_nnz)   = j;
+      _values(_nnz) = v;
+      ++_nnz;
+    }
+
+    [[nodiscard]] std::array<long, 2> const &shape() const noexcept { return _shape; }
+
+    /// Number of stored elements (including duplicates)
+    [[nodiscard]] long nnz() const noexcept { return _nnz; }
+
+    [[nodiscard]] auto rows() const { return _rows(range(0, _nnz)); }
+    [[nodiscard]] auto cols() const { return _cols(range(0, _nnz)); }
+    [[nodiscard]] auto values() const { return _values(range(0, _nnz)); }
+  };
+
+  // ----------------  CSR/CSC -------------------------
+
+  /**
+   * A sparse matrix in compressed format : CSR (Order = 'C', compressed rows) or CSC (Order = 'F', compressed columns).
+   *
+   * Along the "outer" dimension (the rows for CSR, the columns for CSC), the elements of the outer index o are
+   * at positions [ptr(o), ptr(o+1)[ in the arrays idx (their "inner" index, i.e. column for CSR, row for CSC) and values.
+   * The inner indices of each outer index are sorted and unique.
+   *
+   * @tparam T The value type
+   * @tparam Order 'C' for CSR, 'F' for CSC
+   */
+  template <typename T, char Order>
+  class compressed_matrix {
+    static_assert(Order == 'C' or Order == 'F', "compressed_matrix : Order must be 'C' (CSR) or 'F' (CSC)");
+
+    std::array<long, 2> _shape = {0, 0};
+    array<long, 1> _ptr        = array<long, 1>(1);
+    array<long, 1> _idx;
+    array<T, 1> _values;
+
+    static constexpr int outer = (Order == 'C' ? 0 : 1);
+
+    // fill _ptr, _idx, _values from (outer, inner, value) triplets, sorting the inner indices and summing the duplicates
+    template <typename O, typename I, typename V>
+    void assemble(O const &o, I const &in, V const &v) {
+      long n_outer = _shape[outer], n = v.size();
+      _ptr.resize(n_outer + 1);
+      _ptr() = 0;
+      for (long k = 0; k < n; ++k) ++_ptr(o(k) + 1);
+      for (long u = 0; u < n_outer; ++u) _ptr(u + 1) += _ptr(u);
+
+      // counting sort on the outer index
+      std::vector<std::pair<long, T>> buf(n);
+      auto pos = array<long, 1>(_ptr);
+      for (long k = 0; k < n; ++k) buf[pos(o(k))++] = {in(k), v(k)};
+
+      // sort each segment on the inner index, sum the duplicates, compact
+      _idx.resize(n);
+      _values.resize(n);
+      long w = 0;
+      for (long u = 0; u < n_outer; ++u) {
+        auto first = buf.begin() + _ptr(u), last = buf.begin() + _ptr(u + 1);
+        std::sort(first, last, [](auto const &x, auto const &y) { return x.first < y.first; });
+        _ptr(u) = w;
+        for (auto it = first; it != last; ++it) {
+          if (w > _ptr(u) and _idx(w - 1) == it->first)
+            _values(w - 1) += it->second;
+          else {
+            _idx(w)    = it->first;
+            _values(w) = it->second;
+            ++w;
+          }
+        }
+      }
+      _ptr(n_outer) = w;
+      if (w < n) {
+        _idx    = array<long, 1>(_idx(range(0, w)));
+        _values = array<T, 1>(_values(range(0, w)));
+      }
+    }
+
+    public:
+    using value_type = T;
+
+    static constexpr char order = Order;
+
+    compressed_matrix() = default;
+
+    /**
+     * Construct from the compressed arrays
+     *
+     * @param shape The shape (n_rows, n_cols)
+     * @param ptr The start of each outer index in idx and values (size n_outer + 1)
+     * @param idx The inner index of each element, sorted for each outer index
+     * @param values The values
+     */
+    compressed_matrix(std::array<long, 2> const &shape, array<long, 1> ptr, array<long, 1> idx, array<T, 1> values)
+       : _shape(shape), _ptr(std::move(ptr)), _idx(std::move(idx)), _values(std::move(values)) {
+      EXPECTS(_ptr.size() == _shape[outer] + 1);
+      EXPECTS(_idx.size() == _values.size());
+      EXPECTS(_ptr(_shape[outer]) == _values.size());
+    }
+
+    /// Construct from a COO matrix. The duplicates are summed.
+    explicit compressed_matrix(coo_matrix<T> const &a) : _shape(a.shape()) {
+      if constexpr (Order == 'C')
+        assemble(a.rows(), a.cols(), a.values());
+      else
+        assemble(a.cols(), a.rows(), a.values());
+    }
+
+    /// Construct from the other compressed format (CSR <-> CSC)
+    template <char Order2>
+    explicit compressed_matrix(compressed_matrix<T, Order2> const &a) requires(Order2 != Order) : _shape(a.shape()) {
+      // the elements of a, with their outer index
+      array<long, 1> a_outer(a.nnz());
+      for (long u = 0; u < a.ptr().size() - 1; ++u) a_outer(range(a.ptr()(u), a.ptr()(u + 1))) = u;
+      assemble(a.idx(), a_outer, a.values());
+    }
+
+    /// Construct from a dense matrix, keeping the elements != 0
+    template <ArrayOfRank<2> A>
+    explicit compressed_matrix(A const &a) : _shape(a.shape()) {
+      long n_outer = _shape[outer], n_inner = _shape[1 - outer];
+      auto el      = [&a](long o, long in) { return (Order == 'C' ? a(o, in) : a(in, o)); };
+      _ptr.resize(n_outer + 1);
+      _ptr(0) = 0;
+      for (long o = 0; o < n_outer; ++o) {
+        long c = 0;
+        for (long in = 0; in < n_inner; ++in) c += (el(o, in) != T{});
+        _ptr(o + 1) = _ptr(o) + c;
+      }
+      _idx.resize(_ptr(n_outer));
+      _values.resize(_ptr(n_outer));
+      for (long o = 0, w = 0; o < n_outer; ++o)
+        for (long in = 0; in < n_inner; ++in) {
+          T x = el(o, in);
+          if (x == T{}) continue;
+          _idx(w)      = in;
+          _values(w++) = x;
+        }
+    }
+
+    // ------------------ Accessors ------------------
+
+    [[nodiscard]] std::array<long, 2> const &shape() const noexcept { return _shape; }
+
+    [[nodiscard]] long extent(int i) const noexcept { return _shape[i]; }
+
+    /// Number of stored elements
+    [[nodiscard]] long nnz() const noexcept { return _values.size(); }
+
+    [[nodiscard]] array<long, 1> const &ptr() const noexcept { return _ptr; }
+    [[nodiscard]] array<long, 1> const &idx() const noexcept { return _idx; }
+    [[nodiscard]] array<T, 1> const &values() const noexcept { return _values; }
+
+    /// The values, modifiable (the sparsity pattern is fixed)
+    [[nodiscard]] auto values() noexcept { return _values(); }
+
+    bool operator==(compressed_matrix const &) const = default;
+  };
+
+  /// Compressed sparse row matrix
+  template <typename T>
+  using csr_matrix = compressed_matrix<T, 'C'>;
+
+  /// Compressed sparse column matrix
+  template <typename T>
+  using csc_matrix = compressed_matrix<T, 'F'>;
+
+  // ----------------  Conversion to dense -------------------------
+
+  /// The dense matrix
+  template <typename T, char Order>
+  matrix<T> to_dense(compressed_matrix<T, Order> const &a) {
+    matrix<T> r(a.shape());
+    r() = 0;
+    for (long o = 0; o < a.ptr().size() - 1; ++o)
+      for (long k = a.ptr()(o); k < a.ptr()(o + 1); ++k) {
+        if constexpr (Order == 'C')
+          r(o, a.idx()(k)) = a.values()(k);
+        else
+          r(a.idx()(k), o) = a.values()(k);
+      }
+    return r;
+  }
+
+  /// The dense matrix. The duplicates are summed.
+  template <typename T>
+  matrix<T> to_dense(coo_matrix<T> const &a) {
+    matrix<T> r(a.shape());
+    r() = 0;
+    for (long k = 0; k < a.nnz(); ++k) r(a.rows()(k), a.cols()(k)) += a.values()(k);
+    return r;
+  }
+
+  // ----------------  SpMV, SpMM -------------------------
+
+  /**
+   * Sparse matrix - dense vector product y <- alpha * a * x + beta * y
+   *
+   * For CSR, the rows are independent : the loop over the rows is parallel (nda::exec),
+   * and the inner loop is a gather on raw pointers.
+   * For CSC, the product is a scatter into y, done sequentially.
+   *
+   * @param y The result, a vector or a vector view. It is not resized.
+   */
+  template <typename T, char Order, ArrayOfRank<1> X, MemoryArrayOfRank<1> Y>
+  void spmv(T alpha, compressed_matrix<T, Order> const &a, X const &x, T beta, Y &&y) {
+    EXPECTS(a.extent(1) == x.shape()[0]);
+    EXPECTS(a.extent(0) == y.shape()[0]);
+    if constexpr (not MemoryArray<X>) {
+      spmv(alpha, a, make_regular(x), beta, y);
+    } else {
+      long const *__restrict ptr = a.ptr().data();
+      long const *__restrict idx = a.idx().data();
+      T const *__restrict val    = a.values().data();
+      auto const *__restrict px  = x.data();
+      auto *__restrict py        = y.data();
+      long sx = x.indexmap().strides()[0], sy = y.indexmap().strides()[0];
+      long n_outer = a.ptr().size() - 1;
+
+      if constexpr (Order == 'C') {
+        // the work of a row : its average number of non zeros
+        long work = 1 + (n_outer > 0 ? ptr[n_outer] / n_outer : 0);
+        exec::parallel_for(
+           n_outer,
+           [&](long i) {
+             T s = 0;
+             for (long k = ptr[i]; k < ptr[i + 1]; ++k) s += val[k] * px[idx[k] * sx];
+             py[i * sy] = (beta == T{0} ? alpha * s : alpha * s + beta * py[i * sy]);
+           },
+           0, work);
+      } else {
+        for (long i = 0; i < y.extent(0); ++i) py[i * sy] = (beta == T{0} ? T{0} : beta * py[i * sy]);
+        for (long j = 0; j < n_outer; ++j) {
+          T axj = alpha * px[j * sx];
+          for (long k = ptr[j]; k < ptr[j + 1]; ++k) py[idx[k] * sy] += val[k] * axj;
+        }
+      }
+    }
+  }
+
+  /**
+   * Sparse matrix - dense matrix product c <- alpha * a * b + beta * c
+   *
+   * Each element a(i, k) adds a row of b to a row of c. The inner loop runs along the rows of b and c,
+   * so it is contiguous for C layouts.
+   * For CSR, the loop over the rows of c is parallel (nda::exec).
+   *
+   * @param c The result, a matrix or a matrix view. It is not resized.
+   */
+  template <typename T, char Order, ArrayOfRank<2> B, MemoryArrayOfRank<2> C>
+  void spmm(T alpha, compressed_matrix<T, Order> const &a, B const &b, T beta, C &&c) {
+    EXPECTS(a.extent(1) == b.shape()[0]);
+    EXPECTS(a.extent(0) == c.shape()[0]);
+    EXPECTS(b.shape()[1] == c.shape()[1]);
+    if constexpr (not MemoryArray<B>) {
+      spmm(alpha, a, make_regular(b), beta, c);
+    } else {
+      long const *__restrict ptr = a.ptr().data();
+      long const *__restrict idx = a.idx().data();
+      T const *__restrict val    = a.values().data();
+      auto const *__restrict pb  = b.data();
+      auto *__restrict pc        = c.data();
+      auto [sb0, sb1]            = b.indexmap().strides();
+      auto [sc0, sc1]            = c.indexmap().strides();
+      long n = c.extent(1), n_outer = a.ptr().size() - 1;
+
+      // c(i, :) += x * b(k, :)
+      auto axpy_row = [&](long i, long k, T x) {
+        for (long j = 0; j < n; ++j) pc[i * sc0 + j * sc1] += x * pb[k * sb0 + j * sb1];
+      };
+      auto scale_row = [&](long i) {
+        for (long j = 0; j < n; ++j) pc[i * sc0 + j * sc1] = (beta == T{0} ? T{0} : beta * pc[i * sc0 + j * sc1]);
+      };
+
+      if constexpr (Order == 'C') {
+        // the work of a row : its average number of non zeros, times the number of columns
+        long work = (1 + (n_outer > 0 ? ptr[n_outer] / n_outer : 0)) * std::max(1l, n);
+        exec::parallel_for(
+           n_outer,
+           [&](long i) {
+             scale_row(i);
+             for (long p = ptr[i]; p < ptr[i + 1]; ++p) axpy_row(i, idx[p], alpha * val[p]);
+           },
+           0, work);
+      } else {
+        for (long i = 0; i < c.extent(0); ++i) scale_row(i);
+        for (long k = 0; k < n_outer; ++k)
+          for (long p = ptr[k]; p < ptr[k + 1]; ++p) axpy_row(idx[p], k, alpha * val[p]);
+      }
+    }
+  }
+
+  /// Product of a sparse matrix with a dense vector or matrix
+  template <typename T, char Order, typename X>
+  auto operator*(compressed_matrix<T, Order> const &a, X const &x) requires(ArrayOfRank<X, 1> or ArrayOfRank<X, 2>) {
+    if constexpr (get_rank<X> == 1) {
+      vector<T> y(a.extent(0));
+      spmv(T{1}, a, x, T{0}, y);
+      return y;
+    } else {
+      matrix<T> y(a.extent(0), x.shape()[1]);
+      spmm(T{1}, a, x, T{0}, y);
+      return y;
+    }
+  }
+
+} // namespace nda
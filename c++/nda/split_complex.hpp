@@ -0,0 +1,245 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <cmath>
+#include <complex>
+
+namespace nda {
+
+  /**
+   * A complex array stored in split (planar) form : the real and imaginary parts are two contiguous arrays of T.
+   *
+   * Compared to array<std::complex<T>, Rank> (interleaved storage), the elementwise kernels below
+   * (+, -, *, conj, abs, abs2, exp) are plain loops over contiguous planes of T, which vectorize fully,
+   * and real(a), imag(a) are views, without copy.
+   *
+   * It is not an Array : it does not enter the lazy expressions. It is an ArrayInitializer,
+   * so the conversion to the interleaved form is explicit, e.g. for BLAS or HDF5 :
+   *
+   *    split_complex_array<double, 2> s = a;       // from any complex Array
+   *    array<dcomplex, 2> z             = s;       // back to the interleaved form
+   *
+   * @tparam T The real type (double, float)
+   * @tparam Rank The rank
+   */
+  template <typename T, int Rank>
+  class split_complex_array {
+    static_assert(std::is_floating_point_v<T>, "split_complex_array : T must be a real floating point type");
+
+    array<T, Rank> _re, _im;
+
+    public:
+    using value_type = std::complex<T>;
+    static constexpr int rank = Rank;
+
+    split_complex_array() = default;
+
+    /// Construct with a given shape. The elements are not initialized.
+    explicit split_complex_array(std::array<long, Rank> const &shape) : _re(shape), _im(shape) {}
+
+    /// Construct with a given shape
+    template <std::integral... Int>
+    explicit split_complex_array(Int... is) requires(sizeof...(Int) == Rank) : _re(is...), _im(is...) {}
+
+    /// Construct from the two planes
+    split_complex_array(array<T, Rank> re, array<T, Rank> im) : _re(std::move(re)), _im(std::move(im)) {
+      EXPECTS(_re.shape() == _im.shape());
+    }
+
+    /// Construct from any Array (typically of complex values) : split into the two planes
+    template <ArrayOfRank<Rank> A>
+    split_complex_array(A const &a) : _re(a.shape()), _im(a.shape()) {
+      assign_from(a);
+    }
+
+    ///
+    template <ArrayOfRank<Rank> A>
+    split_complex_array &operator=(A const &a) {
+      _re.resize(a.shape());
+      _im.resize(a.shape());
+      assign_from(a);
+      return *this;
+    }
+
+    // ------------------ Accessors ------------------
+
+    [[nodiscard]] std::array<long, Rank> const &shape() const noexcept { return _re.shape(); }
+
+    [[nodiscard]] long size() const noexcept { return _re.size(); }
+
+    /// The real part (a view, no copy)
+    [[nodiscard]] auto real() { return _re(); }
+    [[nodiscard]] auto real() const { return _re(); }
+
+    /// The imaginary part (a view, no copy)
+    [[nodiscard]] auto imag() { return _im(); }
+    [[nodiscard]] auto imag() const { return _im(); }
+
+    /// Element (i, j, ...) as a complex number
+    template <typename... Int>
+    [[nodiscard]] value_type get(Int... is) const {
+      return {_re(is...), _im(is...)};
+    }
+
+    // ------------------ ArrayInitializer ------------------
+
+    /// Write the interleaved form into the view target (conversion to array<std::complex<T>, Rank>)
+    template <typename V>
+    void invoke(V &&target) const {
+      EXPECTS(target.shape() == shape());
+      T const *__restrict pr = _re.data();
+      T const *__restrict pi = _im.data();
+      if constexpr (MemoryArray<std::decay_t<V>>) {
+        if (target.indexmap().is_contiguous() and std::decay_t<V>::is_stride_order_C()) {
+          auto *__restrict pz = target.data();
+          for (long i = 0; i < size(); ++i) pz[i] = {pr[i], pi[i]};
+          return;
+        }
+      }
+      long i = 0;
+      nda::for_each(shape(), [&](auto const &...is) {
+        target(is...) = value_type{pr[i], pi[i]};
+        ++i;
+      });
+    }
+
+    private:
+    template <typename A>
+    void assign_from(A const &a) {
+      T *__restrict pr = _re.data();
+      T *__restrict pi = _im.data();
+      long i           = 0;
+      nda::for_each(a.shape(), [&](auto const &...is) {
+        std::complex<T> z = a(is...);
+        pr[i]             = z.real();
+        pi[i]             = z.imag();
+        ++i;
+      });
+    }
+  };
+
+  namespace details {
+    // Apply f(re_out, im_out, i) for i in [0, size[, on a new split_complex_array of the given shape
+    template <typename T, int R, typename F>
+    split_complex_array<T, R> split_complex_kernel(std::array<long, R> const &shape, F f) {
+      split_complex_array<T, R> r(shape);
+      T *__restrict pr = r.real().data();
+      T *__restrict pi = r.imag().data();
+      long const L     = r.size();
+      for (long i = 0; i < L; ++i) f(pr[i], pi[i], i);
+      return r;
+    }
+  } // namespace details
+
+  // ------------------ Views on the planes ------------------
+
+  /// The real part of a, as a view
+  template <typename T, int R>
+  auto real(split_complex_array<T, R> const &a) {
+    return a.real();
+  }
+
+  /// The imaginary part of a, as a view
+  template <typename T, int R>
+  auto imag(split_complex_array<T, R> const &a) {
+    return a.imag();
+  }
+
+  // ------------------ Elementwise kernels ------------------
+
+  template <typename T, int R>
+  split_complex_array<T, R> operator+(split_complex_array<T, R> const &a, split_complex_array<T, R> const &b) {
+    EXPECTS(a.shape() == b.shape());
+    T const *ar = a.real().data(), *ai = a.imag().data(), *br = b.real().data(), *bi = b.imag().data();
+    return details::split_complex_kernel<T, R>(a.shape(), [=](T &re, T &im, long i) {
+      re = ar[i] + br[i];
+      im = ai[i] + bi[i];
+    });
+  }
+
+  template <typename T, int R>
+  split_complex_array<T, R> operator-(split_complex_array<T, R> const &a, split_complex_array<T, R> const &b) {
+    EXPECTS(a.shape() == b.shape());
+    T const *ar = a.real().data(), *ai = a.imag().data(), *br = b.real().data(), *bi = b.imag().data();
+    return details::split_complex_kernel<T, R>(a.shape(), [=](T &re, T &im, long i) {
+      re = ar[i] - br[i];
+      im = ai[i] - bi[i];
+    });
+  }
+
+  /// Elementwise product
+  template <typename T, int R>
+  split_complex_array<T, R> operator*(split_complex_array<T, R> const &a, split_complex_array<T, R> const &b) {
+    EXPECTS(a.shape() == b.shape());
+    T const *ar = a.real().data(), *ai = a.imag().data(), *br = b.real().data(), *bi = b.imag().data();
+    return details::split_complex_kernel<T, R>(a.shape(), [=](T &re, T &im, long i) {
+      re = ar[i] * br[i] - ai[i] * bi[i];
+      im = ar[i] * bi[i] + ai[i] * br[i];
+    });
+  }
+
+  template <typename T, int R>
+  split_complex_array<T, R> operator*(std::complex<T> s, split_complex_array<T, R> const &a) {
+    T const *ar = a.real().data(), *ai = a.imag().data();
+    T const sr = s.real(), si = s.imag();
+    return details::split_complex_kernel<T, R>(a.shape(), [=](T &re, T &im, long i) {
+      re = sr * ar[i] - si * ai[i];
+      im = sr * ai[i] + si * ar[i];
+    });
+  }
+
+  template <typename T, int R>
+  split_complex_array<T, R> operator*(split_complex_array<T, R> const &a, std::complex<T> s) {
+    return s * a;
+  }
+
+  /// Complex conjugate
+  template <typename T, int R>
+  split_complex_array<T, R> conj(split_complex_array<T, R> const &a) {
+    return {array<T, R>{a.real()}, array<T, R>{-a.imag()}};
+  }
+
+  /// Squared modulus
+  template <typename T, int R>
+  array<T, R> abs2(split_complex_array<T, R> const &a) {
+    array<T, R> r(a.shape());
+    T const *ar = a.real().data(), *ai = a.imag().data();
+    T *__restrict pr = r.data();
+    for (long i = 0; i < r.size(); ++i) pr[i] = ar[i] * ar[i] + ai[i] * ai[i];
+    return r;
+  }
+
+  /// Modulus. NB : computed as sqrt(x^2 + y^2), without the overflow protection of std::abs (hypot)
+  template <typename T, int R>
+  array<T, R> abs(split_complex_array<T, R> const &a) {
+    array<T, R> r(a.shape());
+    T const *ar = a.real().data(), *ai = a.imag().data();
+    T *__restrict pr = r.data();
+    for (long i = 0; i < r.size(); ++i) pr[i] = std::sqrt(ar[i] * ar[i] + ai[i] * ai[i]);
+    return r;
+  }
+
+  /// Exponential
+  template <typename T, int R>
+  split_complex_array<T, R> exp(split_complex_array<T, R> const &a) {
+    T const *ar = a.real().data(), *ai = a.imag().data();
+    return details::split_complex_kernel<T, R>(a.shape(), [=](T &re, T &im, long i) {
+      T const e = std::exp(ar[i]);
+      re        = e * std::cos(ai[i]);
+      im        = e * std::sin(ai[i]);
+    });
+  }
+
+} // namespace nda
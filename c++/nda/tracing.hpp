@@ -0,0 +1,275 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+/*
+ * Region tracing of the calls of nda to BLAS, LAPACK, MPI and HDF5.
+ *
+ * Opt-in at compile time : with -DNDA_TRACE (CMake option TRACE), the entry points of nda
+ * (blas/interface/cxx_interface.cpp, lapack/interface/lapack_cxx_interface.cpp, the mpi lazy invoke,
+ * the h5_write/h5_read of arrays in h5.hpp) record a region for each call. Without it, the NDA_TRACE_* macros expand to nothing, and their arguments
+ * are not evaluated.
+ *
+ * A region records its name, category, begin and duration, the number of flops and of bytes it works on,
+ * the thread and the MPI rank. Each thread records in its own ring buffer of NDA_TRACE_BUFFER_SIZE events
+ * (default 65536) : when it is full, the oldest events are overwritten. Recording takes no lock and does no
+ * allocation, except for the first event of each thread, which locks the registry and allocates its buffer
+ * (registry_t::new_buffer).
+ *
+ *   nda::tracing::write_chrome_json("trace.json");   // to open in chrome://tracing or https://ui.perfetto.dev
+ *   nda::tracing::print_summary(std::cout);          // calls, time, GFlop/s, GB/s per region name
+ *
+ * If the environment variable NDA_TRACE_FILE is set, the Chrome trace is also written there at exit.
+ * The export functions must be called when no other thread records (e.g. outside of parallel regions).
+ */
+
+#ifdef NDA_TRACE
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace nda::tracing {
+
+  /// A recorded region
+  struct event_t {
+    char const *name     = nullptr; // a string literal
+    char const *category = nullptr; // "blas", "lapack", "mpi", "h5"
+    long begin_ns        = 0;       // since the start of the process
+    long duration_ns     = 0;
+    double flops         = 0;
+    double bytes         = 0;
+    int thread           = 0;
+    int rank             = 0;
+  };
+
+  /// Aggregate of the regions of one name
+  struct summary_row_t {
+    std::string name, category;
+    long count      = 0;
+    double total_s  = 0;
+    double max_s    = 0;
+    double flops    = 0;
+    double bytes    = 0;
+  };
+
+  namespace details {
+
+    using clock_t = std::chrono::steady_clock;
+
+    inline clock_t::time_point const t0 = clock_t::now();
+
+    inline long now_ns() { return std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t::now() - t0).count(); }
+
+    // The ring buffer of one thread. Only its thread writes. n_recorded only grows.
+    struct ring_buffer {
+      std::vector<event_t> events;
+      std::atomic<long> n_recorded = 0;
+      int thread                   = 0;
+
+      ring_buffer(long capacity, int th) : events(capacity), thread(th) {}
+
+      void push(event_t const &e) {
+        long n                          = n_recorded.load(std::memory_order_relaxed);
+        events[n % long(events.size())] = e;
+        n_recorded.store(n + 1, std::memory_order_release);
+      }
+
+      // The events still in the buffer, oldest first
+      template <typename F>
+      void for_each(F f) const {
+        long n = n_recorded.load(std::memory_order_acquire), cap = events.size();
+        for (long i = std::max(0l, n - cap); i < n; ++i) f(events[i % cap]);
+      }
+    };
+
+    struct registry_t;
+    inline void write_at_exit(registry_t &r);
+
+    // All the buffers. They are shared with the threads, so that the events of a finished thread are kept.
+    struct registry_t {
+      std::mutex mutex;
+      std::vector<std::shared_ptr<ring_buffer>> buffers;
+      long capacity             = 1 << 16;
+      std::atomic<bool> enabled = true;
+      std::atomic<int> rank     = 0;
+
+      registry_t() {
+        if (auto *s = std::getenv("NDA_TRACE_BUFFER_SIZE")) capacity = std::max(1l, std::atol(s));
+      }
+      ~registry_t() { write_at_exit(*this); }
+
+      std::shared_ptr<ring_buffer> new_buffer() {
+        std::lock_guard lock{mutex};
+        buffers.push_back(std::make_shared<ring_buffer>(capacity, int(buffers.size())));
+        return buffers.back();
+      }
+    };
+
+    inline registry_t &registry() {
+      static registry_t r;
+      return r;
+    }
+
+    inline ring_buffer &this_thread_buffer() {
+      thread_local std::shared_ptr<ring_buffer> b = registry().new_buffer();
+      return *b;
+    }
+
+  } // namespace details
+
+  /// Pause (false) or resume (true) the recording
+  inline void enable(bool b = true) { details::registry().enabled.store(b, std::memory_order_relaxed); }
+
+  /// Is the recording on ?
+  inline bool is_enabled() { return details::registry().enabled.load(std::memory_order_relaxed); }
+
+  /// Sets the MPI rank recorded in the events (done by the mpi functions of nda)
+  inline void set_rank(int r) { details::registry().rank.store(r, std::memory_order_relaxed); }
+
+  /**
+   * A region : records an event from its construction to its destruction
+   *
+   * @param name A string literal. nullptr : the region is not recorded (e.g. a LAPACK workspace query)
+   * @param category A string literal
+   */
+  class region {
+    char const *name, *category;
+    double flops, bytes;
+    long begin_ns = -1;
+
+    public:
+    region(char const *name_, char const *category_, double flops_ = 0, double bytes_ = 0)
+       : name(name_), category(category_), flops(flops_), bytes(bytes_) {
+      if (name != nullptr and is_enabled()) begin_ns = details::now_ns();
+    }
+
+    region(region const &)            = delete;
+    region &operator=(region const &) = delete;
+
+    ~region() {
+      if (begin_ns < 0) return;
+      long end_ns = details::now_ns();
+      auto &b     = details::this_thread_buffer();
+      b.push({name, category, begin_ns, end_ns - begin_ns, flops, bytes, b.thread, details::registry().rank.load(std::memory_order_relaxed)});
+    }
+  };
+
+  namespace details {
+
+    inline std::vector<event_t> collect(registry_t &r) {
+      std::lock_guard lock{r.mutex};
+      std::vector<event_t> res;
+      for (auto const &b : r.buffers) b->for_each([&res](event_t const &e) { res.push_back(e); });
+      std::sort(res.begin(), res.end(), [](auto const &x, auto const &y) { return x.begin_ns < y.begin_ns; });
+      return res;
+    }
+
+    inline void write_chrome_json(std::ostream &out, std::vector<event_t> const &evs) {
+      out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [" << std::setprecision(15);
+      for (bool first = true; auto const &e : evs) {
+        out << (first ? "\n" : ",\n") << R"({"name": ")" << e.name << R"(", "cat": ")" << e.category << R"(", "ph": "X", "ts": )" << e.begin_ns * 1e-3
+            << ", \"dur\": " << e.duration_ns * 1e-3 << ", \"pid\": " << e.rank << ", \"tid\": " << e.thread << ", \"args\": {\"flops\": " << e.flops
+            << ", \"bytes\": " << e.bytes << "}}";
+        first = false;
+      }
+      out << "\n]}\n";
+    }
+
+    inline void write_at_exit(registry_t &r) {
+      if (auto *s = std::getenv("NDA_TRACE_FILE")) {
+        std::ofstream out(s);
+        write_chrome_json(out, collect(r));
+      }
+    }
+
+  } // namespace details
+
+  /// All the recorded events (still in the buffers), sorted by begin time
+  inline std::vector<event_t> events() { return details::collect(details::registry()); }
+
+  /// Drops all the recorded events
+  inline void clear() {
+    auto &r = details::registry();
+    std::lock_guard lock{r.mutex};
+    for (auto &b : r.buffers) b->n_recorded.store(0, std::memory_order_relaxed);
+  }
+
+  /// The aggregates per region name, the most expensive first
+  inline std::vector<summary_row_t> summary() {
+    std::map<std::string, summary_row_t> m;
+    for (auto const &e : events()) {
+      auto &row    = m[e.name];
+      row.name     = e.name;
+      row.category = e.category;
+      double t     = e.duration_ns * 1e-9;
+      row.count += 1;
+      row.total_s += t;
+      row.max_s = std::max(row.max_s, t);
+      row.flops += e.flops;
+      row.bytes += e.bytes;
+    }
+    std::vector<summary_row_t> res;
+    for (auto &[k, row] : m) res.push_back(row);
+    std::sort(res.begin(), res.end(), [](auto const &x, auto const &y) { return x.total_s > y.total_s; });
+    return res;
+  }
+
+  /// Prints the summary as a table
+  inline void print_summary(std::ostream &out) {
+    out << std::left << std::setw(24) << "region" << std::setw(8) << "cat" << std::right << std::setw(10) << "calls" << std::setw(14) << "total [s]"
+        << std::setw(14) << "max [s]" << std::setw(12) << "GFlop/s" << std::setw(12) << "GB/s" << '\n';
+    for (auto const &row : summary()) {
+      double t = std::max(row.total_s, 1e-12);
+      out << std::left << std::setw(24) << row.name << std::setw(8) << row.category << std::right << std::setw(10) << row.count << std::setw(14)
+          << row.total_s << std::setw(14) << row.max_s << std::setw(12) << row.flops / t * 1e-9 << std::setw(12) << row.bytes / t * 1e-9 << '\n';
+    }
+  }
+
+  /// Writes the events in the Chrome trace event format (JSON)
+  inline void write_chrome_json(std::ostream &out) { details::write_chrome_json(out, events()); }
+
+  /// Writes the events in the Chrome trace event format (JSON) in the file filename
+  inline void write_chrome_json(std::string const &filename) {
+    std::ofstream out(filename);
+    write_chrome_json(out);
+  }
+
+} // namespace nda::tracing
+
+#define NDA_TRACE_CONCAT_IMPL(X, Y) X##Y
+#define NDA_TRACE_CONCAT(X, Y) NDA_TRACE_CONCAT_IMPL(X, Y)
+
+/// NDA_TRACE_REGION(name, category [, flops, bytes]) : records the rest of the enclosing scope
+#define NDA_TRACE_REGION(...) nda::tracing::region NDA_TRACE_CONCAT(nda_trace_region_, __LINE__)(__VA_ARGS__)
+
+/// NDA_TRACE_SET_RANK(r) : the MPI rank recorded in the events
+#define NDA_TRACE_SET_RANK(R) nda::tracing::set_rank(R)
+
+#else
+
+#define NDA_TRACE_REGION(...)
+#define NDA_TRACE_SET_RANK(R)
+
+#endif
@@ -0,0 +1,62 @@
+# Copyright (c) 2026 Simons Foundation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0.txt
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# This cmake find module looks for the double precision FFTW3 library
+# and, optionally, for its threaded version.
+#
+# Use this module by invoking find_package with the form::
+#
+#   find_package(FFTW [REQUIRED])
+#
+# The search can be guided by the FFTW_ROOT (cmake or environment) variable.
+#
+# Results are reported in::
+#
+#    FFTW_FOUND                 FFTW was found
+#    FFTW_INCLUDE_DIR           Directory containing fftw3.h
+#    FFTW_LIBRARIES             The libraries to link against (including fftw3_threads, if found)
+#    FFTW_THREADS_FOUND         The threaded library fftw3_threads was found
+
+find_path(FFTW_INCLUDE_DIR
+  NAMES fftw3.h
+  HINTS ${FFTW_ROOT} ENV FFTW_ROOT ENV FFTW_HOME ENV FFTW_DIR
+  PATH_SUFFIXES include
+)
+
+find_library(FFTW_LIBRARY
+  NAMES fftw3
+  HINTS ${FFTW_ROOT} ENV FFTW_ROOT ENV FFTW_HOME ENV FFTW_DIR
+  PATH_SUFFIXES lib lib64
+)
+
+find_library(FFTW_THREADS_LIBRARY
+  NAMES fftw3_threads
+  HINTS ${FFTW_ROOT} ENV FFTW_ROOT ENV FFTW_HOME ENV FFTW_DIR
+  PATH_SUFFIXES lib lib64
+)
+
+mark_as_advanced(FFTW_INCLUDE_DIR FFTW_LIBRARY FFTW_THREADS_LIBRARY)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(FFTW DEFAULT_MSG FFTW_LIBRARY FFTW_INCLUDE_DIR)
+
+if(FFTW_FOUND)
+  if(FFTW_THREADS_LIBRARY)
+    set(FFTW_THREADS_FOUND TRUE)
+    set(FFTW_LIBRARIES ${FFTW_THREADS_LIBRARY} ${FFTW_LIBRARY})
+  else()
+    set(FFTW_THREADS_FOUND FALSE)
+    set(FFTW_LIBRARIES ${FFTW_LIBRARY})
+  endif()
+endif()
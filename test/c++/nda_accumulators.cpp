@@ -0,0 +1,169 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+
+#include <random>
+
+// n samples of shape (2, 3) : an AR(1) process x_t = a x_{t-1} + noise, with an offset per element
+static std::vector<nda::array<double, 2>> ar1_samples(long n, double a, unsigned seed = 1) {
+  std::mt19937 gen(seed);
+  std::normal_distribution<double> d;
+  std::vector<nda::array<double, 2>> r;
+  nda::array<double, 2> x(2, 3);
+  x() = 0;
+  for (long t = 0; t < n; ++t) {
+    for (auto &v : x) v = a * v + d(gen);
+    r.push_back(x);
+    for (int i = 0; i < 2; ++i)
+      for (int j = 0; j < 3; ++j) r.back()(i, j) += i + 10 * j;
+  }
+  return r;
+}
+
+// ==============================================================
+
+TEST(Accumulators, Mean) { //NOLINT
+  auto s = ar1_samples(1000, 0);
+  nda::mean_accumulator<double, 2> acc({2, 3});
+  for (auto const &x : s) acc << x;
+
+  nda::array<double, 2> mean = nda::zeros<double>(2, 3), var = nda::zeros<double>(2, 3);
+  for (auto const &x : s) mean += x / 1000.0;
+  for (auto const &x : s) var += nda::abs2(x - mean) / 999.0;
+
+  EXPECT_EQ(acc.count(), 1000);
+  EXPECT_ARRAY_NEAR(acc.mean(), mean, 1e-12);
+  EXPECT_ARRAY_NEAR(acc.variance(), var, 1e-12);
+  EXPECT_ARRAY_NEAR(acc.error(), nda::sqrt(var / 1000.0), 1e-12);
+
+  // merging the accumulators of two halves
+  nda::mean_accumulator<double, 2> a1({2, 3}), a2({2, 3});
+  for (long t = 0; t < 300; ++t) a1 << s[t];
+  for (long t = 300; t < 1000; ++t) a2 << s[t];
+  a1.merge(a2);
+  EXPECT_EQ(a1.count(), 1000);
+  EXPECT_ARRAY_NEAR(a1.mean(), mean, 1e-12);
+  EXPECT_ARRAY_NEAR(a1.variance(), var, 1e-12);
+}
+
+// ----------------------------------------------------------------
+
+TEST(Accumulators, MeanComplexAndExpressions) { //NOLINT
+  nda::mean_accumulator<dcomplex, 1> acc({2});
+  nda::array<dcomplex, 1> x{1 + 1i, 2};
+  acc << x;
+  acc << 3 * x;                  // a lazy expression
+  acc << x(range(0, 2));         // a view
+  EXPECT_ARRAY_NEAR(acc.mean(), (5.0 / 3) * x, 1e-14);
+  // |x - mean|^2 summed : (4/9 + 16/9 + 4/9) |x|^2
+  EXPECT_ARRAY_NEAR(acc.m2(), (24.0 / 9) * nda::abs2(x), 1e-13);
+}
+
+// ----------------------------------------------------------------
+
+TEST(Accumulators, LogBinning) { //NOLINT
+  long n  = 1l << 18;
+  double a = 0.8;
+  auto s   = ar1_samples(n, a);
+  nda::log_binning_accumulator<double, 2> acc({2, 3}, 20);
+  nda::mean_accumulator<double, 2> m({2, 3});
+  for (auto const &x : s) {
+    acc << x;
+    m << x;
+  }
+
+  for (long l = 0; l < 20; ++l) EXPECT_EQ(acc.count(l), n >> l);
+  EXPECT_ARRAY_NEAR(acc.mean(), m.mean(), 1e-10);
+  EXPECT_ARRAY_NEAR(acc.error(0), m.error(), 1e-12);
+  EXPECT_EQ(acc.level(64), 12);
+
+  // the mean of the level l is the mean of the samples
+  EXPECT_ARRAY_NEAR(acc.means()(5, nda::ellipsis{}), m.mean(), 1e-10);
+
+  // tau_int = (1 + a) / (1 - a) / 2 = 4.5 for an AR(1) process
+  auto tau = acc.autocorrelation_time_at_level();
+  for (auto t : tau) EXPECT_NEAR(t, 4.5, 1.0);
+  EXPECT_ARRAY_NEAR(acc.error_at_level(), acc.error(12), 1e-14);
+
+  // merging the accumulators of two halves
+  nda::log_binning_accumulator<double, 2> a1({2, 3}, 20), a2({2, 3}, 20);
+  for (long t = 0; t < n / 2; ++t) a1 << s[t];
+  for (long t = n / 2; t < n; ++t) a2 << s[t];
+  a1.merge(a2);
+  for (long l = 0; l < 18; ++l) EXPECT_EQ(a1.count(l), n >> l);
+  for (long l = 0; l < 18; ++l) EXPECT_ARRAY_NEAR(a1.error(l), acc.error(l), 1e-10);
+}
+
+// ----------------------------------------------------------------
+
+TEST(Accumulators, JackknifeBins) { //NOLINT
+  auto s = ar1_samples(1000, 0.5);
+  nda::jackknife_accumulator<double, 2> acc({2, 3}, 16);
+  nda::mean_accumulator<double, 2> m({2, 3});
+  for (auto const &x : s) acc << x;
+
+  // 1000 samples : 15 complete bins of 64 samples, and 40 samples in the incomplete bin
+  EXPECT_EQ(acc.bin_size(), 64);
+  EXPECT_EQ(acc.n_full_bins(), 15);
+  EXPECT_EQ(acc.n_partial(), 40);
+  EXPECT_EQ(acc.count(), 1000);
+
+  for (long t = 0; t < 15 * 64; ++t) m << s[t];
+  EXPECT_ARRAY_NEAR(acc.mean(), m.mean(), 1e-12);
+  for (long b = 0; b < 15; ++b) {
+    nda::array<double, 2> sum = nda::zeros<double>(2, 3);
+    for (long t = b * 64; t < (b + 1) * 64; ++t) sum += s[t];
+    EXPECT_ARRAY_NEAR(acc.bins()(b, nda::ellipsis{}), sum, 1e-10);
+  }
+
+  // merge : bins of the same size, which do not fit
+  nda::jackknife_accumulator<double, 2> a1({2, 3}, 16), a2({2, 3}, 16);
+  for (long t = 0; t < 512; ++t) a1 << s[t];
+  for (long t = 512; t < 1000; ++t) a2 << s[t];
+  EXPECT_EQ(a1.bin_size(), 64);
+  EXPECT_EQ(a2.bin_size(), 32);
+  a1.merge(a2);
+  // 8 + 7 bins of 64 samples : the 40 samples of the incomplete bin of a2 (rebinned to 64) are dropped
+  EXPECT_EQ(a1.bin_size(), 64);
+  EXPECT_EQ(a1.n_full_bins(), 15);
+  EXPECT_EQ(a1.count(), 15 * 64);
+  EXPECT_ARRAY_NEAR(a1.mean(), m.mean(), 1e-12);
+}
+
+// ----------------------------------------------------------------
+
+TEST(Accumulators, Jackknife) { //NOLINT
+  auto s = ar1_samples(1 << 14, 0);
+  nda::jackknife_accumulator<double, 2> acc({2, 3}, 32);
+  nda::jackknife_accumulator<double, 1> z({1}, 32);
+  for (auto const &x : s) {
+    acc << x;
+    z << x(1, range(2, 3));
+  }
+
+  // for the identity, the jackknife is the mean and the standard error of the bins
+  auto [value, error] = nda::jackknife([](auto const &x) { return x; }, acc);
+  long n              = acc.n_full_bins();
+  nda::mean_accumulator<double, 2> m({2, 3});
+  for (long b = 0; b < n; ++b) m << acc.bins()(b, nda::ellipsis{}) / double(acc.bin_size());
+  EXPECT_ARRAY_NEAR(value, m.mean(), 1e-10);
+  EXPECT_ARRAY_NEAR(error, m.error(), 1e-10);
+
+  // a scalar function of two accumulators
+  auto [r, r_error] = nda::jackknife([](auto const &x, auto const &y) { return x(0, 0) / y(0); }, acc, z);
+  EXPECT_NEAR(r, 0, 0.01);
+  EXPECT_GT(r_error, 0);
+  EXPECT_LT(r_error, 0.01);
+}
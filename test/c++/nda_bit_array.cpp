@@ -0,0 +1,135 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+
+// ==============================================================
+
+TEST(BitArray, Pack) { //NOLINT
+  // 7 x 19 = 133 elements : 3 words, the last one partial
+  nda::array<double, 2> a(7, 19);
+  for (int i = 0; i < 7; ++i)
+    for (int j = 0; j < 19; ++j) a(i, j) = std::sin(1.3 * i + 0.7 * j);
+
+  auto m = nda::bit_array(a, [](double x) { return x > 0; });
+  static_assert(nda::Array<decltype(m)>);
+  EXPECT_EQ(m.words().size(), 3);
+
+  nda::array<bool, 2> b(7, 19);
+  long n = 0;
+  for (int i = 0; i < 7; ++i)
+    for (int j = 0; j < 19; ++j) {
+      b(i, j) = a(i, j) > 0;
+      n += b(i, j);
+      EXPECT_EQ(m(i, j), b(i, j));
+    }
+
+  // from an array of bool, and from a non contiguous array
+  EXPECT_EQ(nda::bit_array<2>{b}, m);
+  nda::array<double, 2, F_layout> af = a;
+  EXPECT_EQ(nda::bit_array(af, [](double x) { return x > 0; }), m);
+
+  // back to an array of bool
+  EXPECT_EQ_ARRAY((nda::array<bool, 2>{m}), b);
+
+  EXPECT_EQ(count(m), n);
+  EXPECT_EQ(m.count(), n);
+  EXPECT_TRUE(any(m));
+  EXPECT_FALSE(all(m));
+}
+
+// ==============================================================
+
+TEST(BitArray, SetAnyAll) { //NOLINT
+  nda::bit_array<1> m(130);
+  EXPECT_FALSE(any(m));
+  EXPECT_EQ(count(m), 0);
+
+  m.set(129);
+  m.set(64);
+  EXPECT_TRUE(any(m));
+  EXPECT_EQ(count(m), 2);
+  EXPECT_TRUE(m(129) and m(64) and not m(63));
+
+  m.flip(64);
+  m.reset(129);
+  EXPECT_FALSE(any(m));
+
+  m.fill(true);
+  EXPECT_TRUE(all(m));
+  EXPECT_EQ(count(m), 130);
+
+  // ~ keeps the padding bits of the last word at 0
+  auto z = ~m;
+  EXPECT_FALSE(any(z));
+  EXPECT_EQ(count(~z), 130);
+
+  nda::bit_array<1> e(0);
+  EXPECT_TRUE(all(e));
+  EXPECT_FALSE(any(e));
+}
+
+// ==============================================================
+
+TEST(BitArray, Logical) { //NOLINT
+  nda::array<long, 1> a(200);
+  for (long i = 0; i < 200; ++i) a(i) = i;
+
+  auto even = nda::bit_array(a, [](long x) { return x % 2 == 0; });
+  auto div3 = nda::bit_array(a, [](long x) { return x % 3 == 0; });
+
+  EXPECT_EQ(count(even & div3), 34); // multiples of 6
+  EXPECT_EQ(count(even | div3), 100 + 67 - 34);
+  EXPECT_EQ(count(even ^ div3), 100 + 67 - 68);
+  EXPECT_EQ(count(~even), 100);
+
+  for (long i = 0; i < 200; ++i) {
+    EXPECT_EQ((even & div3)(i), (i % 6 == 0));
+    EXPECT_EQ((even ^ div3)(i), ((i % 2 == 0) != (i % 3 == 0)));
+  }
+}
+
+// ==============================================================
+
+TEST(BitArray, Masked) { //NOLINT
+  nda::array<long, 2> a(10, 13);
+  for (long i = 0; i < 10; ++i)
+    for (long j = 0; j < 13; ++j) a(i, j) = 13 * i + j;
+
+  auto m = nda::bit_array(a, [](long x) { return x % 5 == 1; });
+
+  auto s = masked_select(a, m);
+  EXPECT_EQ(s.size(), count(m));
+  for (long k = 0; k < s.size(); ++k) EXPECT_EQ(s(k), 5 * k + 1);
+
+  // on a non contiguous view
+  auto v  = a(_, range(0, 13, 2));
+  auto mv = nda::bit_array(v, [](long x) { return x > 60; });
+  auto sv = masked_select(v, mv);
+  EXPECT_EQ(sv.size(), count(mv));
+  for (auto x : sv) EXPECT_GT(x, 60);
+
+  auto b = a;
+  masked_assign(b, m, -1);
+  masked_assign(b(_, range(0, 13, 2)), mv, nda::zeros<long>(10, 7));
+  for (long i = 0; i < 10; ++i)
+    for (long j = 0; j < 13; ++j) {
+      long expected = a(i, j);
+      if (a(i, j) % 5 == 1) expected = -1;
+      if (j % 2 == 0 and a(i, j) > 60) expected = 0;
+      EXPECT_EQ(b(i, j), expected);
+    }
+}
+
+MAKE_MAIN;
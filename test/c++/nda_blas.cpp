@@ -76,6 +76,41 @@ TEST(BLAS, gemmCF) { //NOLINT
   EXPECT_ARRAY_NEAR(M3, nda::matrix<dcomplex>{{1, 1}, {3, 3}});
 }
 
+//----------------------------
+TEST(BLAS, zgemm_conj) { //NOLINT
+
+  // conj and dagger operands, in all layouts : given to zgemm with 'C', or copied
+  auto A = nda::matrix<dcomplex>(3, 4), B = nda::matrix<dcomplex>(3, 2);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) A(i, j) = (i + 2 * j) + 1i * (i - j);
+    for (int j = 0; j < 2; ++j) B(i, j) = (2 * i - j) + 1i * (i * j + 1);
+  }
+  nda::matrix<dcomplex, F_layout> AF{A}, BF{B};
+
+  auto check = [](auto const &a, auto const &b) {
+    auto exp = nda::matrix<dcomplex>(a.shape()[0], b.shape()[1]);
+    nda::blas::gemm_generic(1, make_regular(a), make_regular(b), 0, exp);
+    nda::matrix<dcomplex> C(exp.shape());
+    nda::matrix<dcomplex, F_layout> CF(exp.shape());
+    nda::blas::gemm(1, a, b, 0, C);
+    nda::blas::gemm(1, a, b, 0, CF);
+    EXPECT_ARRAY_NEAR(C, exp);
+    EXPECT_ARRAY_NEAR(CF, exp);
+  };
+
+  check(dagger(A), B);
+  check(dagger(AF), BF);
+  check(dagger(A), BF);
+  check(dagger(AF), conj(B));
+  check(conj(transpose(B)), conj(A));
+  check(conj(transpose(BF)), conj(AF));
+  check(transpose(BF), conj(A));
+
+  // through matmul
+  EXPECT_ARRAY_NEAR(dagger(A) * B, make_regular(dagger(A)) * B);
+  EXPECT_ARRAY_NEAR(dagger(B) * conj(AF), make_regular(dagger(B)) * make_regular(conj(AF)));
+}
+
 // ==============================================================
 
 TEST(BLAS, gemv) { //NOLINT
@@ -111,6 +146,34 @@ TEST(BLAS, gemv) { //NOLINT
   EXPECT_ARRAY_NEAR(MB, nda::vector<double>{-8, 9, 13, -8, -8});
 }
 
+//----------------------------
+TEST(BLAS, zgemv_conj) { //NOLINT
+
+  auto A = nda::matrix<dcomplex>(3, 4);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) A(i, j) = (i + 2 * j) + 1i * (i - j);
+  nda::matrix<dcomplex, F_layout> AF{A};
+  nda::vector<dcomplex> x{1, 1i, 2.0 - 1i}, y{1i, 2, -1, 3.0 + 1i};
+
+  // 'C' for a C ordered matrix, conjugation of the vectors for a Fortran ordered one
+  for (dcomplex beta : {dcomplex{0}, dcomplex{2.0 - 1i}}) {
+    nda::vector<dcomplex> exp4 = 2.0 * make_regular(dagger(A)) * x + beta * y;
+    nda::vector<dcomplex> exp3 = 2.0 * make_regular(conj(A)) * y + beta * x;
+
+    nda::vector<dcomplex> r4 = y, r4F = y, r3 = x, r3F = x;
+    nda::blas::gemv(2, dagger(A), x, beta, r4);
+    nda::blas::gemv(2, dagger(AF), x, beta, r4F);
+    nda::blas::gemv(2, conj(A), y, beta, r3);
+    nda::blas::gemv(2, conj(AF), y, beta, r3F);
+    EXPECT_ARRAY_NEAR(r4, exp4);
+    EXPECT_ARRAY_NEAR(r4F, exp4);
+    EXPECT_ARRAY_NEAR(r3, exp3);
+    EXPECT_ARRAY_NEAR(r3F, exp3);
+  }
+
+  EXPECT_ARRAY_NEAR(dagger(AF) * x, make_regular(dagger(AF)) * x);
+}
+
 //----------------------------
 TEST(BLAS, ger) { //NOLINT
 
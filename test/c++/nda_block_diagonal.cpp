@@ -0,0 +1,89 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+// a random hermitian block diagonal matrix
+template <typename T>
+nda::block_diagonal_matrix<T> random_block_diagonal(std::vector<long> dims) {
+  nda::block_diagonal_matrix<T> A{nda::block_structure{dims}};
+  for (long b = 0; b < A.n_blocks(); ++b) {
+    nda::matrix<T> M = nda::rand<double>(dims[b], dims[b]);
+    if constexpr (nda::is_complex_v<T>) M += 1i * nda::matrix<double>(nda::rand<double>(dims[b], dims[b]));
+    A.block(b) = M + dagger(M) + 2 * dims[b] * nda::eye<T>(dims[b]);
+  }
+  return A;
+}
+
+// ==============================================================
+
+TEST(BlockDiagonal, Structure) { //NOLINT
+  nda::block_structure bs{{2, 0, 3}};
+  EXPECT_EQ(bs.n_blocks(), 3);
+  EXPECT_EQ(bs.dim(), 5);
+  EXPECT_EQ(bs.offset(2), 2);
+  EXPECT_EQ(bs.arena_offset(2), 4);
+  EXPECT_EQ(bs.arena_size(), 13);
+
+  nda::block_diagonal_matrix<double> A{std::vector<nda::matrix<double>>{{{1, 2}, {3, 4}}, nda::matrix<double>(0, 0), {{5, 6, 7}, {8, 9, 10}, {11, 12, 13}}}};
+  EXPECT_EQ(A.structure(), bs);
+  EXPECT_EQ(A.arena().data() + 4, A.block(2).data());
+
+  auto D = nda::to_dense(A);
+  EXPECT_EQ(D(1, 0), 3);
+  EXPECT_EQ(D(4, 2), 11);
+  EXPECT_EQ(D(1, 2), 0);
+
+  EXPECT_ARRAY_NEAR(nda::to_dense(2.0 * A + A), 3 * D);
+}
+
+// -----------------------------------------------------
+
+TEST(BlockDiagonal, LinearAlgebra) { //NOLINT
+  std::vector<long> dims{3, 5, 1, 4};
+  auto A = random_block_diagonal<double>(dims), B = random_block_diagonal<double>(dims);
+  auto DA = nda::to_dense(A), DB = nda::to_dense(B);
+
+  EXPECT_ARRAY_NEAR(nda::to_dense(A * B), DA * DB, 1.e-12);
+  EXPECT_ARRAY_NEAR(nda::to_dense(nda::inverse(A)), inverse(DA), 1.e-12);
+  EXPECT_NEAR(nda::determinant(A), nda::determinant(DA), 1.e-8 * std::abs(nda::determinant(DA)));
+
+  nda::vector<double> x = nda::rand<double>(13);
+  EXPECT_ARRAY_NEAR(A * x, DA * x, 1.e-12);
+  EXPECT_ARRAY_NEAR(A * (2.0 * x), 2.0 * (DA * x), 1.e-12); // a lazy vector
+
+  auto [ev, vecs] = nda::linalg::eigenelements(A);
+  auto D          = nda::to_dense(vecs);
+  EXPECT_ARRAY_NEAR(DA * D, D * nda::diag(ev), 1.e-10);
+  EXPECT_ARRAY_NEAR(nda::linalg::eigenvalues(A), ev, 1.e-12);
+}
+
+// -----------------------------------------------------
+
+TEST(BlockDiagonal, Complex) { //NOLINT
+  std::vector<long> dims{2, 6, 3};
+  auto A  = random_block_diagonal<dcomplex>(dims);
+  auto DA = nda::to_dense(A);
+
+  EXPECT_ARRAY_NEAR(nda::to_dense(nda::matmul(A, A)), DA * DA, 1.e-12);
+  EXPECT_ARRAY_NEAR(nda::to_dense(nda::inverse(A)), inverse(DA), 1.e-12);
+  EXPECT_COMPLEX_NEAR(nda::determinant(A), nda::determinant(DA), 1.e-8 * std::abs(nda::determinant(DA)));
+
+  auto [ev, vecs] = nda::linalg::eigenelements(A);
+  auto D          = nda::to_dense(vecs);
+  EXPECT_ARRAY_NEAR(DA * D, D * nda::diag(ev), 1.e-10);
+}
+
+MAKE_MAIN;
@@ -24,9 +24,12 @@ TEST(Array, BoundCheck) { //NOLINT
 
   EXPECT_THROW(A(0, 3), std::runtime_error); //NOLINT
 
-  // FIXME : SHOULD WE REALLY THROW ?
-  //EXPECT_THROW(A(nda::range(0, 4), 2), std::runtime_error);
-  //EXPECT_THROW(A(nda::range(10, 14), 2), std::runtime_error);
+  // all the elements of a range must be in the array
+  EXPECT_THROW(A(nda::range(0, 4), 2), std::runtime_error);  //NOLINT
+  EXPECT_THROW(A(nda::range(10, 14), 2), std::runtime_error); //NOLINT
+  EXPECT_THROW(A(1, nda::range(0, 5, 2)), std::runtime_error); //NOLINT
+  EXPECT_NO_THROW(A(1, nda::range(0, 3, 2)));                 //NOLINT
+  EXPECT_NO_THROW(A(1, nda::range(5, 5)));                    //NOLINT
 
   EXPECT_THROW(A(nda::range(), 5), std::runtime_error); //NOLINT
   EXPECT_THROW(A(0, 3), std::runtime_error);            //NOLINT
@@ -0,0 +1,108 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define NDA_BOUNDCHECK_HOISTED
+#include <gtest/gtest.h> // NOLINT
+
+#include <nda/nda.hpp>
+#include <nda/gtest_tools.hpp>
+
+using nda::range;
+
+// In the hoisted mode, the slices, the shapes of assignments and expressions,
+// and the element accesses outside of the nda loops are checked.
+
+TEST(BoundCheckHoisted, ElementAccess) { //NOLINT
+  nda::array<long, 2> A(2, 3);
+  A = 0;
+  EXPECT_THROW(A(0, 3), std::runtime_error); //NOLINT
+  EXPECT_THROW(A(2, 0), std::runtime_error); //NOLINT
+  EXPECT_THROW(A(-1, 0), std::runtime_error); //NOLINT
+  EXPECT_NO_THROW(A(1, 2));                   //NOLINT
+}
+
+TEST(BoundCheckHoisted, Slices) { //NOLINT
+  nda::array<long, 2> A(2, 3);
+  EXPECT_THROW(A(range(0, 4), 2), std::runtime_error);    //NOLINT
+  EXPECT_THROW(A(range(1, 3), 0), std::runtime_error);    //NOLINT
+  EXPECT_THROW(A(0, range(0, 5, 2)), std::runtime_error); //NOLINT
+  EXPECT_THROW(A(range::all, 3), std::runtime_error);     //NOLINT
+  EXPECT_NO_THROW(A(range(0, 2), range(1, 3)));           //NOLINT
+  EXPECT_NO_THROW(A(0, range(0, 3, 2)));                  //NOLINT
+}
+
+TEST(BoundCheckHoisted, Shapes) { //NOLINT
+  nda::array<double, 2> A(2, 3), B(3, 2), C(2, 3);
+  A = 1;
+  B = 1;
+  EXPECT_THROW(C() = B, nda::runtime_error);                            //NOLINT
+  EXPECT_THROW(C() = A + B, nda::runtime_error);                        //NOLINT
+  EXPECT_THROW(C() = A - B, nda::runtime_error);                        //NOLINT
+  EXPECT_THROW(C(range::all, 0) = B(range::all, 0), nda::runtime_error); //NOLINT
+  EXPECT_NO_THROW(C(range::all, 0) = B(0, range::all));                 //NOLINT
+  EXPECT_NO_THROW(C() = A + 2 * A);                                     //NOLINT
+  EXPECT_ARRAY_NEAR(C, nda::array<double, 2>{{3, 3, 3}, {3, 3, 3}});
+}
+
+TEST(BoundCheckHoisted, Loops) { //NOLINT
+  // the user loops pass plain indices : their body may index any array, so the accesses are checked
+  nda::for_each(std::array<long, 2>{2, 3}, [](auto i, auto j) { static_assert(std::is_same_v<decltype(i), long> and std::is_same_v<decltype(j), long>); });
+
+  nda::array<long, 2> A(2, 3);
+  nda::for_each(A.shape(), [&A](auto i, auto j) { A(i, j) = i + 10 * j; });
+  EXPECT_EQ(A(1, 2), 21);
+
+  nda::array<long, 2> big(4, 5), small(2, 3);
+  big = 1;
+  EXPECT_THROW(nda::for_each(big.shape(), [&](auto i, auto j) { small(i, j) = big(i, j); }), std::runtime_error);      //NOLINT
+  EXPECT_THROW(nda::for_each_tiled<2>(big.shape(), [&](auto i, auto j) { small(i, j) = big(i, j); }), std::runtime_error); //NOLINT
+
+  // non contiguous assignment, through the internal (unchecked) loops
+  nda::array<long, 2> B(3, 4);
+  B                               = 0;
+  B(range(0, 3, 2), range(1, 4)) = A;
+  EXPECT_EQ(B(2, 3), 21);
+  EXPECT_EQ(B(1, 3), 0);
+
+  // tiled loops
+  nda::array<long, 2> D(5, 7);
+  nda::for_each_tiled<4>(D.shape(), [&D](auto i, auto j) { D(i, j) = i * j; });
+  EXPECT_EQ(D(4, 6), 24);
+  nda::array<long, 2, nda::tiled_layout<4>> T(5, 7);
+  T = D;
+  EXPECT_EQ(T(4, 6), 24);
+}
+
+// ----------------------------------------------------------------
+
+TEST(BoundCheckHoisted, Map) { //NOLINT
+  // the shapes of the mapped functions are checked, as the ones of the arithmetic expressions
+  nda::array<double, 2> A(2, 3), B(3, 2), C(2, 3);
+  A = 1;
+  B = 1;
+  auto f = nda::map([](double x, double y) { return x + y; });
+  EXPECT_THROW(C() = f(A, B), nda::runtime_error); //NOLINT
+  C() = f(A, A);
+  EXPECT_ARRAY_NEAR(C, nda::array<double, 2>{{2, 2, 2}, {2, 2, 2}});
+}
+
+// ----------------------------------------------------------------
+
+TEST(BoundCheckHoisted, BitArray) { //NOLINT
+  // the hoisted loops call the bit_array with hoisted indices
+  nda::array<double, 2> A{{1, -2, 3}, {-4, 5, -6}};
+  nda::bit_array<2> m(A, [](double x) { return x > 0; });
+  nda::array<bool, 2> b = m;
+  EXPECT_EQ_ARRAY(b, (nda::array<bool, 2>{{true, false, true}, {false, true, false}}));
+}
@@ -0,0 +1,72 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+
+// ==============================================================
+
+TEST(Broadcast, RowAndColumn) { //NOLINT
+  nda::array<long, 2> A(3, 4);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) A(i, j) = 10 * i + j;
+
+  // a vector added to each row
+  nda::array<long, 1> v{1, 2, 3, 4};
+  auto bv = nda::broadcast_to(v, A.shape());
+  EXPECT_EQ(bv.shape(), A.shape());
+  EXPECT_EQ(bv.indexmap().strides(), (std::array<long, 2>{0, 1}));
+  EXPECT_EQ(bv.data(), v.data());
+
+  nda::array<long, 2> B = A + bv;
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) EXPECT_EQ(B(i, j), A(i, j) + v(j));
+
+  // a column (extent 1 in the last dimension) added to each column
+  nda::array<long, 2> c{{100}, {200}, {300}};
+  nda::array<long, 2> C = A;
+  C += nda::broadcast_to(c, A.shape());
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) EXPECT_EQ(C(i, j), A(i, j) + c(i, 0));
+}
+
+// -----------------------------------------------------
+
+TEST(Broadcast, Rank3) { //NOLINT
+  auto A = nda::array<double, 3>(nda::rand<double>(2, 3, 4));
+
+  // a rank 2 array added to each slice
+  nda::array<double, 2, F_layout> M = nda::rand<double>(3, 4);
+  nda::array<double, 3> B           = A + nda::broadcast_to(M, A.shape());
+  for (int n = 0; n < 2; ++n) EXPECT_ARRAY_NEAR(B(n, _, _), A(n, _, _) + M, 1.e-15);
+
+  // a strided view
+  nda::array<double, 2> W = nda::rand<double>(3, 8);
+  auto Ws                 = W(_, range(0, 8, 2));
+  nda::array<double, 3> D = nda::broadcast_to(Ws, A.shape());
+  for (int n = 0; n < 2; ++n) EXPECT_ARRAY_NEAR(D(n, _, _), Ws, 1.e-15);
+}
+
+// -----------------------------------------------------
+
+TEST(Broadcast, NoCopy) { //NOLINT
+  nda::array<double, 1> v{1, 2, 3};
+  auto b = nda::broadcast_to(v, std::array<long, 3>{1000, 1000, 3});
+  EXPECT_EQ(b.size(), 3'000'000);
+  EXPECT_EQ(b.data(), v.data());
+  v(1) = 10;
+  EXPECT_EQ(b(999, 12, 1), 10);
+  static_assert(std::is_const_v<std::remove_reference_t<decltype(b(0, 0, 0))>>);
+}
+
+MAKE_MAIN;
@@ -0,0 +1,209 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+
+#include <optional>
+#include <thread>
+#include <utility>
+
+using cow_array_t = nda::array<long, 2, C_layout, nda::cow>;
+
+static cow_array_t make_cow(long n, long m) {
+  cow_array_t a(n, m);
+  for (long i = 0; i < n; ++i)
+    for (long j = 0; j < m; ++j) a(i, j) = 10 * i + j;
+  return a;
+}
+
+// ==============================================================
+
+TEST(Cow, CopyShares) { //NOLINT
+  auto a = make_cow(3, 4);
+  auto b = a;
+
+  EXPECT_EQ(a.storage().refcount(), 2);
+  EXPECT_EQ(std::as_const(a).data(), std::as_const(b).data());
+  EXPECT_EQ_ARRAY(a, b);
+
+  // the first write detaches b only
+  b(1, 2) = -1;
+  EXPECT_EQ(a.storage().refcount(), 1);
+  EXPECT_EQ(b.storage().refcount(), 1);
+  EXPECT_NE(std::as_const(a).data(), std::as_const(b).data());
+  EXPECT_EQ(a(1, 2), 12);
+  EXPECT_EQ(b(1, 2), -1);
+
+  // nothing to copy any more
+  auto const *p = std::as_const(b).data();
+  b(0, 0)       = -2;
+  EXPECT_EQ(std::as_const(b).data(), p);
+}
+
+// ==============================================================
+
+TEST(Cow, ConstAccessDoesNotCopy) { //NOLINT
+  auto a        = make_cow(3, 4);
+  auto const b  = a;
+  auto const *p = std::as_const(a).data();
+
+  long s = 0;
+  for (auto x : b) s += x;
+  for (long i = 0; i < 3; ++i)
+    for (long j = 0; j < 4; ++j) s -= b(i, j);
+  EXPECT_EQ(s, 0);
+
+  auto c = nda::array<long, 2>{b};
+  EXPECT_EQ_ARRAY(c, a);
+
+  EXPECT_EQ(a.storage().refcount(), 2);
+  EXPECT_EQ(b.data(), p);
+
+  // nor a const view : it co-owns the block
+  auto v = b(1, _);
+  static_assert(std::is_const_v<std::remove_reference_t<decltype(v(0))>>);
+  EXPECT_EQ(v(2), 12);
+  EXPECT_EQ(v.data(), p + 4);
+  EXPECT_EQ(a.storage().refcount(), 3);
+  EXPECT_TRUE(b.storage().is_shareable());
+}
+
+// ==============================================================
+
+TEST(Cow, Assignment) { //NOLINT
+  auto a = make_cow(3, 4);
+  auto r = nda::array<long, 2>{a};
+
+  auto b = a;
+  b      = 0;
+  EXPECT_EQ_ARRAY(a, r);
+  EXPECT_EQ(max_element(abs(b)), 0);
+
+  auto c = a;
+  c += a;
+  EXPECT_EQ_ARRAY(a, r);
+  EXPECT_EQ_ARRAY(c, (nda::array<long, 2>{2 * r}));
+
+  // copy assignment shares again
+  c = a;
+  EXPECT_EQ(a.storage().refcount(), 2);
+}
+
+// ==============================================================
+
+TEST(Cow, Views) { //NOLINT
+  auto a = make_cow(3, 4);
+  auto b = a;
+
+  // a mutable view makes the storage of a unique ...
+  auto v = a(_, 1);
+  v(0)   = -1;
+  EXPECT_EQ(a(0, 1), -1);
+  EXPECT_EQ(b(0, 1), 1);
+
+  // ... and unshareable : the view is not shared with the next copies
+  EXPECT_FALSE(a.storage().is_shareable());
+  auto c = a;
+  EXPECT_EQ(c.storage().refcount(), 1);
+  v(1) = -2;
+  EXPECT_EQ(a(1, 1), -2);
+  EXPECT_EQ(c(1, 1), 11);
+
+  // a copy is shareable again
+  EXPECT_TRUE(c.storage().is_shareable());
+  auto d = c;
+  EXPECT_EQ(c.storage().refcount(), 2);
+
+  nda::array_view<long, 2> w = d;
+  w(2, 3)                    = -3;
+  EXPECT_EQ(c(2, 3), 23);
+  EXPECT_EQ(d(2, 3), -3);
+}
+
+// ==============================================================
+
+TEST(Cow, ConstViewDoesNotDangle) { //NOLINT
+  auto a = make_cow(3, 4);
+  std::optional<cow_array_t> b = a;
+
+  // the const view co-owns the block : a write detaches a from it, the view keeps its values ...
+  auto v  = std::as_const(a)();
+  a(0, 0) = 5;
+  EXPECT_EQ(v(0, 0), 0);
+  EXPECT_EQ(a(0, 0), 5);
+
+  // ... and it stays valid when all the arrays are released
+  b.reset();
+  a = cow_array_t{};
+  EXPECT_EQ(v(1, 2), 12);
+
+  // a const view of an unshareable block is a view of the array
+  auto c = make_cow(3, 4);
+  auto w = c();
+  auto u = std::as_const(c)(1, _);
+  w(1, 2) = -1;
+  EXPECT_EQ(u(2), -1);
+}
+
+// ==============================================================
+
+TEST(Cow, ConstViewsInThreads) { //NOLINT
+  auto a        = make_cow(20, 30);
+  auto const b  = a;
+  auto const *p = b.data();
+
+  // the threads take const views of the same shared array : no copy
+  std::vector<long> sums(8, 0);
+  std::vector<std::thread> threads;
+  for (long t = 0; t < long(sums.size()); ++t)
+    threads.emplace_back([&b, &sums, p, t]() {
+      for (int k = 0; k < 100; ++k) {
+        auto v = b(t, _);
+        EXPECT_EQ(v.data(), p + 30 * t);
+        sums[t] += sum(v);
+      }
+    });
+  for (auto &th : threads) th.join();
+
+  EXPECT_EQ(b.data(), p);
+  EXPECT_EQ(a.storage().refcount(), 2);
+  EXPECT_TRUE(b.storage().is_shareable());
+  for (long t = 0; t < long(sums.size()); ++t) EXPECT_EQ(sums[t], 100 * (300 * t + 435));
+}
+
+// ==============================================================
+
+TEST(Cow, Threads) { //NOLINT
+  auto a = make_cow(20, 30);
+  auto r = nda::array<long, 2>{a};
+
+  // each thread writes into its own copy
+  std::vector<cow_array_t> copies(8, a);
+  std::vector<std::thread> threads;
+  for (long t = 0; t < long(copies.size()); ++t)
+    threads.emplace_back([&copies, t]() {
+      auto &c = copies[t];
+      for (long i = 0; i < c.extent(0); ++i) c(i, 0) = -t;
+    });
+  for (auto &th : threads) th.join();
+
+  EXPECT_EQ_ARRAY(a, r);
+  for (long t = 0; t < long(copies.size()); ++t) {
+    EXPECT_EQ(copies[t].storage().refcount(), 1);
+    EXPECT_EQ(copies[t](3, 0), -t);
+    EXPECT_EQ_ARRAY(copies[t](_, range(1, 30)), r(_, range(1, 30)));
+  }
+}
+
+MAKE_MAIN;
@@ -0,0 +1,99 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+using nda::diagonal_matrix;
+using nda::scaled_identity;
+
+// a dense test matrix
+nda::matrix<dcomplex> make_dense(long n1, long n2) {
+  nda::matrix<dcomplex> m(n1, n2);
+  for (int i = 0; i < n1; ++i)
+    for (int j = 0; j < n2; ++j) m(i, j) = (i + 2 * j + 1) + 1i * (i - j);
+  return m;
+}
+
+//----------------------------
+
+TEST(DiagonalMatrix, Dense) { //NOLINT
+  auto D = diagonal_matrix{nda::vector<double>{1, 2, 3}};
+  static_assert(std::is_same_v<decltype(D), diagonal_matrix<double>>);
+  EXPECT_EQ(D.dim(), 3);
+  EXPECT_ARRAY_EQ(to_dense(D), nda::diag(nda::vector<double>{1, 2, 3}));
+  EXPECT_EQ(D(1, 1), 2);
+  EXPECT_EQ(D(1, 2), 0);
+
+  auto X = scaled_identity<dcomplex>{3, 2.0 + 1i};
+  EXPECT_ARRAY_EQ(to_dense(X), (nda::matrix<dcomplex>{{2.0 + 1i, 0, 0}, {0, 2.0 + 1i, 0}, {0, 0, 2.0 + 1i}}));
+  EXPECT_ARRAY_EQ(to_dense(diagonal_matrix<dcomplex>{X}), to_dense(X));
+
+  EXPECT_ARRAY_NEAR(to_dense(inverse(D)) * to_dense(D), nda::eye<double>(3));
+  EXPECT_ARRAY_NEAR(to_dense(inverse(X) * X), nda::eye<dcomplex>(3));
+}
+
+//----------------------------
+
+TEST(DiagonalMatrix, Products) { //NOLINT
+  auto D  = diagonal_matrix{nda::vector<double>{1, -2, 3}};
+  auto X  = scaled_identity<double>{3, 2.5};
+  auto A  = make_dense(3, 4);
+  auto B  = make_dense(4, 3);
+  auto AF = nda::matrix<dcomplex, nda::F_layout>{A};
+
+  EXPECT_ARRAY_NEAR(D * A, to_dense(D) * A);
+  EXPECT_ARRAY_NEAR(D * AF, to_dense(D) * A);
+  EXPECT_ARRAY_NEAR(B * D, B * to_dense(D));
+  EXPECT_ARRAY_NEAR(X * A, 2.5 * A);
+  EXPECT_ARRAY_NEAR(B * X, 2.5 * B);
+  EXPECT_ARRAY_NEAR(D * dagger(B), to_dense(D) * make_regular(dagger(B)));
+
+  auto x = nda::vector<dcomplex>{1, 1i, 2};
+  EXPECT_ARRAY_NEAR(D * x, to_dense(D) * x);
+  EXPECT_ARRAY_NEAR(X * x, 2.5 * x);
+
+  EXPECT_ARRAY_NEAR(to_dense(D * X), to_dense(D) * to_dense(X));
+  EXPECT_ARRAY_NEAR(to_dense(D * D), to_dense(D) * to_dense(D));
+  static_assert(std::is_same_v<decltype(X * X), scaled_identity<double>>);
+  EXPECT_EQ((X * X).value(), 6.25);
+  EXPECT_ARRAY_NEAR(to_dense(2.0 * D), 2.0 * to_dense(D));
+}
+
+//----------------------------
+
+TEST(DiagonalMatrix, Sums) { //NOLINT
+  auto D = diagonal_matrix{nda::vector<double>{1, -2, 3}};
+  auto X = scaled_identity<dcomplex>{3, 1i};
+  auto A = make_dense(3, 3);
+
+  EXPECT_ARRAY_NEAR(A + D, A + to_dense(D));
+  EXPECT_ARRAY_NEAR(D + A, A + to_dense(D));
+  EXPECT_ARRAY_NEAR(A - D, A - to_dense(D));
+  EXPECT_ARRAY_NEAR(D - A, to_dense(D) - A);
+  EXPECT_ARRAY_NEAR(X - A, to_dense(X) - A);
+
+  // a self energy like shift : (i w + mu) - h
+  auto h = nda::matrix<double>{{1, 2, 0}, {2, -1, 0}, {0, 0, 3}};
+  EXPECT_ARRAY_NEAR(scaled_identity<dcomplex>{3, 0.5 + 1i} - h, (0.5 + 1i) * nda::eye<dcomplex>(3) - h);
+
+  A += D;
+  EXPECT_ARRAY_NEAR(A, make_dense(3, 3) + to_dense(D));
+
+  EXPECT_ARRAY_NEAR(to_dense(D + X), to_dense(D) + to_dense(X));
+  EXPECT_ARRAY_NEAR(to_dense(D - D), nda::matrix<double>::zeros({3, 3}));
+  EXPECT_EQ((X + X).value(), 2i);
+}
+
+MAKE_MAIN;
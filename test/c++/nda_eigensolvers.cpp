@@ -0,0 +1,101 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+using nda::linalg::eigensolver_params;
+
+// a random hermitian matrix, with a dominant diagonal
+template <typename T>
+nda::matrix<T> random_hermitian(long n) {
+  nda::matrix<T> M = nda::rand<double>(n, n);
+  if constexpr (nda::is_complex_v<T>) M += 1i * nda::matrix<double>(nda::rand<double>(n, n));
+  nda::matrix<T> H = 0.05 * (M + dagger(M));
+  for (long i = 0; i < n; ++i) H(i, i) += i;
+  return H;
+}
+
+// check the eigenpairs against the dense diagonalization
+template <typename T>
+void check(nda::matrix<T> const &H, nda::linalg::eigensolver_result<T> const &r, char which, double tol) {
+  EXPECT_TRUE(r.converged);
+  auto ev = nda::linalg::eigenvalues(H);
+  long n = H.extent(0), k = r.eigenvalues.size();
+  for (long i = 0; i < k; ++i) {
+    EXPECT_NEAR(r.eigenvalues(i), ev(which == 'S' ? i : n - 1 - i), tol);
+    auto x = nda::vector<T>{r.eigenvectors(_, i)};
+    EXPECT_ARRAY_NEAR(nda::vector<T>{H * x}, nda::vector<T>{r.eigenvalues(i) * x}, tol * std::max(1.0, std::abs(r.eigenvalues(i))));
+  }
+}
+
+// ==============================================================
+
+TEST(Eigensolvers, Lanczos) { //NOLINT
+  long n = 300;
+  auto H = random_hermitian<double>(n);
+
+  auto op = [&H](nda::array_const_view<double, 1> x, nda::array_view<double, 1> y) { nda::blas::gemv(1.0, H, x, 0.0, y); };
+  auto r  = nda::linalg::lanczos<double>(op, n, eigensolver_params{.n_eigen = 4});
+  check(H, r, 'S', 1.e-8);
+
+  // largest, with a small subspace : several restarts
+  auto r2 = nda::linalg::lanczos<double>(op, n, eigensolver_params{.n_eigen = 3, .which = 'L', .max_subspace = 12});
+  check(H, r2, 'L', 1.e-8);
+  EXPECT_GT(r2.n_iterations, 0);
+}
+
+// -----------------------------------------------------
+
+TEST(Eigensolvers, LanczosComplex) { //NOLINT
+  long n  = 200;
+  auto H  = random_hermitian<dcomplex>(n);
+  auto op = [&H](nda::array_const_view<dcomplex, 1> x, nda::array_view<dcomplex, 1> y) { nda::blas::gemv(1.0, H, x, 0.0, y); };
+  check(H, nda::linalg::lanczos<dcomplex>(op, n, eigensolver_params{.n_eigen = 2}), 'S', 1.e-8);
+
+  // small space : the Krylov space is the whole space
+  auto H2  = random_hermitian<dcomplex>(6);
+  auto op2 = [&H2](nda::array_const_view<dcomplex, 1> x, nda::array_view<dcomplex, 1> y) { nda::blas::gemv(dcomplex{1}, H2, x, dcomplex{0}, y); };
+  check(H2, nda::linalg::lanczos<dcomplex>(op2, 6, eigensolver_params{.n_eigen = 2}), 'S', 1.e-8);
+}
+
+// -----------------------------------------------------
+
+TEST(Eigensolvers, Davidson) { //NOLINT
+  long n = 300;
+  auto H = random_hermitian<double>(n);
+  nda::array<double, 1> d(n);
+  for (long i = 0; i < n; ++i) d(i) = H(i, i);
+
+  // the operator on a block of vectors
+  long n_calls = 0;
+  auto op      = [&](nda::matrix_const_view<double, nda::F_stride_layout> X, nda::matrix_view<double, nda::F_stride_layout> Y) {
+    ++n_calls;
+    Y = H * X;
+  };
+  auto r = nda::linalg::davidson<double>(op, n, eigensolver_params{.n_eigen = 4}, d);
+  check(H, r, 'S', 1.e-8);
+  EXPECT_LT(n_calls, r.n_matvec);
+
+  // without preconditioner, largest
+  auto r2 = nda::linalg::davidson<double>(op, n, eigensolver_params{.n_eigen = 2, .which = 'L'});
+  check(H, r2, 'L', 1.e-8);
+
+  // complex
+  auto Hc  = random_hermitian<dcomplex>(150);
+  auto opc = [&Hc](nda::array_const_view<dcomplex, 1> x, nda::array_view<dcomplex, 1> y) { nda::blas::gemv(dcomplex{1}, Hc, x, dcomplex{0}, y); };
+  check(Hc, nda::linalg::davidson<dcomplex>(opc, 150, eigensolver_params{.n_eigen = 3}), 'S', 1.e-8);
+}
+
+MAKE_MAIN;
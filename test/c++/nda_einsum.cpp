@@ -0,0 +1,189 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+#include <nda/linalg/einsum.hpp>
+
+using nda::F_layout;
+
+// Reference implementation : C(a,b,c) = sum_k A(a,k,b) B(k,c)
+template <typename T>
+nda::array<T, 3> ref_akb_kc(nda::array<T, 3> const &A, nda::array<T, 2> const &B) {
+  auto [na, nk, nb] = A.shape();
+  long nc           = B.extent(1);
+  nda::array<T, 3> C(na, nb, nc);
+  C() = 0;
+  for (long a = 0; a < na; ++a)
+    for (long b = 0; b < nb; ++b)
+      for (long c = 0; c < nc; ++c)
+        for (long k = 0; k < nk; ++k) C(a, b, c) += A(a, k, b) * B(k, c);
+  return C;
+}
+
+// -------------------------------------
+
+TEST(Einsum, Spec) { //NOLINT
+  constexpr nda::einsum_spec s{"ij,jk->ki"};
+  static_assert(s.n_inputs == 2);
+  static_assert(s.inputs[0].n == 2 and s.inputs[1].n == 2);
+  static_assert(s.output.n == 2 and s.output[0] == 'k' and s.output[1] == 'i');
+
+  // implicit result : labels appearing once, sorted
+  constexpr nda::einsum_spec s2{"kj,ij"};
+  static_assert(s2.output.n == 2 and s2.output[0] == 'i' and s2.output[1] == 'k');
+}
+
+// -------------------------------------
+
+TEST(Einsum, Matmul) { //NOLINT
+  auto A = nda::rand<double>(5, 7);
+  auto B = nda::rand<double>(7, 3);
+
+  auto C = nda::einsum<"ij,jk->ik">(A, B);
+  EXPECT_ARRAY_NEAR(C, nda::matrix<double>{A} * nda::matrix<double>{B}, 1.e-13);
+
+  // transposed result
+  auto Ct = nda::einsum<"ij,jk->ki">(A, B);
+  EXPECT_ARRAY_NEAR(Ct, transpose(C), 1.e-13);
+
+  // Fortran layout operands and transposed views
+  nda::array<double, 2, F_layout> AF = A;
+  auto C2                            = nda::einsum<"ji,jk->ik">(transpose(AF), B);
+  EXPECT_ARRAY_NEAR(C2, C, 1.e-13);
+
+  // strided slices
+  nda::array<double, 2> Abig(10, 14);
+  Abig(range(0, 10, 2), range(0, 14, 2)) = A;
+  auto C3 = nda::einsum<"ij,jk->ik">(Abig(range(0, 10, 2), range(0, 14, 2)), B);
+  EXPECT_ARRAY_NEAR(C3, C, 1.e-13);
+}
+
+// -------------------------------------
+
+TEST(Einsum, Rank3) { //NOLINT
+  auto A = nda::rand<double>(4, 6, 5);
+  auto B = nda::rand<double>(6, 3);
+  auto R = ref_akb_kc(nda::array<double, 3>{A}, nda::array<double, 2>{B});
+
+  // a and b are not mergeable in A : transpose or loop over gemm
+  EXPECT_ARRAY_NEAR(nda::einsum<"akb,kc->abc">(A, B), R, 1.e-13);
+
+  // same contraction on a permuted view of A, with mergeable (a,b)
+  nda::array<double, 3> Ap = nda::permuted_indices_view<nda::encode(std::array{0, 2, 1})>(A);
+  EXPECT_ARRAY_NEAR(nda::einsum<"abk,kc->abc">(Ap, B), R, 1.e-13);
+
+  // complex
+  auto Z  = nda::array<dcomplex, 3>(A) * dcomplex{1, 2};
+  auto RZ = ref_akb_kc(nda::array<dcomplex, 3>{Z}, nda::array<dcomplex, 2>{B});
+  EXPECT_ARRAY_NEAR(nda::einsum<"akb,kc->abc">(Z, B), RZ, 1.e-13);
+}
+
+// -------------------------------------
+
+TEST(Einsum, Batch) { //NOLINT
+  auto A = nda::rand<double>(3, 4, 5);
+  auto B = nda::rand<double>(3, 5, 2);
+  auto C = nda::einsum<"bij,bjk->bik">(A, B);
+  for (long b = 0; b < 3; ++b) {
+    nda::matrix<double> Ab = A(b, _, _), Bb = B(b, _, _);
+    EXPECT_ARRAY_NEAR(C(b, _, _), Ab * Bb, 1.e-13);
+  }
+}
+
+// -------------------------------------
+
+TEST(Einsum, Scalar) { //NOLINT
+  auto A = nda::rand<double>(4, 5);
+  auto B = nda::rand<double>(5, 4);
+  double r{0}, tr{0};
+  for (long i = 0; i < 4; ++i)
+    for (long j = 0; j < 5; ++j) {
+      r += A(i, j) * A(i, j);
+      tr += A(i, j) * B(j, i);
+    }
+  EXPECT_NEAR((nda::einsum<"ij,ij->">(A, A)), r, 1.e-13);
+  EXPECT_NEAR((nda::einsum<"ij,ji">(A, B)), tr, 1.e-13);
+  EXPECT_NEAR((nda::einsum<"ij->">(A)), sum(A), 1.e-13);
+}
+
+// -------------------------------------
+
+TEST(Einsum, Unary) { //NOLINT
+  auto A = nda::rand<double>(3, 4, 5);
+  auto R = nda::einsum<"ijk->ki">(A);
+  for (long i = 0; i < 3; ++i)
+    for (long k = 0; k < 5; ++k) EXPECT_NEAR(R(k, i), sum(A(i, _, k)), 1.e-13);
+}
+
+// -------------------------------------
+
+TEST(Einsum, Chain) { //NOLINT
+  nda::matrix<double> A = nda::rand<double>(6, 20);
+  nda::matrix<double> B = nda::rand<double>(20, 30);
+  nda::matrix<double> C = nda::rand<double>(30, 2);
+  auto R                = nda::einsum<"ij,jk,kl->il">(A, B, C);
+  EXPECT_ARRAY_NEAR(R, A * B * C, 1.e-12);
+
+  // label summed in one operand only
+  auto R2  = nda::einsum<"ij,kl,jk->i">(A, C, B);
+  auto ref = nda::make_regular(A * B * C);
+  for (long i = 0; i < 6; ++i) EXPECT_NEAR(R2(i), sum(ref(i, _)), 1.e-12);
+}
+
+// -------------------------------------
+
+TEST(Einsum, Int) { //NOLINT
+  nda::array<long, 2> A{{1, 2, 3}, {4, 5, 6}};
+  nda::array<long, 2> B{{1, 0}, {0, 1}, {1, 1}};
+  auto C = nda::einsum<"ij,jk->ik">(A, B);
+  EXPECT_ARRAY_EQ(C, (nda::array<long, 2>{{4, 5}, {10, 11}}));
+}
+
+// -------------------------------------
+
+TEST(Einsum, Plan) { //NOLINT
+  using namespace nda::einsum_details;
+  auto labels = [](std::string const &s) {
+    labels_t l;
+    for (char x : s) l.push_back(x);
+    return l;
+  };
+
+  // contiguous matrices : a single gemm, no copy
+  nda::array<double, 2> A(8, 9), B(9, 10), C(8, 10);
+  auto p = make_plan(make_desc<double>(A, labels("ij")), make_desc<double>(B, labels("jk")), make_desc<double>(C, labels("ik")));
+  EXPECT_EQ(p.n_gemm, 1);
+  EXPECT_FALSE(p.copy_a or p.copy_b or p.copy_c);
+
+  // A(a,k,b) small : a,b not mergeable in A. Transpose A.
+  nda::array<double, 3> A3(4, 6, 5), C3(4, 5, 3);
+  nda::array<double, 2> B3(6, 3);
+  auto p2 = make_plan(make_desc<double>(A3, labels("akb")), make_desc<double>(B3, labels("kc")), make_desc<double>(C3, labels("abc")));
+  EXPECT_TRUE(p2.copy_a);
+  EXPECT_EQ(p2.n_gemm, 1);
+
+  // same, large : loop over a, with zero copy
+  nda::array<double, 3> A4(4, 64, 64), C4(4, 64, 64);
+  nda::array<double, 2> B4(64, 64);
+  auto p3 = make_plan(make_desc<double>(A4, labels("akb")), make_desc<double>(B4, labels("kc")), make_desc<double>(C4, labels("abc")));
+  EXPECT_FALSE(p3.copy_a or p3.copy_b or p3.copy_c);
+  EXPECT_EQ(p3.n_gemm, 4);
+  EXPECT_EQ(p3.m, 64);
+
+  A4 = nda::rand<double>(4, 64, 64);
+  B4 = nda::rand<double>(64, 64);
+  EXPECT_ARRAY_NEAR(nda::einsum<"akb,kc->abc">(A4, B4), ref_akb_kc(A4, B4), 1.e-12);
+}
+
+MAKE_MAIN;
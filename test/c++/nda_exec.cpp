@@ -0,0 +1,163 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+
+#include <atomic>
+#include <stdexcept>
+
+namespace exec = nda::exec;
+
+// ==============================================================
+
+TEST(Exec, ParallelFor) { //NOLINT
+  exec::configure({.n_threads = 4});
+  EXPECT_EQ(exec::n_threads(), 4);
+
+  for (long n : {0l, 1l, 7l, 10000l}) {
+    nda::array<int, 1> hits(n);
+    hits = 0;
+    exec::parallel_for(n, [&](long i) { hits(i) += 1; });
+    for (long i = 0; i < n; ++i) EXPECT_EQ(hits(i), 1);
+  }
+
+  // explicit grain : the chunks have this size, except the last one
+  std::atomic<long> n_chunks = 0;
+  exec::parallel_for_chunks(
+     1000,
+     [&](long b, long e) {
+       EXPECT_EQ(b % 64, 0);
+       EXPECT_EQ(e, std::min(b + 64, 1000l));
+       ++n_chunks;
+     },
+     64);
+  EXPECT_EQ(n_chunks, 16);
+}
+
+// ==============================================================
+
+TEST(Exec, MinWork) { //NOLINT
+  exec::configure({.n_threads = 4, .min_work = 4096});
+
+  auto count_chunks = [](long n, long work) {
+    std::atomic<long> c = 0;
+    exec::parallel_for_chunks(n, [&](long, long) { ++c; }, 0, work);
+    return long(c);
+  };
+  // a small loop is one chunk, run in the calling thread
+  EXPECT_EQ(count_chunks(1000, 1), 1);
+  std::atomic<bool> sequential = true;
+  exec::parallel_for(1000, [&](long) {
+    if (exec::in_parallel() or exec::worker_index() != 0) sequential = false;
+  });
+  EXPECT_TRUE(sequential);
+
+  // heavier iterations : at least 4096 / 1000 = 5 iterations per chunk, and 1000 / (8 * 4) = 31 by default
+  EXPECT_EQ(count_chunks(1000, 1000), 33);
+  EXPECT_EQ(count_chunks(100, 1000), 20);
+  // a large loop : the default grain
+  EXPECT_EQ(count_chunks(1l << 20, 1), 32);
+}
+
+// ==============================================================
+
+TEST(Exec, DefaultSize) { //NOLINT
+  // the cores the process may run on
+  exec::configure({});
+  EXPECT_EQ(exec::n_threads(), long(exec::topology().size()));
+}
+
+// ==============================================================
+
+TEST(Exec, IndexDomain) { //NOLINT
+  exec::configure({.n_threads = 3});
+  nda::array<long, 3> a(5, 6, 7);
+  a = 0;
+  exec::parallel_for(a.shape(), [&](long i, long j, long k) { a(i, j, k) += 100 * i + 10 * j + k; }, 5);
+  for (auto [i, j, k] : a.indices()) EXPECT_EQ(a(i, j, k), 100 * i + 10 * j + k);
+}
+
+// ==============================================================
+
+TEST(Exec, Nested) { //NOLINT
+  exec::configure({.n_threads = 4});
+  nda::array<long, 2> a(20, 30);
+  std::atomic<bool> nested_ok = true;
+  exec::parallel_for(
+     20,
+     [&](long i) {
+       if (not exec::in_parallel()) nested_ok = false;
+       // runs sequentially in the worker
+       int w = exec::worker_index();
+       exec::parallel_for(
+          30,
+          [&](long j) {
+            if (exec::worker_index() != w) nested_ok = false;
+            a(i, j) = i * j;
+          },
+          1);
+     },
+     1);
+  EXPECT_TRUE(nested_ok);
+  EXPECT_FALSE(exec::in_parallel());
+  for (auto [i, j] : a.indices()) EXPECT_EQ(a(i, j), i * j);
+}
+
+// ==============================================================
+
+TEST(Exec, Exception) { //NOLINT
+  exec::configure({.n_threads = 4});
+  std::atomic<long> count = 0;
+  EXPECT_THROW(exec::parallel_for( //NOLINT
+                  100000,
+                  [&](long i) {
+                    ++count;
+                    if (i == 10) throw std::runtime_error("error");
+                  },
+                  100),
+               std::runtime_error);
+  EXPECT_LT(count, 100000);
+
+  // the pool is still usable
+  std::atomic<long> s = 0;
+  exec::parallel_for(100, [&](long i) { s += i; });
+  EXPECT_EQ(s, 4950);
+}
+
+// ==============================================================
+
+TEST(Exec, Topology) { //NOLINT
+  auto topo = exec::topology();
+  EXPECT_GE(topo.size(), 1);
+  for (long c = 1; c < topo.size(); ++c) EXPECT_LE(topo[c - 1].numa_node, topo[c].numa_node);
+
+  // a pinned pool works as another one
+  exec::configure({.n_threads = 2, .pin = true});
+  EXPECT_EQ(exec::default_pool().n_pinned(), std::min(2l, long(topo.size())));
+  std::atomic<long> s = 0;
+  exec::parallel_for(1000, [&](long i) { s += i; }, 10);
+  EXPECT_EQ(s, 499500);
+
+  // more workers than cores : the extra workers are not pinned
+  int n = int(topo.size()) + 2;
+  exec::configure({.n_threads = n, .pin = true});
+  EXPECT_EQ(exec::default_pool().n_pinned(), long(topo.size()));
+  for (int w = 0; w < exec::default_pool().n_pinned(); ++w)
+    for (int v = 0; v < w; ++v) EXPECT_NE(exec::default_pool().core(w).cpu, exec::default_pool().core(v).cpu);
+  s = 0;
+  exec::parallel_for(1000, [&](long i) { s += i; }, 10);
+  EXPECT_EQ(s, 499500);
+}
+
+MAKE_MAIN;
@@ -0,0 +1,179 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+#include <nda/fft.hpp>
+
+#include <atomic>
+#include <thread>
+
+// the 1d transform of a along axis, by the definition
+template <typename A>
+nda::array<dcomplex, 3> dft_axis(A const &a, int axis, int sign) {
+  nda::array<dcomplex, 3> r(a.shape());
+  r       = 0;
+  long n  = a.shape()[axis];
+  auto sh = a.shape();
+  for (int i = 0; i < sh[0]; ++i)
+    for (int j = 0; j < sh[1]; ++j)
+      for (int k = 0; k < sh[2]; ++k) {
+        std::array<long, 3> idx{i, j, k};
+        long q = idx[axis];
+        for (long m = 0; m < n; ++m) {
+          idx[axis] = m;
+          r(i, j, k) += a(idx[0], idx[1], idx[2]) * std::exp(sign * 2i * M_PI * double(m * q) / double(n));
+        }
+      }
+  return r;
+}
+
+nda::array<dcomplex, 3> make_a() {
+  nda::array<dcomplex, 3> a(4, 3, 5);
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 3; ++j)
+      for (int k = 0; k < 5; ++k) a(i, j, k) = std::cos(i + 2.0 * j - k) + 1i * (0.1 * i * k - j);
+  return a;
+}
+
+//----------------------------
+
+TEST(FFT, Axes) { //NOLINT
+  using nda::fft::fft;
+  using nda::fft::ifft;
+  auto a = make_a();
+
+  // one axis, batched over the others
+  for (int ax = 0; ax < 3; ++ax) EXPECT_ARRAY_NEAR(fft(a, {ax}), dft_axis(a, ax, -1), 1.e-12);
+
+  // two axes, and all axes
+  EXPECT_ARRAY_NEAR(fft(a, {0, 2}), dft_axis(dft_axis(a, 0, -1), 2, -1), 1.e-12);
+  EXPECT_ARRAY_NEAR(fft(a), dft_axis(dft_axis(dft_axis(a, 0, -1), 1, -1), 2, -1), 1.e-11);
+
+  // the backward transform is normalized
+  EXPECT_ARRAY_NEAR(ifft(fft(a)), a, 1.e-13);
+  EXPECT_ARRAY_NEAR(ifft(fft(a, {1}), {1}), a, 1.e-13);
+
+  // a real array
+  nda::array<double, 3> ar = real(a);
+  EXPECT_ARRAY_NEAR(fft(ar, {2}), dft_axis(nda::array<dcomplex, 3>(ar), 2, -1), 1.e-12);
+
+  EXPECT_THROW(fft(a, {3}), nda::runtime_error);
+  EXPECT_THROW(fft(a, {1, 1}), nda::runtime_error);
+}
+
+//----------------------------
+
+TEST(FFT, Layouts) { //NOLINT
+  using nda::fft::fft;
+  auto a   = make_a();
+  auto ref = dft_axis(a, 1, -1);
+
+  // Fortran layout in and out
+  nda::array<dcomplex, 3, nda::F_layout> af = a, rf(a.shape());
+  fft(af, rf, {1});
+  EXPECT_ARRAY_NEAR(rf, ref, 1.e-12);
+
+  // strided views, in and out, with a different layout
+  nda::array<dcomplex, 3> big(8, 3, 10), out(4, 3, 5);
+  auto v = big(nda::range(0, 8, 2), nda::range::all, nda::range(1, 10, 2));
+  v      = a;
+  fft(v, out, {1});
+  EXPECT_ARRAY_NEAR(out, ref, 1.e-12);
+
+  // into a strided view
+  big = 0;
+  fft(a, v, {1});
+  EXPECT_ARRAY_NEAR(v, ref, 1.e-12);
+  EXPECT_EQ(big(1, 0, 0), 0.0);
+
+  // in place, on a view
+  v = a;
+  nda::fft::fft_inplace(v, {1});
+  EXPECT_ARRAY_NEAR(v, ref, 1.e-12);
+  nda::fft::ifft_inplace(v, {1});
+  EXPECT_ARRAY_NEAR(v, a, 1.e-13);
+}
+
+//----------------------------
+
+TEST(FFT, PlanCache) { //NOLINT
+  nda::fft::clear_plan_cache();
+  EXPECT_EQ(nda::fft::plan_cache_size(), 0);
+
+  auto a = make_a();
+  nda::array<dcomplex, 3> b(a.shape());
+
+  // the same layout, axes and direction reuse the plan
+  for (int i = 0; i < 10; ++i) nda::fft::fft(a, b, {0});
+  EXPECT_EQ(nda::fft::plan_cache_size(), 1);
+  auto a2 = make_a();
+  nda::fft::fft(a2, b, {0});
+  EXPECT_EQ(nda::fft::plan_cache_size(), 1);
+
+  nda::fft::ifft(a, b, {0});
+  nda::fft::fft(a, b, {1});
+  nda::fft::fft_inplace(a2, {0});
+  EXPECT_EQ(nda::fft::plan_cache_size(), 4);
+
+  // threads and planner
+  nda::fft::fft(a, b, {0}, {.n_threads = 2, .planner = FFTW_MEASURE});
+  EXPECT_EQ(nda::fft::plan_cache_size(), 5);
+  EXPECT_ARRAY_NEAR(b, dft_axis(a, 0, -1), 1.e-12);
+
+  nda::fft::clear_plan_cache();
+  EXPECT_EQ(nda::fft::plan_cache_size(), 0);
+}
+
+//----------------------------
+
+TEST(FFT, ClearWhileTransforming) { //NOLINT
+  auto a   = make_a();
+  auto ref = dft_axis(a, 2, -1);
+
+  // the plans executed by the threads stay valid when the cache is cleared
+  std::atomic<bool> done = false;
+  std::vector<std::thread> threads;
+  std::vector<nda::array<dcomplex, 3>> results(4, nda::array<dcomplex, 3>(a.shape()));
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < 200; ++i) nda::fft::fft(a, results[t], {2});
+    });
+  std::thread clearing([&] {
+    while (not done) nda::fft::clear_plan_cache();
+  });
+  for (auto &th : threads) th.join();
+  done = true;
+  clearing.join();
+
+  for (auto const &r : results) EXPECT_ARRAY_NEAR(r, ref, 1.e-12);
+}
+
+//----------------------------
+
+TEST(FFT, SamePlanInThreads) { //NOLINT
+  nda::fft::clear_plan_cache();
+  auto a   = make_a();
+  auto ref = dft_axis(a, 1, -1);
+
+  // the threads may make the same plan concurrently : one is kept in the cache
+  std::vector<std::thread> threads;
+  std::vector<nda::array<dcomplex, 3>> results(4, nda::array<dcomplex, 3>(a.shape()));
+  for (int t = 0; t < 4; ++t) threads.emplace_back([&, t] { nda::fft::fft(a, results[t], {1}, {.planner = FFTW_MEASURE}); });
+  for (auto &th : threads) th.join();
+
+  EXPECT_EQ(nda::fft::plan_cache_size(), 1);
+  for (auto const &r : results) EXPECT_ARRAY_NEAR(r, ref, 1.e-12);
+}
+
+MAKE_MAIN;
@@ -542,3 +542,76 @@ TEST(BlockMatrixH5, S1) { //NOLINT
   EXPECT_EQ(V.extent(0), W.extent(0));
   for (int i = 0; i < V.extent(0); ++i) EXPECT_ARRAY_NEAR(V(i), W(i));
 }
+
+// -----------------------------------------------------
+
+TEST(SparseH5, CSR) { //NOLINT
+
+  nda::coo_matrix<double> C(3, 4);
+  C.insert(2, 1, 1.0);
+  C.insert(0, 3, 2.0);
+  nda::csr_matrix<double> A{C}, A2;
+  nda::csc_matrix<dcomplex> B{nda::matrix<dcomplex>{1i * nda::to_dense(A)}}, B2;
+  nda::coo_matrix<double> C2;
+
+  {
+    h5::file file1("ess_sparse.h5", 'w');
+    h5_write(file1, "csr", A);
+    h5_write(file1, "csc", B);
+    h5_write(file1, "coo", C);
+  }
+
+  {
+    h5::file file2("ess_sparse.h5", 'r');
+    h5_read(file2, "csr", A2);
+    h5_read(file2, "csc", B2);
+    h5_read(file2, "coo", C2);
+  }
+
+  EXPECT_EQ(A, A2);
+  EXPECT_EQ(B, B2);
+  EXPECT_ARRAY_EQ(nda::to_dense(C), nda::to_dense(C2));
+}
+
+// -----------------------------------------------------
+
+TEST(AccumulatorsH5, S1) { //NOLINT
+
+  nda::mean_accumulator<dcomplex, 1> m({2}), m2;
+  nda::log_binning_accumulator<double, 2> l({2, 2}, 6), l2;
+  nda::jackknife_accumulator<double, 1> j({3}, 4), j2;
+  for (int t = 0; t < 37; ++t) {
+    m << nda::array<dcomplex, 1>{double(t), 1i * double(t * t)};
+    l << nda::array<double, 2>{{1.0 * t, 2}, {3, -1.0 * t * t}};
+    j << nda::array<double, 1>{1.0 * t, 2, -3.0 * t};
+  }
+
+  {
+    h5::file file1("ess_accumulators.h5", 'w');
+    h5_write(file1, "m", m);
+    h5_write(file1, "l", l);
+    h5_write(file1, "j", j);
+  }
+
+  {
+    h5::file file2("ess_accumulators.h5", 'r');
+    h5_read(file2, "m", m2);
+    h5_read(file2, "l", l2);
+    h5_read(file2, "j", j2);
+  }
+
+  EXPECT_EQ(m.count(), m2.count());
+  EXPECT_ARRAY_EQ(m.mean(), m2.mean());
+  EXPECT_ARRAY_EQ(m.m2(), m2.m2());
+
+  // the read accumulators can be filled further
+  l << nda::array<double, 2>{{0, 0}, {0, 0}};
+  l2 << nda::array<double, 2>{{0, 0}, {0, 0}};
+  for (long k = 0; k < l.n_levels(); ++k) EXPECT_EQ(l.count(k), l2.count(k));
+  EXPECT_ARRAY_EQ(l.means(), l2.means());
+  EXPECT_ARRAY_EQ(l.m2s(), l2.m2s());
+
+  EXPECT_EQ(j.count(), j2.count());
+  EXPECT_EQ(j.bin_size(), j2.bin_size());
+  EXPECT_ARRAY_EQ(j.bins(), j2.bins());
+}
@@ -53,6 +53,43 @@ TEST(idxstat, eval) { // NOLINT
 
 //-----------------------
 
+TEST(idxstat, FullyStatic) { // NOLINT
+
+  using i_t = idx_map<3, encode(std::array{2, 7, 3}), C_stride_order<3>, layout_prop_e::contiguous>;
+  static_assert(i_t::is_fully_static);
+  static_assert(std::is_empty_v<i_t>);
+
+  i_t i1;
+  EXPECT_TRUE(i1.lengths() == (ma(2, 7, 3))); //NOLINT
+  EXPECT_TRUE(i1.strides() == (ma(21, 3, 1))); //NOLINT
+  EXPECT_EQ(i1.size(), 42);                     //NOLINT
+  EXPECT_EQ(i1(1, 3, 2), 21 * 1 + 3 * 3 + 2 * 1); //NOLINT
+  EXPECT_EQ(i1, i_t(ma(2, 7, 3)));              //NOLINT
+
+  // Fortran order
+  using f_t = idx_map<2, encode(std::array{2, 3}), Fortran_stride_order<2>, layout_prop_e::contiguous>;
+  static_assert(std::is_empty_v<f_t>);
+  EXPECT_TRUE(f_t{}.strides() == (ma(1, 2))); //NOLINT
+
+  // static extents, but not contiguous : the lengths and strides are stored
+  using n_t = idx_map<2, encode(std::array{2, 3}), C_stride_order<2>, layout_prop_e::none>;
+  static_assert(not n_t::is_fully_static);
+  n_t i2{ma(2, 3), ma(6, 2)};
+  EXPECT_EQ(i2(1, 1), 8); //NOLINT
+
+  // slices
+  auto [offset, i3] = slice_stride_order(i1, 1, range::all, range::all);
+  static_assert(decltype(i3)::is_fully_static);
+  EXPECT_EQ(offset, 21);
+  EXPECT_TRUE(i3.strides() == (ma(3, 1))); //NOLINT
+  auto [offset2, i4] = slice_stride_order(i1, range::all, 1, range::all);
+  static_assert(not decltype(i4)::is_fully_static);
+  EXPECT_EQ(offset2, 3);
+  EXPECT_TRUE(i4.strides() == (ma(21, 1))); //NOLINT
+}
+
+//-----------------------
+
 //TEST(idxstat, boundcheck) { // NOLINT
 
 //idx_map<3, 0, layout_prop_e::none> i1{{2, 7, 3}};
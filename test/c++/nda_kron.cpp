@@ -0,0 +1,114 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+// the dense Kronecker product, element by element
+template <typename A, typename B>
+nda::matrix<dcomplex> dense_kron(A const &a, B const &b) {
+  auto [m1, n1] = a.shape();
+  auto [m2, n2] = b.shape();
+  nda::matrix<dcomplex> r(m1 * m2, n1 * n2);
+  for (long i1 = 0; i1 < m1; ++i1)
+    for (long j1 = 0; j1 < n1; ++j1)
+      for (long i2 = 0; i2 < m2; ++i2)
+        for (long j2 = 0; j2 < n2; ++j2) r(i1 * m2 + i2, j1 * n2 + j2) = a(i1, j1) * b(i2, j2);
+  return r;
+}
+
+nda::matrix<dcomplex> make_dense(long n1, long n2, double shift = 0) {
+  nda::matrix<dcomplex> m(n1, n2);
+  for (int i = 0; i < n1; ++i)
+    for (int j = 0; j < n2; ++j) m(i, j) = (i + 2 * j + 1 + shift) + 1i * (i - j * shift);
+  return m;
+}
+
+//----------------------------
+
+TEST(Kron, Outer) { //NOLINT
+  nda::vector<dcomplex> x{1, 2i, 3}, y{1, -1, 1i, 2};
+  nda::matrix<dcomplex> exp(3, 4);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) exp(i, j) = x(i) * y(j);
+
+  auto o = nda::outer(x, y);
+  static_assert(nda::get_algebra<decltype(o)> == 'M');
+  EXPECT_EQ(o.shape(), (std::array<long, 2>{3, 4}));
+  EXPECT_EQ(o(1, 2), x(1) * y(2));
+
+  // evaluated with ger, in C and Fortran order, or element by element
+  nda::matrix<dcomplex> M = o;
+  nda::matrix<dcomplex, nda::F_layout> MF(3, 4);
+  MF = o;
+  nda::matrix<dcomplex> M2 = nda::outer(x, nda::vector<double>{1, -1, 0, 2});
+  EXPECT_ARRAY_NEAR(M, exp);
+  EXPECT_ARRAY_NEAR(MF, exp);
+  EXPECT_ARRAY_NEAR(M2(nda::range::all, 0), x);
+
+  // in expressions
+  EXPECT_ARRAY_NEAR(nda::matrix<dcomplex>{2 * o + M}, 3 * exp);
+
+  // product with a vector
+  nda::vector<dcomplex> v{1, 2, 3i, 4};
+  EXPECT_ARRAY_NEAR(o * v, exp * v);
+}
+
+//----------------------------
+
+TEST(Kron, Dense) { //NOLINT
+  auto A = make_dense(2, 3);
+  auto B = make_dense(4, 2, 1);
+  auto K = nda::kron(A, B);
+  static_assert(nda::get_algebra<decltype(K)> == 'M');
+  EXPECT_EQ(K.shape(), (std::array<long, 2>{8, 6}));
+
+  nda::matrix<dcomplex> M = K;
+  EXPECT_ARRAY_NEAR(M, dense_kron(A, B));
+  nda::matrix<dcomplex, nda::F_layout> MF(8, 6);
+  MF = K;
+  EXPECT_ARRAY_NEAR(MF, dense_kron(A, B));
+  EXPECT_ARRAY_NEAR(nda::matrix<dcomplex>{K - M}, nda::matrix<dcomplex>::zeros({8, 6}));
+  EXPECT_EQ(K(5, 3), M(5, 3));
+}
+
+//----------------------------
+
+TEST(Kron, Products) { //NOLINT
+  // both orders of the gemm
+  for (auto [m1, n1, m2, n2] : std::vector<std::array<long, 4>>{{2, 3, 4, 5}, {5, 4, 3, 2}, {3, 3, 3, 3}}) {
+    auto A = make_dense(m1, n1);
+    auto B = make_dense(m2, n2, 0.5);
+    auto D = dense_kron(A, B);
+
+    nda::vector<dcomplex> v(n1 * n2);
+    for (int i = 0; i < v.size(); ++i) v(i) = i - 1i * (i % 3);
+
+    EXPECT_ARRAY_NEAR(nda::kron(A, B) * v, D * v, 1.e-10);
+    EXPECT_ARRAY_NEAR(nda::kron(A, nda::matrix<dcomplex, nda::F_layout>{B}) * v, D * v, 1.e-10);
+
+    auto X = make_dense(n1 * n2, 2);
+    EXPECT_ARRAY_NEAR(nda::kron(A, B) * X, D * X, 1.e-10);
+  }
+
+  // mixed value types, and a non blas type
+  nda::matrix<double> Ar{{1, 2}, {3, 4}};
+  nda::matrix<long> Bl{{1, 0}, {2, -1}};
+  nda::vector<double> v{1, 2, 3, 4};
+  EXPECT_ARRAY_NEAR(nda::kron(Ar, Bl) * v, nda::matrix<double>{nda::kron(Ar, Bl)} * v);
+  nda::vector<long> vl{1, 2, 3, 4};
+  EXPECT_ARRAY_EQ(nda::kron(Bl, Bl) * vl, (nda::matrix<long>{nda::kron(Bl, Bl)} * vl));
+}
+
+MAKE_MAIN;
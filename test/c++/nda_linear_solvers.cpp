@@ -0,0 +1,122 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+using nda::linalg::linear_solver_params;
+
+// A random matrix with a dominant diagonal, hermitian positive definite if hermitian = true
+template <typename T>
+nda::matrix<T> random_matrix(long n, bool hermitian) {
+  nda::matrix<T> M = nda::rand<double>(n, n);
+  if constexpr (nda::is_complex_v<T>) M += 1i * nda::matrix<double>(nda::rand<double>(n, n));
+  nda::matrix<T> A = (hermitian ? nda::matrix<T>{0.01 * (M + dagger(M))} : nda::matrix<T>{0.02 * M});
+  for (long i = 0; i < n; ++i) A(i, i) += 1 + i % 7;
+  return A;
+}
+
+template <typename T>
+auto make_op(nda::matrix<T> const &A) {
+  return [&A](nda::array_const_view<T, 1> x, nda::array_view<T, 1> y) { nda::blas::gemv(T{1}, A, x, T{0}, y); };
+}
+
+// the Jacobi preconditioner
+template <typename T>
+auto make_jacobi(nda::matrix<T> const &A) {
+  return [&A](nda::array_const_view<T, 1> r, nda::array_view<T, 1> z) {
+    for (long i = 0; i < r.size(); ++i) z(i) = r(i) / A(i, i);
+  };
+}
+
+// ==============================================================
+
+TEST(LinearSolvers, CG) { //NOLINT
+  long n                = 200;
+  auto A                = random_matrix<double>(n, true);
+  nda::vector<double> b = nda::rand<double>(n), x(n);
+
+  x      = 0;
+  auto r = nda::linalg::cg(make_op(A), b, x);
+  EXPECT_TRUE(r.converged);
+  EXPECT_ARRAY_NEAR(A * x, b, 1.e-8);
+
+  // with a preconditioner, from an initial guess
+  nda::vector<double> x2 = nda::rand<double>(n);
+  auto r2                = nda::linalg::cg(make_op(A), b, x2, {}, make_jacobi(A));
+  EXPECT_TRUE(r2.converged);
+  EXPECT_LE(r2.n_iterations, r.n_iterations);
+  EXPECT_ARRAY_NEAR(x2, x, 1.e-8);
+}
+
+// -----------------------------------------------------
+
+TEST(LinearSolvers, GMRES) { //NOLINT
+  long n                = 200;
+  auto A                = random_matrix<double>(n, false);
+  nda::vector<double> b = nda::rand<double>(n), x(n);
+
+  // restarted : the Krylov space is smaller than the number of iterations
+  x      = 0;
+  auto r = nda::linalg::gmres(make_op(A), b, x, linear_solver_params{.restart = 5});
+  EXPECT_TRUE(r.converged);
+  EXPECT_GT(r.n_iterations, 5);
+  EXPECT_ARRAY_NEAR(A * x, b, 1.e-8);
+
+  // complex, preconditioned, into a strided view
+  auto Ac                 = random_matrix<dcomplex>(n, false);
+  nda::vector<dcomplex> c = nda::rand<double>(n);
+  nda::vector<dcomplex> y(2 * n);
+  y       = 0;
+  auto rc = nda::linalg::gmres(make_op(Ac), c, y(range(0, 2 * n, 2)), {}, make_jacobi(Ac));
+  EXPECT_TRUE(rc.converged);
+  EXPECT_ARRAY_NEAR(Ac * nda::vector<dcomplex>{y(range(0, 2 * n, 2))}, c, 1.e-8);
+}
+
+// -----------------------------------------------------
+
+TEST(LinearSolvers, BiCGStab) { //NOLINT
+  long n                = 200;
+  auto A                = random_matrix<double>(n, false);
+  nda::vector<double> b = nda::rand<double>(n), x(n);
+
+  x      = 0;
+  auto r = nda::linalg::bicgstab(make_op(A), b, x, {}, make_jacobi(A));
+  EXPECT_TRUE(r.converged);
+  EXPECT_ARRAY_NEAR(A * x, b, 1.e-8);
+
+  // complex, with a sparse operator
+  auto Ac = random_matrix<dcomplex>(n, false);
+  nda::csr_matrix<dcomplex> S{Ac};
+  auto op = [&S](nda::array_const_view<dcomplex, 1> u, nda::array_view<dcomplex, 1> v) { nda::spmv(dcomplex{1}, S, u, dcomplex{0}, v); };
+  nda::vector<dcomplex> c = nda::rand<double>(n), z(n);
+  z                       = 0;
+  EXPECT_TRUE(nda::linalg::bicgstab(op, c, z).converged);
+  EXPECT_ARRAY_NEAR(Ac * z, c, 1.e-8);
+}
+
+// ----------------------------------------------------------------
+
+TEST(LinearSolvers, BiCGStabBreakdown) { //NOLINT
+  // at the first iteration, s = (0, -1) and t = A s = 0 : omega is not defined
+  nda::matrix<double> A{{1, 0}, {1, 0}};
+  nda::vector<double> b{1, 0}, x{0, 0};
+  auto r = nda::linalg::bicgstab(make_op(A), b, x);
+  EXPECT_FALSE(r.converged);
+  EXPECT_EQ(r.n_iterations, 2);
+  EXPECT_NEAR(r.residual, 1, 1.e-14);
+  EXPECT_ARRAY_NEAR(x, (nda::vector<double>{1, 0}), 1.e-14);
+}
+
+MAKE_MAIN;
@@ -0,0 +1,114 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+#include <nda/linalg.hpp>
+
+using namespace nda::linalg;
+
+// a hermitian matrix, with eigenvalues in [1, 2 n]
+nda::matrix<dcomplex> make_hermitian(long n) {
+  nda::matrix<dcomplex> h(n, n);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j) h(i, j) = (i == j ? 2.0 * n : 0.0) + 0.3 / (1 + i + j) + 0.2i * (i - j) / (1 + i * j);
+  return h;
+}
+
+// exp(a) by its Taylor series
+template <typename T>
+nda::matrix<T> expm_taylor(nda::matrix<T> const &a) {
+  auto r = nda::matrix<T>(a.shape()), t = r;
+  r      = 1;
+  t      = 1;
+  for (int k = 1; k < 60; ++k) {
+    t = nda::matrix<T>{t * a} / k;
+    r += t;
+  }
+  return r;
+}
+
+//----------------------------
+
+TEST(MatrixFunction, Hermitian) { //NOLINT
+  auto h  = make_hermitian(6);
+  auto es = hermitian_eigensystem{h};
+  EXPECT_EQ(es.dim(), 6);
+
+  // f(H) = U f(lambda) U^H, against the explicit product
+  auto U    = nda::matrix<dcomplex>{es.eigenvectors()};
+  auto fexp = [](double x) { return std::exp(-0.1 * x); };
+  nda::matrix<dcomplex> D(6, 6);
+  D = 0;
+  for (int i = 0; i < 6; ++i) D(i, i) = fexp(es.eigenvalues()(i));
+  EXPECT_ARRAY_NEAR(es.apply(fexp), U * D * make_regular(dagger(U)), 1.e-12);
+  EXPECT_ARRAY_NEAR(es.apply([](double) { return 1.0; }), nda::eye<dcomplex>(6), 1.e-12);
+  EXPECT_ARRAY_NEAR(es.apply([](double x) { return x; }), h, 1.e-12);
+
+  // into a view, in Fortran order
+  nda::matrix<dcomplex, nda::F_layout> out(6, 6);
+  es.apply(fexp, out());
+  EXPECT_ARRAY_NEAR(out, es.apply(fexp), 1.e-12);
+
+  // complex function of a real symmetric matrix
+  auto hr  = nda::matrix<double>{real(h + transpose(h))};
+  auto esr = hermitian_eigensystem{hr};
+  auto u   = esr.apply([](double x) { return std::exp(1i * x); });
+  static_assert(std::is_same_v<decltype(u), nda::matrix<dcomplex>>);
+  EXPECT_ARRAY_NEAR(u * make_regular(dagger(u)), nda::eye<dcomplex>(6), 1.e-12);
+
+  // sqrtm, logm, expm
+  auto s = sqrtm(h);
+  EXPECT_ARRAY_NEAR(s * s, h, 1.e-10);
+  EXPECT_ARRAY_NEAR(expm(logm(h)), h, 1.e-10);
+  EXPECT_ARRAY_NEAR(matrix_function(h, [](double x) { return std::exp(x / 10); }), expm(nda::matrix<dcomplex>{h / 10}), 1.e-10);
+  EXPECT_THROW(logm(nda::matrix<dcomplex>{-h}), nda::runtime_error);
+}
+
+//----------------------------
+
+TEST(MatrixFunction, Batch) { //NOLINT
+  auto h    = make_hermitian(5);
+  auto es   = hermitian_eigensystem{h};
+  auto taus = std::vector<double>{0, 0.1, 0.5, 1, 2};
+  auto r    = es.apply_batch([](double x, double tau) { return std::exp(-tau * x); }, taus);
+  EXPECT_EQ(r.shape(), (std::array<long, 3>{5, 5, 5}));
+  for (int k = 0; k < 5; ++k) {
+    double tau = taus[k];
+    EXPECT_ARRAY_NEAR(nda::matrix<dcomplex>{r(k, nda::range::all, nda::range::all)}, es.apply([tau](double x) { return std::exp(-tau * x); }), 1.e-12);
+  }
+}
+
+//----------------------------
+
+TEST(MatrixFunction, Expm) { //NOLINT
+  // all the Pade degrees, with and without scaling
+  nda::matrix<dcomplex> a(4, 4);
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 4; ++j) a(i, j) = (i - 2 * j) * 0.1 + 0.05i * (i * j - 1);
+  for (double s : {0.01, 0.1, 0.5, 1.0, 3.0}) {
+    auto as = nda::matrix<dcomplex>{s * a};
+    EXPECT_ARRAY_NEAR(expm(as), expm_taylor(as), 1.e-10);
+    EXPECT_ARRAY_NEAR(expm(as) * expm(nda::matrix<dcomplex>{-as}), nda::eye<dcomplex>(4), 1.e-10);
+  }
+
+  // a rotation, with a large norm
+  double t = 20;
+  auto rot = expm(nda::matrix<double>{{0, -t}, {t, 0}});
+  EXPECT_ARRAY_NEAR(rot, (nda::matrix<double>{{std::cos(t), -std::sin(t)}, {std::sin(t), std::cos(t)}}), 1.e-10);
+
+  // nilpotent
+  EXPECT_ARRAY_NEAR(expm(nda::matrix<double>{{0, 1}, {0, 0}}), (nda::matrix<double>{{1, 1}, {0, 1}}), 1.e-14);
+}
+
+MAKE_MAIN;
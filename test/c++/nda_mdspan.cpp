@@ -0,0 +1,105 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+
+#include <nda/mdspan.hpp>
+
+// m[i, j] needs C++23
+template <typename M>
+decltype(auto) at(M const &m, long i, long j) {
+  return m.accessor().access(m.data_handle(), m.mapping()(i, j));
+}
+
+// ==============================================================
+
+TEST(Mdspan, ToMdspan) { //NOLINT
+  nda::array<long, 2> A(3, 4);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) A(i, j) = 10 * i + j;
+
+  // C layout
+  auto m = nda::to_mdspan(A);
+  static_assert(std::is_same_v<decltype(m)::layout_type, nda::stdex::layout_right>);
+  EXPECT_EQ(m.data_handle(), A.data());
+  EXPECT_EQ(m.extent(0), 3);
+  EXPECT_EQ(m.extent(1), 4);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) EXPECT_EQ(at(m, i, j), A(i, j));
+
+  // Fortran layout
+  nda::array<long, 2, F_layout> AF = A;
+  auto mf                          = nda::to_mdspan(AF);
+  static_assert(std::is_same_v<decltype(mf)::layout_type, nda::stdex::layout_left>);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) EXPECT_EQ(at(mf, i, j), A(i, j));
+
+  // a strided slice, written through the mdspan
+  auto ms = nda::to_mdspan(A(_, range(0, 4, 2)));
+  static_assert(std::is_same_v<decltype(ms)::layout_type, nda::stdex::layout_stride>);
+  EXPECT_EQ(ms.stride(0), 4);
+  EXPECT_EQ(ms.stride(1), 2);
+  at(ms, 2, 1) = -1;
+  EXPECT_EQ(A(2, 2), -1);
+
+  // static extents
+  nda::stack_array<double, 2, nda::static_extents(2, 3)> S;
+  auto mst = nda::to_mdspan(S);
+  static_assert(decltype(mst)::extents_type::static_extent(0) == 2);
+  static_assert(decltype(mst)::extents_type::static_extent(1) == 3);
+}
+
+// -----------------------------------------------------
+
+TEST(Mdspan, FromMdspan) { //NOLINT
+  std::vector<double> data(12);
+  for (int i = 0; i < 12; ++i) data[i] = i;
+
+  // layout_right, with a static extent
+  using ext_t = nda::stdex::extents<long, nda::stdex::dynamic_extent, 4>;
+  nda::stdex::mdspan<double, ext_t> m{data.data(), nda::stdex::layout_right::mapping<ext_t>{ext_t{3}}};
+  auto v = nda::make_array_view(m);
+  EXPECT_EQ(v.shape(), (std::array<long, 2>{3, 4}));
+  EXPECT_EQ(v.data(), data.data());
+  static_assert(decltype(v)::layout_t::static_extents[1] == 4);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) EXPECT_EQ(v(i, j), at(m, i, j));
+
+  // layout_left
+  using dext_t = nda::stdex::extents<long, nda::stdex::dynamic_extent, nda::stdex::dynamic_extent>;
+  nda::stdex::mdspan<double, dext_t, nda::stdex::layout_left> ml{data.data(), nda::stdex::layout_left::mapping<dext_t>{dext_t{3, 4}}};
+  auto vl = nda::make_array_view(ml);
+  EXPECT_TRUE(vl.indexmap().is_stride_order_Fortran());
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) EXPECT_EQ(vl(i, j), at(ml, i, j));
+
+  // layout_stride : every other column, assigned through nda
+  nda::stdex::mdspan<double, dext_t, nda::stdex::layout_stride> mst{data.data(),
+                                                                    nda::stdex::layout_stride::mapping<dext_t>{dext_t{3, 2}, std::array<long, 2>{4, 2}}};
+  auto vs = nda::make_array_view(mst);
+  vs      = 0;
+  EXPECT_EQ(data[0], 0);
+  EXPECT_EQ(data[1], 1);
+  EXPECT_EQ(data[10], 0);
+
+  // round trip, with the no_alias accessor
+  nda::array<double, 2> A = nda::rand<double>(3, 4);
+  using view_t            = nda::basic_array_view<double, 2, nda::C_layout, 'A', nda::no_alias_accessor, nda::borrowed>;
+  auto mna                = nda::to_mdspan(view_t{A});
+  auto vna                = nda::make_array_view(mna);
+  static_assert(std::is_same_v<decltype(vna), view_t>);
+  EXPECT_ARRAY_EQ(vna, A);
+}
+
+MAKE_MAIN;
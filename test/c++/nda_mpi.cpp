@@ -172,4 +172,47 @@ TEST(Arrays, array_transpose_bcast) { //NOLINT
   EXPECT_ARRAY_EQ(At, B);
 }
 
+// ----------------------------------------------------------------
+
+TEST(Arrays, MPIMergeAccumulators) { //NOLINT
+
+  mpi::communicator world;
+  long n      = 1000;
+  auto sample = [](long t) {
+    nda::array<double, 1> x(3);
+    for (int i = 0; i < 3; ++i) x(i) = std::sin(double(t * (i + 1))) + i;
+    return x;
+  };
+
+  // all the samples on one node, and the ones of this node
+  nda::mean_accumulator<double, 1> m_all({3}), m({3});
+  nda::log_binning_accumulator<double, 1> l_all({3}, 8), l({3}, 8);
+  nda::jackknife_accumulator<double, 1> j({3}, 16);
+  auto [start, end] = chunk_range(0, n, world.size(), world.rank());
+  for (long t = 0; t < n; ++t) {
+    m_all << sample(t);
+    l_all << sample(t);
+  }
+  for (long t = start; t < end; ++t) {
+    m << sample(t);
+    l << sample(t);
+    j << sample(t);
+  }
+
+  nda::mpi_merge(m, world);
+  EXPECT_EQ(m.count(), n);
+  EXPECT_ARRAY_NEAR(m.mean(), m_all.mean(), 1e-12);
+  EXPECT_ARRAY_NEAR(m.variance(), m_all.variance(), 1e-12);
+
+  nda::mpi_merge(l, world);
+  EXPECT_EQ(l.count(), n);
+  EXPECT_ARRAY_NEAR(l.error(0), l_all.error(0), 1e-12);
+
+  long bs = mpi::all_reduce(j.bin_size(), world, MPI_MAX);
+  nda::mpi_merge(j, world);
+  EXPECT_EQ(j.bin_size() % bs, 0);
+  EXPECT_LT(j.n_full_bins(), 16);
+  EXPECT_GT(j.count(), n / 2);
+}
+
 MAKE_MAIN_MPI
@@ -0,0 +1,188 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+#include <nda/npy.hpp>
+
+#include <fstream>
+
+// the bytes of a file
+static std::string read_file(std::string const &filename) {
+  std::ifstream f(filename, std::ios::binary);
+  return {std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>()};
+}
+
+// the offset of the data in a .npy of version 1.0
+static long data_offset(std::string const &s) { return 10 + long(static_cast<unsigned char>(s[8]) | static_cast<unsigned char>(s[9]) << 8); }
+
+static void write_file(std::string const &filename, std::string const &s) {
+  std::ofstream f(filename, std::ios::binary);
+  f.write(s.data(), long(s.size()));
+}
+
+// ==============================================================
+
+TEST(Npy, Header) { //NOLINT
+  nda::array<double, 2> a(2, 3);
+  a() = 1;
+  nda::npy_save("npy_header.npy", a);
+  auto s = read_file("npy_header.npy");
+
+  // as np.save : magic, version 1.0, header padded to a multiple of 64 bytes
+  EXPECT_EQ(s.substr(0, 6), std::string("\x93NUMPY"));
+  EXPECT_EQ(s[6], 1);
+  EXPECT_EQ(data_offset(s), 128);
+  EXPECT_EQ(s.size(), 128 + 6 * sizeof(double));
+  auto dict = s.substr(10, 118);
+  EXPECT_EQ(dict.substr(0, dict.find('}') + 1), "{'descr': '<f8', 'fortran_order': False, 'shape': (2, 3), }");
+  EXPECT_EQ(dict.back(), '\n');
+
+  nda::npy_save("npy_header.npy", nda::array<long, 1>(5));
+  dict = read_file("npy_header.npy").substr(10);
+  EXPECT_EQ(dict.substr(0, dict.find('}') + 1), "{'descr': '<i8', 'fortran_order': False, 'shape': (5,), }");
+}
+
+// ----------------------------------------------------------------
+
+TEST(Npy, RoundTrip) { //NOLINT
+  nda::array<double, 3> a(2, 3, 4);
+  nda::array<dcomplex, 2> z(3, 5);
+  nda::array<int, 1> v(7);
+  nda::array<bool, 2> b(2, 2);
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 3; ++j)
+      for (int k = 0; k < 4; ++k) a(i, j, k) = i + 10 * j + 100 * k;
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 5; ++j) z(i, j) = dcomplex(i, j);
+  for (int i = 0; i < 7; ++i) v(i) = -i;
+  b(0, 0) = true, b(0, 1) = false, b(1, 0) = false, b(1, 1) = true;
+
+  nda::npy_save("npy_a.npy", a);
+  nda::npy_save("npy_z.npy", z);
+  nda::npy_save("npy_v.npy", v);
+  nda::npy_save("npy_b.npy", b);
+
+  EXPECT_EQ_ARRAY(a, (nda::npy_load<double, 3>("npy_a.npy")));
+  EXPECT_EQ_ARRAY(z, (nda::npy_load<dcomplex, 2>("npy_z.npy")));
+  EXPECT_EQ_ARRAY(v, (nda::npy_load<int, 1>("npy_v.npy")));
+  EXPECT_EQ_ARRAY(b, (nda::npy_load<bool, 2>("npy_b.npy")));
+
+  // lazy expressions
+  nda::npy_save("npy_expr.npy", 2 * a);
+  EXPECT_EQ_ARRAY(make_regular(2 * a), (nda::npy_load<double, 3>("npy_expr.npy")));
+
+  // no conversion, and the rank must match
+  EXPECT_THROW((nda::npy_load<float, 3>("npy_a.npy")), nda::runtime_error);
+  EXPECT_THROW((nda::npy_load<double, 2>("npy_a.npy")), nda::runtime_error);
+  EXPECT_THROW((nda::npy_load<double, 1>("npy_missing.npy")), nda::runtime_error);
+}
+
+// ----------------------------------------------------------------
+
+TEST(Npy, Layouts) { //NOLINT
+  nda::array<double, 2, F_layout> f(3, 4);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) f(i, j) = i + 10 * j;
+
+  // a F_layout array is written in Fortran order, without copy
+  nda::npy_save("npy_f.npy", f);
+  auto s = read_file("npy_f.npy");
+  EXPECT_NE(s.find("'fortran_order': True"), std::string::npos);
+  EXPECT_EQ(std::memcmp(s.data() + data_offset(s), f.data(), 12 * sizeof(double)), 0);
+
+  // it can be loaded in either layout
+  EXPECT_EQ_ARRAY(f, (nda::npy_load<double, 2, F_layout>("npy_f.npy")));
+  EXPECT_EQ_ARRAY(f, (nda::npy_load<double, 2>("npy_f.npy")));
+
+  // a C ordered file in a F_layout array
+  nda::npy_save("npy_c.npy", nda::array<double, 2>(f));
+  EXPECT_EQ_ARRAY(f, (nda::npy_load<double, 2, F_layout>("npy_c.npy")));
+
+  // non contiguous views are written in C order
+  nda::array<double, 2> c(f);
+  nda::npy_save("npy_slice.npy", c(_, range(0, 4, 2)));
+  EXPECT_EQ_ARRAY(c(_, range(0, 4, 2)), (nda::npy_load<double, 2>("npy_slice.npy")));
+  nda::npy_save("npy_transpose.npy", transpose(c));
+  EXPECT_EQ_ARRAY(transpose(c), (nda::npy_load<double, 2>("npy_transpose.npy")));
+}
+
+// ----------------------------------------------------------------
+
+TEST(Npy, ByteSwap) { //NOLINT
+  nda::array<double, 1> a{1.5, -2, 3.25};
+  nda::npy_save("npy_swap.npy", a);
+
+  // the same file, in the other byte order
+  auto s  = read_file("npy_swap.npy");
+  auto d  = s.find("<f8");
+  char o  = (std::endian::native == std::endian::little ? '>' : '<');
+  s[d]    = o;
+  auto *p = reinterpret_cast<unsigned char *>(s.data() + data_offset(s));
+  for (int i = 0; i < 3; ++i) std::reverse(p + 8 * i, p + 8 * (i + 1));
+  write_file("npy_swap_other.npy", s);
+
+  EXPECT_EQ_ARRAY(a, (nda::npy_load<double, 1>("npy_swap_other.npy")));
+  // a mapping can not swap the bytes
+  EXPECT_THROW((nda::npy_mmap<double, 1>("npy_swap_other.npy")), nda::runtime_error);
+}
+
+// ----------------------------------------------------------------
+
+TEST(Npy, Mmap) { //NOLINT
+  nda::array<dcomplex, 3> a(2, 3, 4);
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 3; ++j)
+      for (int k = 0; k < 4; ++k) a(i, j, k) = dcomplex(i + 10 * j, k);
+  nda::npy_save("npy_mmap.npy", a);
+
+  auto m = nda::npy_mmap<dcomplex, 3>("npy_mmap.npy");
+  EXPECT_EQ_ARRAY(a, m.view());
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(m.view().data()) % 64, 0);
+
+  // the mapping can be moved, the view stays valid
+  auto m2 = std::move(m);
+  EXPECT_EQ_ARRAY(a, m2.view());
+
+  // the memory order of the file is required
+  EXPECT_THROW((nda::npy_mmap<dcomplex, 3, F_layout>("npy_mmap.npy")), nda::runtime_error);
+  nda::npy_save("npy_mmap_f.npy", nda::array<dcomplex, 3, F_layout>(a));
+  EXPECT_EQ_ARRAY(a, (nda::npy_mmap<dcomplex, 3, F_layout>("npy_mmap_f.npy").view()));
+}
+
+// ----------------------------------------------------------------
+
+TEST(Npy, Npz) { //NOLINT
+  nda::array<double, 2> a(3, 4);
+  nda::array<long, 1> b(10);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) a(i, j) = i - j;
+  for (int i = 0; i < 10; ++i) b(i) = i * i;
+
+  {
+    nda::npz_writer w("npy_archive.npz");
+    w.add("a", a);
+    w.add("b", b);
+    w.add("at", transpose(a));
+  }
+
+  nda::npz_reader r("npy_archive.npz");
+  EXPECT_EQ(r.names(), (std::vector<std::string>{"a", "b", "at"}));
+  EXPECT_TRUE(r.contains("b"));
+  EXPECT_FALSE(r.contains("c"));
+  EXPECT_EQ_ARRAY(a, (r.load<double, 2>("a")));
+  EXPECT_EQ_ARRAY(b, (r.load<long, 1>("b")));
+  EXPECT_EQ_ARRAY(transpose(a), (r.load<double, 2>("at")));
+  EXPECT_EQ_ARRAY(a, (r.load<double, 2, F_layout>("a")));
+  EXPECT_THROW((r.load<double, 2>("c")), nda::runtime_error);
+}
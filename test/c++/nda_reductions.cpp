@@ -0,0 +1,162 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+
+// ==============================================================
+
+TEST(Reductions, SumAxis) { //NOLINT
+  auto A = nda::array<double, 3>(nda::rand<double>(3, 4, 5));
+
+  nda::array<double, 2> B0 = nda::sum<0>(A), B1 = nda::sum<1>(A), B2 = nda::sum<2>(A);
+  EXPECT_EQ(B0.shape(), (std::array<long, 2>{4, 5}));
+  EXPECT_EQ(B2.shape(), (std::array<long, 2>{3, 4}));
+
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) EXPECT_NEAR(B2(i, j), sum(A(i, j, _)), 1.e-14);
+  for (int i = 0; i < 3; ++i)
+    for (int k = 0; k < 5; ++k) EXPECT_NEAR(B1(i, k), sum(A(i, _, k)), 1.e-14);
+  for (int j = 0; j < 4; ++j)
+    for (int k = 0; k < 5; ++k) EXPECT_NEAR(B0(j, k), sum(A(_, j, k)), 1.e-14);
+
+  // lazy evaluation elementwise, in an expression
+  nda::array<double, 2> C = nda::sum<2>(A) + 2 * B2;
+  EXPECT_ARRAY_NEAR(C, 3 * B2, 1.e-14);
+  EXPECT_NEAR(nda::sum<2>(A)(1, 2), B2(1, 2), 1.e-14);
+
+  // multi-axis
+  nda::array<double, 1> D = nda::sum<2, 0>(A);
+  for (int j = 0; j < 4; ++j) EXPECT_NEAR(D(j), sum(A(_, j, _)), 1.e-14);
+}
+
+// -----------------------------------------------------
+
+TEST(Reductions, Layouts) { //NOLINT
+  auto A = nda::array<double, 3>(nda::rand<double>(3, 4, 5));
+  nda::array<double, 2> R1 = nda::sum<1>(A);
+
+  // Fortran layout
+  nda::array<double, 3, F_layout> AF = A;
+  nda::array<double, 2> R1F          = nda::sum<1>(AF);
+  EXPECT_ARRAY_NEAR(R1F, R1, 1.e-14);
+
+  // into a Fortran array
+  nda::array<double, 2, F_layout> R1FF = nda::sum<1>(A);
+  EXPECT_ARRAY_NEAR(R1FF, R1, 1.e-14);
+
+  // a permuted view
+  auto Ap                  = nda::permuted_indices_view<nda::encode(std::array{1, 2, 0})>(A);
+  nda::array<double, 2> Rp = nda::sum<1>(Ap);
+  for (int i = 0; i < Ap.extent(0); ++i)
+    for (int k = 0; k < Ap.extent(2); ++k) EXPECT_NEAR(Rp(i, k), sum(Ap(i, _, k)), 1.e-14);
+
+  // a strided slice, assigned into a view
+  nda::array<double, 2> S(3, 10);
+  S()                   = -1;
+  S(_, range(0, 10, 2)) = nda::sum<1>(A(_, _, range(0, 5)));
+  EXPECT_ARRAY_NEAR(S(_, range(0, 10, 2)), nda::sum<1>(A), 1.e-14);
+  EXPECT_EQ(S(0, 1), -1);
+
+  // an expression
+  nda::array<double, 2> E = nda::sum<1>(2 * A);
+  EXPECT_ARRAY_NEAR(E, 2 * R1, 1.e-14);
+}
+
+// -----------------------------------------------------
+
+TEST(Reductions, MaxMinProduct) { //NOLINT
+  nda::array<int, 2> A{{1, 5, 3}, {4, -2, 6}};
+
+  EXPECT_EQ((nda::array<int, 1>{nda::max<0>(A)}), (nda::array<int, 1>{4, 5, 6}));
+  EXPECT_EQ((nda::array<int, 1>{nda::max<1>(A)}), (nda::array<int, 1>{5, 6}));
+  EXPECT_EQ((nda::array<int, 1>{nda::min<0>(A)}), (nda::array<int, 1>{1, -2, 3}));
+  EXPECT_EQ((nda::array<int, 1>{nda::min<1>(A)}), (nda::array<int, 1>{1, -2}));
+  EXPECT_EQ((nda::array<int, 1>{nda::product<1>(A)}), (nda::array<int, 1>{15, -48}));
+  EXPECT_EQ(nda::max<1>(A)(1), 6);
+
+  // the full reductions are unchanged
+  EXPECT_EQ(sum(A), 17);
+  EXPECT_EQ(product(A), -720);
+}
+
+// -----------------------------------------------------
+
+TEST(Reductions, Cumsum) { //NOLINT
+  nda::array<int, 2> A{{1, 2, 3}, {4, 5, 6}};
+
+  nda::array<int, 2> C0 = nda::cumsum<0>(A), C1 = nda::cumsum<1>(A);
+  EXPECT_EQ(C0, (nda::array<int, 2>{{1, 2, 3}, {5, 7, 9}}));
+  EXPECT_EQ(C1, (nda::array<int, 2>{{1, 3, 6}, {4, 9, 15}}));
+
+  // Fortran layout and lazy evaluation
+  nda::array<int, 2, F_layout> C1F = nda::cumsum<1>(A);
+  EXPECT_EQ(C1F, C1);
+  EXPECT_EQ(nda::cumsum<1>(A)(1, 2), 15);
+
+  auto B                   = nda::array<double, 3>(nda::rand<double>(3, 4, 5));
+  nda::array<double, 3> CB = nda::cumsum<2>(B);
+  EXPECT_NEAR(CB(2, 3, 4), sum(B(2, 3, _)), 1.e-14);
+}
+
+// -----------------------------------------------------
+
+TEST(Reductions, Tiled) { //NOLINT
+  auto A = nda::array<double, 2>(nda::rand<double>(8, 8));
+
+  // into a tiled array, which has no strides
+  nda::array<double, 2, nda::tiled_layout<4>> T(8, 8);
+  T = nda::cumsum<1>(A);
+  EXPECT_ARRAY_NEAR(T, nda::array<double, 2>(nda::cumsum<1>(A)), 1.e-14);
+  T = nda::cumsum<0>(A);
+  EXPECT_ARRAY_NEAR(T, nda::array<double, 2>(nda::cumsum<0>(A)), 1.e-14);
+
+  nda::array<double, 1, nda::tiled_layout<4>> S(8);
+  S = nda::sum<0>(A);
+  EXPECT_ARRAY_NEAR(S, nda::array<double, 1>(nda::sum<0>(A)), 1.e-14);
+
+  // from a tiled array
+  nda::array<double, 2, nda::tiled_layout<4>> B = A;
+  nda::array<double, 1> R                        = nda::max<1>(B);
+  EXPECT_ARRAY_NEAR(R, nda::array<double, 1>(nda::max<1>(A)), 1.e-14);
+  nda::array<double, 2> C = nda::cumsum<1>(B);
+  EXPECT_ARRAY_NEAR(C, nda::array<double, 2>(nda::cumsum<1>(A)), 1.e-14);
+}
+
+// -----------------------------------------------------
+
+TEST(Reductions, Parallel) { //NOLINT
+  // large enough to be cut in chunks by the pool
+  nda::exec::configure({.n_threads = 4});
+  auto A = nda::array<double, 3>(nda::rand<double>(40, 50, 60));
+
+  for (int u = 0; u < 3; ++u) {
+    nda::array<double, 2> R = (u == 0 ? nda::array<double, 2>(nda::sum<0>(A)) : (u == 1 ? nda::array<double, 2>(nda::sum<1>(A)) : nda::sum<2>(A)));
+    nda::for_each(R.shape(), [&](long x, long y) {
+      double s = 0;
+      for (long i = 0; i < A.shape()[u]; ++i) s += (u == 0 ? A(i, x, y) : (u == 1 ? A(x, i, y) : A(x, y, i)));
+      EXPECT_NEAR(R(x, y), s, 1.e-12);
+    });
+  }
+
+  // the slowest dimension is reduced : the chunks are taken along the next one
+  nda::array<double, 1> M = nda::max<0, 1>(A);
+  for (long k = 0; k < 60; ++k) EXPECT_EQ(M(k), max_element(A(_, _, k)));
+
+  nda::array<double, 3> C0 = nda::cumsum<0>(A), C2 = nda::cumsum<2>(A);
+  EXPECT_NEAR(C0(39, 7, 8), sum(A(_, 7, 8)), 1.e-12);
+  EXPECT_NEAR(C2(5, 7, 59), sum(A(5, 7, _)), 1.e-12);
+  nda::exec::configure({});
+}
+
+MAKE_MAIN;
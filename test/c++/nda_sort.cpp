@@ -0,0 +1,179 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+static nda::array<double, 1> random_vector(long n, unsigned seed = 1) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> d(-1, 1);
+  nda::array<double, 1> v(n);
+  for (auto &x : v) x = d(gen);
+  return v;
+}
+
+// ==============================================================
+
+TEST(Sort, Vector) { //NOLINT
+  // large enough for the parallel merge sort
+  for (long n : {0l, 1l, 100l, 200001l}) {
+    auto v = random_vector(n);
+    auto w = v;
+    nda::sort(v);
+    std::sort(w.data(), w.data() + n);
+    EXPECT_EQ_ARRAY(v, w);
+  }
+
+  // non contiguous
+  auto v = random_vector(100);
+  auto s = v(range(0, 100, 3));
+  nda::sort(s);
+  for (long i = 1; i < s.size(); ++i) EXPECT_LE(s(i - 1), s(i));
+  EXPECT_EQ(v(1), random_vector(100)(1));
+
+  // NaN are last
+  nda::array<double, 1> a{3, std::nan(""), 1, 2};
+  nda::sort(a);
+  EXPECT_EQ(a(0), 1);
+  EXPECT_EQ(a(2), 3);
+  EXPECT_TRUE(std::isnan(a(3)));
+}
+
+// ==============================================================
+
+TEST(Sort, ParallelMerge) { //NOLINT
+  // the merges are cut along the merge path : many ties, and pool sizes which are not powers of 2
+  std::mt19937 gen(2);
+  std::uniform_int_distribution<long> d(0, 50);
+  for (int nt : {2, 3, 4, 7}) {
+    nda::exec::configure({.n_threads = nt});
+    nda::array<long, 1> v(300001);
+    for (auto &x : v) x = d(gen);
+    auto w = v;
+    nda::sort(v);
+    std::sort(w.data(), w.data() + w.size());
+    EXPECT_EQ_ARRAY(v, w);
+  }
+
+  // a merge cut in parts is the stable merge : same as std::merge, on (key, origin) pairs compared by key
+  using pair_t = std::pair<long, int>;
+  std::vector<pair_t> a(1000), b(777), r1(1777), r2(1777);
+  for (auto &x : a) x = {d(gen), 0};
+  for (auto &x : b) x = {d(gen), 1};
+  auto comp = [](pair_t const &x, pair_t const &y) { return x.first < y.first; };
+  std::sort(a.begin(), a.end(), comp);
+  std::sort(b.begin(), b.end(), comp);
+  std::merge(a.begin(), a.end(), b.begin(), b.end(), r1.begin(), comp);
+  for (long n_parts : {1, 2, 5, 16}) {
+    for (long t = 0; t < n_parts; ++t) nda::sort_details::merge_part(a.data(), 1000, b.data(), 777, r2.data(), t, n_parts, comp);
+    EXPECT_EQ(r1, r2);
+  }
+
+  nda::exec::configure({});
+}
+
+// ==============================================================
+
+TEST(Sort, Axis) { //NOLINT
+  nda::array<long, 3> a(4, 5, 6);
+  for (auto [i, j, k] : a.indices()) a(i, j, k) = (7 * i + 11 * j + 13 * k) % 17;
+
+  for (int axis = 0; axis < 3; ++axis) {
+    auto b = a;
+    nda::sort(b, axis);
+    auto r = nda::argsort(a, axis);
+    for (auto [i, j, k] : a.indices()) {
+      std::array<long, 3> idx{i, j, k}, prev = idx;
+      if (idx[axis] == 0) continue;
+      prev[axis] -= 1;
+      EXPECT_LE(b(prev[0], prev[1], prev[2]), b(i, j, k));
+
+      // a taken at the argsort indices is b
+      auto src  = idx;
+      src[axis] = r(i, j, k);
+      EXPECT_EQ(a(src[0], src[1], src[2]), b(i, j, k));
+    }
+  }
+
+  EXPECT_THROW(nda::sort(a, 3), nda::runtime_error); //NOLINT
+}
+
+// ==============================================================
+
+TEST(Sort, Argsort) { //NOLINT
+  for (long n : {10l, 200001l}) {
+    auto v = random_vector(n, 3);
+    v(n / 2) = v(0); // a tie
+    auto r   = nda::argsort(v);
+    for (long i = 1; i < n; ++i) {
+      EXPECT_LE(v(r(i - 1)), v(r(i)));
+      if (v(r(i - 1)) == v(r(i))) { EXPECT_LT(r(i - 1), r(i)); } // stable
+    }
+  }
+}
+
+// ==============================================================
+
+TEST(Sort, PartialSort) { //NOLINT
+  auto v = random_vector(1000);
+  auto w = v;
+  std::sort(w.data(), w.data() + 1000);
+  nda::partial_sort(v, 10);
+  EXPECT_EQ_ARRAY(v(range(0, 10)), w(range(0, 10)));
+
+  nda::array<double, 2> a(3, 50);
+  for (int i = 0; i < 3; ++i) a(i, _) = random_vector(50, i);
+  nda::partial_sort(a, 5, 1);
+  for (int i = 0; i < 3; ++i) {
+    auto s = random_vector(50, i);
+    nda::sort(s);
+    EXPECT_EQ_ARRAY(a(i, range(0, 5)), s(range(0, 5)));
+  }
+}
+
+// ==============================================================
+
+TEST(Sort, SearchSorted) { //NOLINT
+  nda::array<double, 1> s{1, 2, 2, 2, 5};
+  EXPECT_EQ(nda::searchsorted(s, 2.0), 1);
+  EXPECT_EQ(nda::searchsorted(s, 2.0, nda::search_side::right), 4);
+  EXPECT_EQ(nda::searchsorted(s, 0.0), 0);
+  EXPECT_EQ(nda::searchsorted(s, 9.0), 5);
+
+  nda::array<double, 1> x{0, 1.5, 2, 6};
+  auto r = nda::searchsorted(s, x);
+  EXPECT_EQ_ARRAY(r, (nda::array<long, 1>{0, 1, 1, 5}));
+
+  nda::array<double, 2> x2{{0, 1.5}, {2, 6}};
+  auto r2 = nda::searchsorted(s, x2, nda::search_side::right);
+  EXPECT_EQ_ARRAY(r2, (nda::array<long, 2>{{0, 1}, {4, 5}}));
+}
+
+// ==============================================================
+
+TEST(Sort, Unique) { //NOLINT
+  nda::array<long, 2> a{{3, 1, 3}, {2, 1, 7}};
+  EXPECT_EQ_ARRAY(nda::unique(a), (nda::array<long, 1>{1, 2, 3, 7}));
+
+  nda::array<double, 1> b{std::nan(""), 1, std::nan(""), 1};
+  auto u = nda::unique(b);
+  EXPECT_EQ(u.size(), 2);
+  EXPECT_EQ(u(0), 1);
+  EXPECT_TRUE(std::isnan(u(1)));
+}
+
+MAKE_MAIN;
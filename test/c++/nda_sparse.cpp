@@ -0,0 +1,112 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+
+// a random sparse matrix, with about 1 element in 5 != 0
+template <typename T>
+nda::matrix<T> random_sparse(long n, long m) {
+  nda::matrix<T> A = nda::rand<double>(n, m);
+  nda::matrix<double> mask = nda::rand<double>(n, m);
+  for (long i = 0; i < n; ++i)
+    for (long j = 0; j < m; ++j)
+      if (mask(i, j) > 0.2) A(i, j) = 0;
+  return A;
+}
+
+// ==============================================================
+
+TEST(Sparse, Assembly) { //NOLINT
+  nda::coo_matrix<double> C(3, 4);
+  C.insert(2, 1, 1.0);
+  C.insert(0, 3, 2.0);
+  C.insert(0, 0, 3.0);
+  C.insert(2, 1, 4.0); // duplicate
+  EXPECT_EQ(C.nnz(), 4);
+
+  auto D = nda::to_dense(C);
+  EXPECT_EQ(D, (nda::matrix<double>{{3, 0, 0, 2}, {0, 0, 0, 0}, {0, 5, 0, 0}}));
+
+  // CSR : sorted columns, summed duplicates
+  nda::csr_matrix<double> A{C};
+  EXPECT_EQ(A.nnz(), 3);
+  EXPECT_EQ(A.ptr(), (nda::array<long, 1>{0, 2, 2, 3}));
+  EXPECT_EQ(A.idx(), (nda::array<long, 1>{0, 3, 1}));
+  EXPECT_EQ(A.values(), (nda::array<double, 1>{3, 2, 5}));
+  EXPECT_EQ(nda::to_dense(A), D);
+
+  // CSC
+  nda::csc_matrix<double> B{C};
+  EXPECT_EQ(B.ptr(), (nda::array<long, 1>{0, 1, 2, 2, 3}));
+  EXPECT_EQ(B.idx(), (nda::array<long, 1>{0, 2, 0}));
+  EXPECT_EQ(nda::to_dense(B), D);
+
+  // CSR <-> CSC, dense -> CSR
+  EXPECT_EQ(nda::csc_matrix<double>{A}, B);
+  EXPECT_EQ(nda::csr_matrix<double>{B}, A);
+  EXPECT_EQ(nda::csr_matrix<double>{D}, A);
+  EXPECT_EQ(nda::csc_matrix<double>{D}, B);
+}
+
+// -----------------------------------------------------
+
+TEST(Sparse, SpMV) { //NOLINT
+  auto D = random_sparse<double>(40, 30);
+  nda::csr_matrix<double> A{D};
+  nda::csc_matrix<double> B{D};
+  nda::vector<double> x = nda::rand<double>(30);
+
+  nda::vector<double> y = D * x;
+  EXPECT_ARRAY_NEAR(A * x, y, 1.e-13);
+  EXPECT_ARRAY_NEAR(B * x, y, 1.e-13);
+
+  // alpha, beta, strided views
+  nda::array<double, 1> z = nda::rand<double>(80), z0 = z;
+  nda::array<double, 1> x2(60);
+  x2(range(0, 60, 2)) = x;
+  nda::spmv(2.0, A, x2(range(0, 60, 2)), 3.0, z(range(0, 80, 2)));
+  EXPECT_ARRAY_NEAR(z(range(0, 80, 2)), 2 * y + 3 * z0(range(0, 80, 2)), 1.e-13);
+  EXPECT_ARRAY_EQ(z(range(1, 80, 2)), z0(range(1, 80, 2)));
+  nda::spmv(2.0, B, x, 3.0, z0(range(0, 80, 2)));
+  EXPECT_ARRAY_NEAR(z0(range(0, 80, 2)), z(range(0, 80, 2)), 1.e-13);
+
+  // complex, with an expression as x
+  nda::matrix<dcomplex> Dc = D + 1i * D;
+  nda::csr_matrix<dcomplex> Ac{Dc};
+  nda::vector<dcomplex> yc = Ac * (2 * x);
+  EXPECT_ARRAY_NEAR(yc, nda::vector<dcomplex>{(2 + 2i) * y}, 1.e-13);
+}
+
+// -----------------------------------------------------
+
+TEST(Sparse, SpMM) { //NOLINT
+  auto D = random_sparse<double>(20, 30);
+  nda::csr_matrix<double> A{D};
+  nda::csc_matrix<double> B{D};
+  nda::matrix<double> X = nda::rand<double>(30, 7);
+  nda::matrix<double> Y = D * X;
+
+  EXPECT_ARRAY_NEAR(A * X, Y, 1.e-13);
+  EXPECT_ARRAY_NEAR(B * X, Y, 1.e-13);
+
+  // Fortran layout and beta
+  nda::matrix<double, F_layout> Z = nda::rand<double>(20, 7);
+  nda::matrix<double, F_layout> Z0 = Z;
+  nda::spmm(1.0, A, X, -1.0, Z);
+  EXPECT_ARRAY_NEAR(Z, Y - Z0, 1.e-13);
+  nda::spmm(1.0, B, X, 0.0, Z);
+  EXPECT_ARRAY_NEAR(Z, Y, 1.e-13);
+}
+
+MAKE_MAIN;
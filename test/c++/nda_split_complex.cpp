@@ -0,0 +1,66 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+
+using split_t = nda::split_complex_array<double, 2>;
+
+// ==============================================================
+
+TEST(SplitComplex, Conversion) { //NOLINT
+  nda::array<dcomplex, 2> Z = nda::rand<double>(3, 4) + 1i * nda::rand<double>(3, 4);
+
+  split_t S = Z;
+  EXPECT_EQ(S.shape(), Z.shape());
+  EXPECT_ARRAY_NEAR(real(S), nda::real(Z), 1.e-15);
+  EXPECT_ARRAY_NEAR(imag(S), nda::imag(Z), 1.e-15);
+  EXPECT_COMPLEX_NEAR(S.get(2, 1), Z(2, 1), 1.e-15);
+
+  // real and imag are views
+  EXPECT_EQ(real(S).data(), S.real().data());
+  S.imag()(0, 0) = 42;
+  EXPECT_COMPLEX_NEAR(S.get(0, 0), (dcomplex{Z(0, 0).real(), 42}), 1.e-15);
+  S.imag()(0, 0) = Z(0, 0).imag();
+
+  // back to the interleaved form
+  nda::array<dcomplex, 2> Z2 = S;
+  EXPECT_ARRAY_NEAR(Z2, Z, 1.e-15);
+
+  nda::array<dcomplex, 2, F_layout> ZF(3, 4);
+  ZF() = S;
+  EXPECT_ARRAY_NEAR(ZF, Z, 1.e-15);
+
+  // from an expression
+  S = 2 * Z;
+  EXPECT_ARRAY_NEAR(nda::array<dcomplex, 2>(S), 2 * Z, 1.e-15);
+}
+
+// -----------------------------------------------------
+
+TEST(SplitComplex, Kernels) { //NOLINT
+  nda::array<dcomplex, 2> A = nda::rand<double>(5, 6) + 1i * nda::rand<double>(5, 6);
+  nda::array<dcomplex, 2> B = nda::rand<double>(5, 6) - 1i * nda::rand<double>(5, 6);
+  split_t SA = A, SB = B;
+
+  EXPECT_ARRAY_NEAR(nda::array<dcomplex, 2>(SA + SB), A + B, 1.e-14);
+  EXPECT_ARRAY_NEAR(nda::array<dcomplex, 2>(SA - SB), A - B, 1.e-14);
+  EXPECT_ARRAY_NEAR(nda::array<dcomplex, 2>(SA * SB), A * B, 1.e-14);
+  EXPECT_ARRAY_NEAR(nda::array<dcomplex, 2>(dcomplex{1, 2} * SA), dcomplex{1, 2} * A, 1.e-14);
+  EXPECT_ARRAY_NEAR(nda::array<dcomplex, 2>(conj(SA)), conj(A), 1.e-14);
+  EXPECT_ARRAY_NEAR(nda::array<dcomplex, 2>(exp(SA)), exp(A), 1.e-14);
+  EXPECT_ARRAY_NEAR(abs(SA), abs(A), 1.e-14);
+  EXPECT_ARRAY_NEAR(abs2(SA), nda::real(A * conj(A)), 1.e-14);
+}
+
+MAKE_MAIN;
@@ -85,6 +85,35 @@ TEST(StackArray, slice) { //NOLINT
 
 // ==============================================================
 
+TEST(StackArray, FullyStaticLayout) { //NOLINT
+
+  using a_t = nda::stack_array<double, 2, nda::static_extents(3, 4)>;
+  static_assert(a_t::layout_t::is_fully_static);
+
+  // no storage for the layout : the array is a plain C array
+  static_assert(sizeof(a_t) == 12 * sizeof(double));
+
+  a_t a;
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) a(i, j) = i + 10 * j;
+  EXPECT_EQ(a.shape(), (std::array<long, 2>{3, 4}));
+  EXPECT_EQ(a.indexmap().strides(), (std::array<long, 2>{4, 1}));
+  EXPECT_EQ(a.data()[2 * 4 + 3], 32);
+
+  auto b = a;
+  b *= 2;
+  EXPECT_ARRAY_NEAR(b, nda::array<double, 2>{2 * a});
+
+  // views
+  auto v = a(1, _);
+  static_assert(std::is_empty_v<std::decay_t<decltype(v.indexmap())>>);
+  EXPECT_ARRAY_NEAR(v, (nda::array<double, 1>{1, 11, 21, 31}));
+  EXPECT_ARRAY_NEAR(a(_, 2), (nda::array<double, 1>{20, 21, 22}));
+  EXPECT_ARRAY_NEAR(transpose(a)(3, _), (nda::array<double, 1>{30, 31, 32}));
+}
+
+// ==============================================================
+
 TEST(Loop, Static) { //NOLINT
   nda::array<long, 2> a(3, 3);
 
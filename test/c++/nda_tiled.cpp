@@ -0,0 +1,77 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "./test_common.hpp"
+
+template <typename T, int R, int B>
+using tiled_array = nda::basic_array<T, R, nda::tiled_layout<B>, 'A', nda::heap>;
+
+// ==============================================================
+
+TEST(Tiled, IdxMap) { //NOLINT
+  // the map is a bijection onto [0, size[, with the elements of one tile contiguous
+  nda::tiled_idx_map<2, 4> m{std::array<long, 2>{10, 7}};
+  EXPECT_EQ(m.size(), 70);
+
+  std::vector<int> seen(70, 0);
+  for (long i = 0; i < 10; ++i)
+    for (long j = 0; j < 7; ++j) seen[m(i, j)]++;
+  EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](int x) { return x == 1; }));
+
+  EXPECT_EQ(m(0, 0), 0);
+  EXPECT_EQ(m(0, 3), 3);
+  EXPECT_EQ(m(1, 0), 4);
+  EXPECT_EQ(m(0, 4), 16);  // second tile, after the first 4x4 one
+  EXPECT_EQ(m(1, 4), 19);  // the second tile is 4x3
+  EXPECT_EQ(m(8, 0), 56);  // last row of tiles, truncated to 2 rows
+  EXPECT_EQ(m(9, 6), 69);
+
+  // for_each_tiled follows the memory order
+  long n = 0;
+  nda::for_each_tiled<4>(m.lengths(), [&](long i, long j) { EXPECT_EQ(m(i, j), n++); });
+  EXPECT_EQ(n, 70);
+
+  // rank 3
+  nda::tiled_idx_map<3, 2> m3{std::array<long, 3>{3, 5, 4}};
+  n = 0;
+  nda::for_each_tiled<2>(m3.lengths(), [&](long i, long j, long k) { EXPECT_EQ(m3(i, j, k), n++); });
+  EXPECT_EQ(n, 60);
+}
+
+// -----------------------------------------------------
+
+TEST(Tiled, Array) { //NOLINT
+  nda::array<double, 2> A(13, 9);
+  for (int i = 0; i < 13; ++i)
+    for (int j = 0; j < 9; ++j) A(i, j) = i + 100 * j;
+
+  // copy from and to strided arrays
+  tiled_array<double, 2, 4> T = A;
+  EXPECT_EQ(T.shape(), A.shape());
+  for (int i = 0; i < 13; ++i)
+    for (int j = 0; j < 9; ++j) EXPECT_EQ(T(i, j), A(i, j));
+
+  nda::array<double, 2, F_layout> AF = T;
+  EXPECT_ARRAY_EQ(AF, A);
+
+  // copy of a tiled array, assignment of a scalar and an expression
+  auto T2 = T;
+  T2()    = 2;
+  EXPECT_EQ(T2(12, 8), 2);
+  T2                      = T + 2 * T;
+  nda::array<double, 2> B = T2;
+  EXPECT_ARRAY_EQ(B, nda::make_regular(3 * A));
+}
+
+MAKE_MAIN;
@@ -0,0 +1,141 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The regions of this file are recorded, whether or not the library is compiled with tracing
+#ifndef NDA_TRACE
+#define NDA_TRACE
+#endif
+
+#include "./test_common.hpp"
+#include <nda/h5.hpp>
+#include <nda/tracing.hpp>
+
+#include <sstream>
+#include <thread>
+
+namespace tracing = nda::tracing;
+
+static int count_named(std::vector<tracing::event_t> const &evs, std::string const &name) {
+  int n = 0;
+  for (auto const &e : evs) n += (e.name == name);
+  return n;
+}
+
+// ==============================================================
+
+TEST(Tracing, Regions) { //NOLINT
+  tracing::clear();
+  {
+    NDA_TRACE_REGION("outer", "test", 100, 800);
+    for (int i = 0; i < 3; ++i) { NDA_TRACE_REGION("inner", "test", 10); }
+  }
+  std::thread t([] { NDA_TRACE_REGION("inner", "test", 10); });
+  t.join();
+
+  auto evs = tracing::events();
+  EXPECT_EQ(count_named(evs, "outer"), 1);
+  EXPECT_EQ(count_named(evs, "inner"), 4);
+
+  // sorted by begin time, the outer region first, and containing the inner ones of its thread
+  EXPECT_EQ(std::string{evs[0].name}, "outer");
+  for (auto const &e : evs) {
+    if (e.thread != evs[0].thread) continue;
+    EXPECT_GE(e.begin_ns, evs[0].begin_ns);
+    EXPECT_LE(e.begin_ns + e.duration_ns, evs[0].begin_ns + evs[0].duration_ns);
+  }
+
+  // the thread which has finished is kept, with its own index
+  int n_threads = 0;
+  for (auto const &e : evs) n_threads += (e.thread != evs[0].thread);
+  EXPECT_EQ(n_threads, 1);
+}
+
+// ==============================================================
+
+TEST(Tracing, Summary) { //NOLINT
+  tracing::clear();
+  for (int i = 0; i < 5; ++i) { NDA_TRACE_REGION("r", "test", 1e6, 8e6); }
+  tracing::enable(false);
+  { NDA_TRACE_REGION("r", "test", 1e6, 8e6); }
+  tracing::enable(true);
+  { NDA_TRACE_REGION(nullptr, "test"); } // not recorded
+
+  auto s = tracing::summary();
+  ASSERT_EQ(s.size(), 1);
+  EXPECT_EQ(s[0].name, "r");
+  EXPECT_EQ(s[0].category, "test");
+  EXPECT_EQ(s[0].count, 5);
+  EXPECT_EQ(s[0].flops, 5e6);
+  EXPECT_EQ(s[0].bytes, 4e7);
+  EXPECT_LE(s[0].max_s, s[0].total_s);
+
+  std::stringstream out;
+  tracing::print_summary(out);
+  EXPECT_NE(out.str().find("GFlop/s"), std::string::npos);
+}
+
+// ==============================================================
+
+TEST(Tracing, H5) { //NOLINT
+  nda::array<double, 2> a(3, 4);
+  nda::array<dcomplex, 1> z(5);
+  a = 1;
+  z = 1i;
+
+  tracing::clear();
+  {
+    h5::file file("tracing.h5", 'w');
+    h5::group top(file);
+    h5_write(top, "a", a);
+    h5_write(top, "z", z);
+  }
+  nda::array<double, 2> b;
+  {
+    h5::file file("tracing.h5", 'r');
+    h5::group top(file);
+    h5_read(top, "a", b);
+  }
+
+  // one region per array, with the bytes of its data
+  std::vector<tracing::event_t> h5_evs;
+  for (auto const &e : tracing::events())
+    if (std::string{e.category} == "h5") h5_evs.push_back(e);
+  ASSERT_EQ(h5_evs.size(), 3);
+  EXPECT_EQ(std::string{h5_evs[0].name}, "h5_write");
+  EXPECT_EQ(h5_evs[0].bytes, 12 * sizeof(double));
+  EXPECT_EQ(std::string{h5_evs[1].name}, "h5_write");
+  EXPECT_EQ(h5_evs[1].bytes, 5 * sizeof(dcomplex));
+  EXPECT_EQ(std::string{h5_evs[2].name}, "h5_read");
+  EXPECT_EQ(h5_evs[2].bytes, 12 * sizeof(double));
+  EXPECT_EQ(h5_evs[2].flops, 0);
+}
+
+// ==============================================================
+
+TEST(Tracing, ChromeJson) { //NOLINT
+  tracing::clear();
+  tracing::set_rank(3);
+  { NDA_TRACE_REGION("gemm", "blas", 2e3, 24); }
+  tracing::set_rank(0);
+
+  std::stringstream out;
+  tracing::write_chrome_json(out);
+  auto s = out.str();
+  EXPECT_NE(s.find(R"("traceEvents")"), std::string::npos);
+  EXPECT_NE(s.find(R"("name": "gemm", "cat": "blas", "ph": "X")"), std::string::npos);
+  EXPECT_NE(s.find(R"("pid": 3)"), std::string::npos);
+  EXPECT_EQ(s.back(), '\n');
+}
+
+MAKE_MAIN;
@@ -0,0 +1,80 @@
+// Copyright (c) 2026 Simons Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0.txt
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The regions of the mpi functions of nda (this file is also run on 2 nodes)
+#ifndef NDA_TRACE
+#define NDA_TRACE
+#endif
+
+#include "./test_common.hpp"
+#include <nda/mpi.hpp>
+#include <nda/tracing.hpp>
+
+namespace tracing = nda::tracing;
+
+// The events of the category mpi
+static std::vector<tracing::event_t> mpi_events() {
+  std::vector<tracing::event_t> r;
+  for (auto const &e : tracing::events())
+    if (std::string{e.category} == "mpi") r.push_back(e);
+  return r;
+}
+
+// ==============================================================
+
+TEST(TracingMPI, Reduce) { //NOLINT
+  mpi::communicator world;
+  nda::array<double, 1> a(10);
+  a = 1;
+
+  tracing::clear();
+  nda::array<double, 1> s = nda::mpi_reduce(a, world, 0, true);
+  auto evs                = mpi_events();
+
+  // without MPI, the reduction is a copy : no MPI call, no region
+  if (not mpi::has_env) {
+    EXPECT_TRUE(evs.empty());
+    return;
+  }
+  ASSERT_EQ(evs.size(), 1);
+  EXPECT_EQ(std::string{evs[0].name}, "MPI_Allreduce");
+  EXPECT_EQ(evs[0].bytes, 10 * sizeof(double));
+  EXPECT_EQ(evs[0].rank, world.rank());
+  EXPECT_EQ(s(0), world.size());
+}
+
+// ==============================================================
+
+TEST(TracingMPI, GatherBroadcast) { //NOLINT
+  mpi::communicator world;
+  if (not mpi::has_env) return;
+
+  nda::array<long, 1> a(3);
+  a = world.rank();
+
+  tracing::clear();
+  nda::array<long, 1> g = nda::mpi_gather(a, world, 0, true);
+  nda::mpi_broadcast(g, world, 0);
+  auto evs = mpi_events();
+
+  // the gathered array has 3 * size elements
+  ASSERT_EQ(evs.size(), 2);
+  EXPECT_EQ(std::string{evs[0].name}, "MPI_Allgatherv");
+  EXPECT_EQ(evs[0].bytes, 3 * world.size() * sizeof(long));
+  EXPECT_EQ(std::string{evs[1].name}, "MPI_Bcast");
+  EXPECT_EQ(evs[1].bytes, 3 * world.size() * sizeof(long));
+  for (auto const &e : evs) EXPECT_EQ(e.rank, world.rank());
+}
+
+MAKE_MAIN_MPI;
@@ -19,7 +19,8 @@
 #include <limits>
 #include <iostream>
 
-#ifndef NDA_DEBUG
+// The _hoisted variants of the tests check the shapes of the loops, not each element access
+#if not defined(NDA_DEBUG) and not defined(NDA_BOUNDCHECK_HOISTED)
 #define NDA_DEBUG
 #define NDA_ENFORCE_BOUNDCHECK
 #endif